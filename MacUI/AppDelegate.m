@@ -118,6 +118,7 @@ static void createSurface (int fullscreen)
 void UpdateIO(){
     InputSystem_CheckKeyboardInput();
     InputSystem_CheckGamepadInput();
+    InputSystem_UpdateReplay();
     InputSystem_ClearTouchData();
     
     if (stageMode != 2)
@@ -309,6 +310,11 @@ NSMutableDictionary* _appSettings;
     
     // Get GL context attributes
     printAttributes ();
+    
+    if (!EngineContext_CreateBuffers()) {
+        fprintf(stderr, "Couldn't allocate the engine buffers\n");
+        exit(1);
+    }
         
     Init_RetroVM();
     
@@ -316,7 +322,9 @@ NSMutableDictionary* _appSettings;
     mainLoop ();
     
     // Cleanup
+    FileIO_StopSaveRAMWriter();
     InputSystem_Dispose();
+    EngineContext_FreeBuffers();
     SDL_Quit();
     
     //The execute call is blocking, so if we reach this point the user closed the game and we should kill the UI too.
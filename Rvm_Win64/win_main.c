@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 #include "SDL.h"
 #include "GlobalAppDefinitions.h"
 #include <Windows.h>
@@ -114,6 +115,7 @@ static void createSurface(int fullscreen)
 void UpdateIO() {
 	InputSystem_CheckKeyboardInput();
 	InputSystem_CheckGamepadInput();
+	InputSystem_UpdateReplay();
 	InputSystem_ClearTouchData();
 
 	if (stageMode != 2)
@@ -210,6 +212,13 @@ void Init_RetroVM() {
 
 int SDL_main(int argc, char *argv[])
 {
+	// Compare two digest logs and report where they first diverge: exits 0 if they match,
+	// 1 if they diverge and 2 if either can't be read
+	if (argc > 3 && strcmp(argv[1], "-digestcompare") == 0) {
+		int frame = StateDigest_CompareLogs(argv[2], argv[3]);
+		return frame == DIGEST_LOGS_AGREE ? 0 : frame == DIGEST_LOGS_UNREADABLE ? 2 : 1;
+	}
+
 	// Init SDL video subsystem
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_JOYSTICK) < 0) {
 
@@ -227,13 +236,40 @@ int SDL_main(int argc, char *argv[])
 	// Get GL context attributes
 	printAttributes();
 
+	if (!EngineContext_CreateBuffers()) {
+		fprintf(stderr, "Couldn't allocate the engine buffers\n");
+		exit(1);
+	}
+
 	Init_RetroVM();
+	for (int i = 1; i + 1 < argc; i++) {
+		if (strcmp(argv[i], "-record") == 0)
+			InputSystem_StartRecording(argv[i + 1], (uint32_t)time(NULL));
+		else if (strcmp(argv[i], "-replay") == 0)
+			InputSystem_StartPlayback(argv[i + 1]);
+		else if (strcmp(argv[i], "-digest") == 0)
+			StateDigest_StartLog(argv[i + 1]);
+		else if (strcmp(argv[i], "-digestgfx") == 0) {
+			digestGfxEnabled = true;
+			StateDigest_StartLog(argv[i + 1]);
+		}
+	}
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-hw3d") == 0)
+			hardware3DEnabled = true;
+		else if (strcmp(argv[i], "-cull3d") == 0)
+			cull3DBackFaces = true;
+	}
 
 	// Draw, get events...
 	mainLoop();
 
 	// Cleanup
+	InputSystem_StopReplay();
+	StateDigest_StopLog();
+	FileIO_StopSaveRAMWriter();
 	InputSystem_Dispose();
+	EngineContext_FreeBuffers();
 	SDL_Quit();
 
 	return 0;
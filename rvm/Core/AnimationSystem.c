@@ -4,15 +4,13 @@
 //
 
 #include "AnimationSystem.h"
+#include "EngineBuffers.h"
 
-struct SpriteFrame animationFrames[4096];
-int animationFramesNo;
-struct SpriteAnimation animationList[1024];
-int animationListNo;
-struct AnimationFileList animationFile[256];
-int animationFileNo;
-struct CollisionBox collisionBoxList[32];
-int collisionBoxNo;
+ENGINE_STATE int animationFramesNo;
+ENGINE_STATE int animationListNo;
+ENGINE_STATE int animationFileNo;
+ENGINE_STATE int collisionBoxNo;
+ENGINE_STATE int animationDataVersion;
 
 void Init_AnimationSystem()
 {
@@ -53,9 +51,9 @@ void AnimationSystem_LoadAnimationFile(char* filePath)
             }
         }
         b2 = FileIO_ReadByte();
-        animationFile[animationFileNo].numAnimations = (int)b2;
-        animationFile[animationFileNo].aniListOffset = animationListNo;
-        for (int i = 0; i < animationFile[animationFileNo].numAnimations; i++)
+        animationFileList[animationFileNo].numAnimations = (int)b2;
+        animationFileList[animationFileNo].aniListOffset = animationListNo;
+        for (int i = 0; i < animationFileList[animationFileNo].numAnimations; i++)
         {
             b = FileIO_ReadByte();
             int j;
@@ -91,6 +89,7 @@ void AnimationSystem_LoadAnimationFile(char* filePath)
                 animationFrames[animationFramesNo].xPivot = (int)b3;
                 b3 = (char)FileIO_ReadByte();
                 animationFrames[animationFramesNo].yPivot = (int)b3;
+                GraphicsSystem_BuildSpriteQuads(&animationQuads[animationFramesNo << 2], &animationFrames[animationFramesNo], (int)animationFrames[animationFramesNo].surfaceNum);
                 animationFramesNo++;
             }
             if (animationList[animationListNo].rotationFlag == 3)
@@ -101,7 +100,7 @@ void AnimationSystem_LoadAnimationFile(char* filePath)
             animationListNo++;
         }
         b = FileIO_ReadByte();
-        animationFile[animationFileNo].cbListOffset = collisionBoxNo;
+        animationFileList[animationFileNo].cbListOffset = collisionBoxNo;
         for (int i = 0; i < (int)b; i++)
         {
             for (int j = 0; j < 8; j++)
@@ -125,16 +124,16 @@ struct AnimationFileList* AnimationSystem_AddAnimationFile(char* fileName)
     FileIO_StrAdd(filePath, sizeof(filePath), fileName, (int)strlen(fileName));
     while (i < 256)
     {
-        if (strlen(animationFile[i].fileName) <= 0)
+        if (strlen(animationFileList[i].fileName) <= 0)
         {
-            FileIO_StrCopy(animationFile[i].fileName, sizeof(animationFile[i].fileName), fileName, (int)strlen(fileName));
+            FileIO_StrCopy(animationFileList[i].fileName, sizeof(animationFileList[i].fileName), fileName, (int)strlen(fileName));
             AnimationSystem_LoadAnimationFile(filePath);
             animationFileNo++;
-            return &animationFile[i];
+            return &animationFileList[i];
         }
-        if (FileIO_StringComp(animationFile[i].fileName, fileName))
+        if (FileIO_StringComp(animationFileList[i].fileName, fileName))
         {
-            return &animationFile[i];
+            return &animationFileList[i];
         }
         i++;
     }
@@ -142,11 +141,13 @@ struct AnimationFileList* AnimationSystem_AddAnimationFile(char* fileName)
 }
 struct AnimationFileList* AnimationSystem_GetDefaultAnimationRef()
 {
-    return &animationFile[0];
+    return &animationFileList[0];
 }
 void AnimationSystem_ClearAnimationData()
 {
     char array[] = "";
+    //Cached player hitboxes point into these tables
+    animationDataVersion++;
     for (int i = 0; i < 4096; i++)
     {
         animationFrames[i].left = 0;
@@ -170,16 +171,16 @@ void AnimationSystem_ClearAnimationData()
     }
     for (int i = 0; i < 256; i++)
     {
-        FileIO_StrCopy(animationFile[i].fileName, sizeof(animationFile[i].fileName), array, sizeof(array));
+        FileIO_StrCopy(animationFileList[i].fileName, sizeof(animationFileList[i].fileName), array, sizeof(array));
     }
     animationFramesNo = 0;
     animationListNo = 0;
     animationFileNo = 0;
     collisionBoxNo = 0;
-    animationFile[0].numAnimations = 0;
+    animationFileList[0].numAnimations = 0;
     animationList[0].frameListOffset = animationFramesNo;
-    animationFile[0].aniListOffset = animationListNo;
-    animationFile[0].cbListOffset = collisionBoxNo;
+    animationFileList[0].aniListOffset = animationListNo;
+    animationFileList[0].cbListOffset = collisionBoxNo;
 }
 void AnimationSystem_ProcessObjectAnimation(struct SpriteAnimation *animationRef, struct ObjectEntity *currentObject)
 {
@@ -212,31 +213,24 @@ void AnimationSystem_ProcessObjectAnimation(struct SpriteAnimation *animationRef
         currentObject->frame = animationRef->loopPosition;
     }
 }
+void AnimationSystem_UpdateSpriteQuads()
+{
+    for (int i = 0; i < 4096; i++)
+    {
+        GraphicsSystem_BuildSpriteQuads(&animationQuads[i << 2], &animationFrames[i], (int)animationFrames[i].surfaceNum);
+    }
+}
 void AnimationSystem_DrawObjectAnimation(struct SpriteAnimation *animationRef, struct ObjectEntity *currentObject, int xPos, int yPos)
 {
     switch (animationRef->rotationFlag)
     {
         case 0:
         {
-            struct SpriteFrame* spriteFrame = &animationFrames[animationRef->frameListOffset + (int)currentObject->frame];
-            switch (currentObject->direction)
+            if (currentObject->direction < 4)
             {
-                case 0:
-                    GraphicsSystem_DrawSpriteFlipped(xPos + spriteFrame->xPivot, yPos + spriteFrame->yPivot, spriteFrame->xSize, spriteFrame->ySize, spriteFrame->left, spriteFrame->top, (int)currentObject->direction, (int)spriteFrame->surfaceNum);
-                    return;
-                case 1:
-                    GraphicsSystem_DrawSpriteFlipped(xPos - spriteFrame->xSize - spriteFrame->xPivot, yPos + spriteFrame->yPivot, spriteFrame->xSize, spriteFrame->ySize, spriteFrame->left, spriteFrame->top, (int)currentObject->direction, (int)spriteFrame->surfaceNum);
-                    return;
-                case 2:
-                    GraphicsSystem_DrawSpriteFlipped(xPos + spriteFrame->xPivot, yPos - spriteFrame->ySize - spriteFrame->yPivot, spriteFrame->xSize, spriteFrame->ySize, spriteFrame->left, spriteFrame->top, (int)currentObject->direction, (int)spriteFrame->surfaceNum);
-                    return;
-                case 3:
-                    GraphicsSystem_DrawSpriteFlipped(xPos - spriteFrame->xSize - spriteFrame->xPivot, yPos - spriteFrame->ySize - spriteFrame->yPivot, spriteFrame->xSize, spriteFrame->ySize, spriteFrame->left, spriteFrame->top, (int)currentObject->direction, (int)spriteFrame->surfaceNum);
-                    return;
-                default:
-                    return;
+                GraphicsSystem_DrawSpriteQuad(&animationQuads[((animationRef->frameListOffset + (int)currentObject->frame) << 2) + currentObject->direction], xPos, yPos);
             }
-            break;
+            return;
         }
         case 1:
         {
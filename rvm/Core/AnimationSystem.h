@@ -15,15 +15,13 @@
 #include "GraphicsSystem.h"
 #include "FileData.h"
 #include "FileIO.h"
+#include "EngineContext.h"
 
-extern struct SpriteFrame animationFrames[4096];
-extern int animationFramesNo;
-extern struct SpriteAnimation animationList[1024];
-extern int animationListNo;
-extern struct AnimationFileList animationFile[256];
-extern int animationFileNo;
-extern struct CollisionBox collisionBoxList[32];
-extern int collisionBoxNo;
+extern ENGINE_STATE int animationFramesNo;
+extern ENGINE_STATE int animationListNo;
+extern ENGINE_STATE int animationFileNo;
+extern ENGINE_STATE int collisionBoxNo;
+extern ENGINE_STATE int animationDataVersion;
 
 void Init_AnimationSystem(void);
 void AnimationSystem_LoadAnimationFile(char* filePath);
@@ -31,6 +29,7 @@ struct AnimationFileList* AnimationSystem_AddAnimationFile(char* fileName);
 struct AnimationFileList* AnimationSystem_GetDefaultAnimationRef(void);
 void AnimationSystem_ClearAnimationData(void);
 void AnimationSystem_ProcessObjectAnimation(struct SpriteAnimation *animationRef, struct ObjectEntity *currentObject);
+void AnimationSystem_UpdateSpriteQuads(void);
 void AnimationSystem_DrawObjectAnimation(struct SpriteAnimation *animationRef, struct ObjectEntity *currentObject, int xPos, int yPos);
 
 #endif /* AnimationSystem_h */
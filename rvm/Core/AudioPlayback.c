@@ -4,26 +4,50 @@
 //
 
 #include "AudioPlayback.h"
+#include "EngineBuffers.h"
 
 const int MUSIC_STOPPED = 0;
 const int MUSIC_PLAYING = 1;
 const int MUSIC_PAUSED = 2;
 const int MUSIC_LOADING = 3;
 const int MUSIC_READY = 4;
-#define NUM_CHANNELS 8
-int numGlobalSFX;
-int numStageSFX;
+#define SFX_COMMAND_PLAY 0
+#define SFX_COMMAND_STOP 1
+#define SFX_COMMAND_ATTRIBUTES 2
+#define SFX_COMMAND_STOP_ALL 3
+#define SFX_COMMAND_PAUSE 4
+#define SFX_COMMAND_RESUME 5
+#define SFX_COMMAND_VOLUME 6
+ENGINE_STATE int numGlobalSFX;
+ENGINE_STATE int numStageSFX;
 Mix_Chunk* sfxSamples[256];
 bool sfxLoaded[256];
-int channelSfxNum[NUM_CHANNELS];
-int nextChannelPos;
-bool musicEnabled;
-int musicVolume;
-float musicVolumeSetting;
-float sfxVolumeSetting;
-int musicStatus;
-int currentMusicTrack;
-struct MusicTrackInfo musicTracks[16];
+struct SfxVoice sfxVoices[NUM_SFX_VOICES];
+bool sfxMixerEnabled;
+int sfxMixerFrequency;
+SDL_atomic_t sfxMixCount;
+struct SfxSample sfxCache[SFX_CACHE_SIZE];
+int sfxSampleSlot[256];
+uint8_t* sfxBankData[SFX_CACHE_SIZE];
+int sfxBankRefs[SFX_CACHE_SIZE];
+uint32_t sfxCacheMemory;
+unsigned int sfxCacheTime;
+struct SfxLoadJob sfxLoadList[256];
+int sfxLoadListSize;
+SDL_atomic_t sfxLoadListPos;
+struct SfxCommand sfxCommands[SFX_QUEUE_SIZE];
+SDL_atomic_t sfxCommandWritePos;
+SDL_atomic_t sfxCommandReadPos;
+bool sfxPaused;
+int sfxMasterVolume;
+unsigned int sfxStartCount;
+int sfxMixBuffer[SFX_MIX_BLOCK * 2];
+ENGINE_STATE bool musicEnabled;
+ENGINE_STATE int musicVolume;
+ENGINE_STATE float musicVolumeSetting;
+ENGINE_STATE float sfxVolumeSetting;
+ENGINE_STATE int musicStatus;
+ENGINE_STATE int currentMusicTrack;
 
 void InitAudioPlayback()
 {
@@ -34,21 +58,66 @@ void InitAudioPlayback()
     musicVolumeSetting = 1.0f;
     sfxVolumeSetting = 1.0f;
     musicStatus = 0;
+    if (engineHeadless)
+    {
+        //The device and the sample cache belong to the windowed instance
+        return;
+    }
+    
+    sfxMixerEnabled = false;
+    sfxPaused = false;
+    sfxMasterVolume = 256;
+    sfxStartCount = 0;
+    SDL_AtomicSet(&sfxCommandWritePos, 0);
+    SDL_AtomicSet(&sfxCommandReadPos, 0);
+    for (int i = 0; i < NUM_SFX_VOICES; i++)
+    {
+        sfxVoices[i].chunk = NULL;
+        sfxVoices[i].sfxNum = -1;
+    }
+    SDL_AtomicSet(&sfxMixCount, 0);
+    for (int i = 0; i < SFX_CACHE_SIZE; i++)
+    {
+        sfxCache[i].filePath[0] = '\0';
+        sfxCache[i].bank = -1;
+        sfxCache[i].evictedAt = -1;
+        sfxBankData[i] = NULL;
+        sfxBankRefs[i] = 0;
+    }
+    for (int i = 0; i < 256; i++)
+    {
+        sfxSampleSlot[i] = -1;
+    }
+    sfxCacheMemory = 0;
+    sfxCacheTime = 0;
+    sfxLoadListSize = 0;
     
     //Init SDL_Mixer and Audio - Must be done before audio can be loaded.
-    if(Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 4096) == -1){
-        printf("Failed to open audio mixer!");
+    //SDL_Mixer only plays the music, sound effects are mixed in by AudioPlayback_MixSfx on the audio thread.
+    //The mixer writes 16 bit stereo, so only the rate may change and SDL converts for any other device.
+    if(Mix_OpenAudioDevice(44100, MIX_DEFAULT_FORMAT, 2, AUDIO_BUFFER_SIZE, NULL, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE) == -1){
+        printf("Failed to open audio mixer!\n");
     }
     else{
-        Mix_AllocateChannels(MIX_CHANNELS);
+        int frequency;
+        Uint16 format;
+        int channels;
+        Mix_AllocateChannels(0);
+        Mix_QuerySpec(&frequency, &format, &channels);
+        if (format == AUDIO_S16SYS && channels == 2)
+        {
+            sfxMixerEnabled = true;
+            sfxMixerFrequency = frequency;
+            Mix_SetPostMix(AudioPlayback_MixSfx, NULL);
+        }
+        else
+        {
+            printf("Unsupported audio format, sound effects are disabled!\n");
+        }
     }
     
     struct FileData fileData;
     char array[32];
-    for (int i = 0; i < 8; i++)
-    {
-        channelSfxNum[i] = -1;
-    }
     if (FileIO_LoadFile("Data/Game/GameConfig.bin", &fileData))
     {
         uint8_t b = FileIO_ReadByte();
@@ -112,15 +181,18 @@ void InitAudioPlayback()
                 array[i] = (char)b2;
             }
             array[i] = '\0';
-            FileIO_GetFileInfo(&fileData);
-            FileIO_CloseFile();
-            AudioPlayback_LoadSfx(array, j);
-            FileIO_SetFileInfo(&fileData);
+            AudioPlayback_AddSfxToLoadList(array, j);
         }
+        FileIO_CloseFile();
+        AudioPlayback_LoadSfxList();
     }
 }
 void AudioPlayback_ReleaseAudioPlayback()
 {
+    if (engineHeadless)
+    {
+        return;
+    }
     Mix_CloseAudio();
 }
 void AudioPlayback_ReleaseGlobalSFX()
@@ -134,33 +206,32 @@ void AudioPlayback_SetGameVolumes(int bgmVolume, int sfxVolume)
     musicVolumeSetting = (float)bgmVolume * 0.01f;
     AudioPlayback_SetMusicVolume(musicVolume);
     sfxVolumeSetting = (float)sfxVolume * 0.01f;
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_VOLUME, -1, 0, 0, 0, (int)(sfxVolumeSetting * 256.0f));
 }
 void AudioPlayback_StopAllSFX()
 {
-    for (int i = 0; i < NUM_CHANNELS; i++)
-    {
-        Mix_HaltChannel(i);
-    }
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_STOP_ALL, -1, 0, 0, 0, 0);
 }
 void AudioPlayback_PauseSound()
 {
-    Mix_PauseMusic();
-    for (int i = 0; i < NUM_CHANNELS; i++)
+    if (engineHeadless)
     {
-        Mix_Pause(i);
+        return;
     }
+    Mix_PauseMusic();
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_PAUSE, -1, 0, 0, 0, 0);
 }
 void AudioPlayback_ResumeSound()
 {
-    Mix_ResumeMusic();
-    for (int i = 0; i < NUM_CHANNELS; i++)
+    if (engineHeadless)
     {
-        Mix_Resume(i);
+        return;
     }
+    Mix_ResumeMusic();
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_RESUME, -1, 0, 0, 0, 0);
 }
 void AudioPlayback_SetMusicTrack(char* fileName, int trackNo, uint8_t loopTrack, uint32_t loopPoint)
 {
-    struct FileData fData;
     char array[] = "Data/Music/";
     int num = (int)strlen(fileName);
     if (num < 0)
@@ -171,8 +242,9 @@ void AudioPlayback_SetMusicTrack(char* fileName, int trackNo, uint8_t loopTrack,
     {
         fileName[num] = '\0';
     }
-    FileIO_StrCopy(musicTracks[trackNo].trackName, sizeof(musicTracks[trackNo].trackName), array, sizeof(array));
-    FileIO_StrAdd(musicTracks[trackNo].trackName, sizeof(musicTracks[trackNo].trackName), fileName, (int)strlen(fileName));
+    char trackName[64];
+    FileIO_StrCopy(trackName, sizeof(trackName), array, sizeof(array));
+    FileIO_StrAdd(trackName, sizeof(trackName), fileName, (int)strlen(fileName));
     if (loopTrack == 1)
     {
         musicTracks[trackNo].loop = true;
@@ -181,25 +253,25 @@ void AudioPlayback_SetMusicTrack(char* fileName, int trackNo, uint8_t loopTrack,
     {
         musicTracks[trackNo].loop = false;
     }
+    bool sameLoopPoint = musicTracks[trackNo].loopPoint == loopPoint;
     musicTracks[trackNo].loopPoint = loopPoint;
+    if (num > 0 && musicTracks[trackNo].mixerAudio && sameLoopPoint && strcmp(musicTracks[trackNo].trackName, trackName) == 0)
+    {
+        return; //Already loaded, e.g. when a restarted stage sets up its tracks again.
+    }
+    FileIO_StrCopy(musicTracks[trackNo].trackName, sizeof(musicTracks[trackNo].trackName), trackName, sizeof(trackName));
     if(musicTracks[trackNo].mixerAudio){
         Mix_FreeMusic(musicTracks[trackNo].mixerAudio);
         musicTracks[trackNo].mixerAudio = NULL;
     }
-    if(musicTracks[trackNo].musicData){
-        free(musicTracks[trackNo].musicData);
-        musicTracks[trackNo].musicData = NULL;
-    }
-    if(num == 0){
+    if(num == 0 || engineHeadless){
         return; //We just wanted to clear the audio track entry by replacing it with a blank one.
     }
-    else if (FileIO_LoadFile(musicTracks[trackNo].trackName, &fData))
+    //Streamed from disk as it plays rather than buffered whole; the loop point is passed to SDL Mixer as a LOOPSTART tag.
+    SDL_RWops* musicStream = AudioPlayback_OpenMusicStream(musicTracks[trackNo].trackName, loopPoint);
+    if (musicStream != NULL)
     {
-        //Todo: Use the loop point - SDL Mixer will use OGG Loop tags, maybe we can just inject those in memory.
-        musicTracks[trackNo].musicData = malloc(fData.fileSize);
-        FileIO_ReadByteArray(musicTracks[trackNo].musicData, fData.fileSize);
-        musicTracks[trackNo].mixerAudio = Mix_LoadMUSType_RW(SDL_RWFromMem(musicTracks[trackNo].musicData, fData.fileSize), MUS_OGG, SDL_TRUE);
-        FileIO_CloseFile();
+        musicTracks[trackNo].mixerAudio = Mix_LoadMUSType_RW(musicStream, MUS_OGG, SDL_TRUE);
     }
 }
 void AudioPlayback_SetMusicVolume(int volume)
@@ -213,16 +285,24 @@ void AudioPlayback_SetMusicVolume(int volume)
         volume = 100;
     }
     musicVolume = volume;
-    double sdl_volume = 128.0 * (musicVolume / 100.0);
-    Mix_VolumeMusic((int)sdl_volume);
+    if (!engineHeadless)
+    {
+        double sdl_volume = 128.0 * (musicVolume / 100.0);
+        Mix_VolumeMusic((int)sdl_volume);
+    }
 }
 void AudioPlayback_PlayMusic(int trackNo)
 {
-    if (musicTracks[trackNo].trackName[0] != '\0' && musicTracks[trackNo].mixerAudio)
+    //A headless instance never loads the track, but keeps the state scripts read in step
+    if (musicTracks[trackNo].trackName[0] != '\0' && (musicTracks[trackNo].mixerAudio || engineHeadless))
     {
         currentMusicTrack = trackNo;
         musicVolume = 100;
         musicStatus = 1;
+        if (engineHeadless)
+        {
+            return;
+        }
         double sdl_volume = 128.0 * (musicVolume / 100.0);
         Mix_VolumeMusic((int)sdl_volume);
         Mix_PlayMusic(musicTracks[trackNo].mixerAudio, (musicTracks[trackNo].loop > 0) ? -1 : 0);
@@ -236,84 +316,786 @@ void AudioPlayback_StopMusic()
     }
     musicStatus = 0;
 }
-void AudioPlayback_LoadSfx(char* fileName, int sfxNum)
+void AudioPlayback_AddSfxToLoadList(char* fileName, int sfxNum)
 {
-    struct FileData fData;
-    char filePath[64];
     char array[] = "Data/SoundFX/";
-    if (sfxNum > -1 && sfxNum < 256)
+    if (!engineHeadless && sfxNum > -1 && sfxNum < 256 && sfxLoadListSize < 256)
+    {
+        struct SfxLoadJob* job = &sfxLoadList[sfxLoadListSize++];
+        FileIO_StrCopy(job->filePath, sizeof(job->filePath), array, sizeof(array));
+        FileIO_StrAdd(job->filePath, sizeof(job->filePath), fileName, (int)strlen(fileName));
+        job->sfxNum = sfxNum;
+    }
+}
+void AudioPlayback_LoadSfxList()
+{
+    if (engineHeadless)
+    {
+        return;
+    }
+    if (!sfxMixerEnabled)
+    {
+        sfxLoadListSize = 0;
+        return; //Nothing would play them.
+    }
+    sfxCacheTime++;
+    int numDecodes = 0;
+    for (int i = 0; i < sfxLoadListSize; i++)
+    {
+        struct SfxLoadJob* job = &sfxLoadList[i];
+        job->cacheSlot = -1;
+        job->opened = false;
+        job->data = NULL;
+        job->length = 0;
+        //Sounds shared with the last stage or another time period are already decoded
+        for (int s = 0; s < SFX_CACHE_SIZE; s++)
+        {
+            if (sfxCache[s].bank > -1 && strcmp(sfxCache[s].filePath, job->filePath) == 0)
+            {
+                job->cacheSlot = s;
+                sfxCache[s].lastUsed = sfxCacheTime;
+                break;
+            }
+        }
+        if (job->cacheSlot < 0)
+        {
+            //Files are looked up here since FileIO isn't thread safe, the workers open their own handles.
+            job->opened = FileIO_FindFileStream(job->filePath, &job->stream);
+            if (job->opened)
+            {
+                numDecodes++;
+            }
+        }
+    }
+
+    //Decode and convert to the mixer format on a few threads, the main thread takes jobs as well.
+    SDL_Thread* threads[SFX_LOAD_THREADS];
+    int numThreads = SDL_GetCPUCount() - 1;
+    if (numThreads > SFX_LOAD_THREADS)
+    {
+        numThreads = SFX_LOAD_THREADS;
+    }
+    if (numThreads > numDecodes - 1)
+    {
+        numThreads = numDecodes - 1;
+    }
+    SDL_AtomicSet(&sfxLoadListPos, 0);
+    for (int i = 0; i < numThreads; i++)
+    {
+        threads[i] = SDL_CreateThread(AudioPlayback_SfxLoadWorker, "SfxLoad", NULL);
+    }
+    AudioPlayback_SfxLoadWorker(NULL);
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (threads[i] != NULL)
+        {
+            SDL_WaitThread(threads[i], NULL);
+        }
+    }
+
+    //Anything SDL can't load as a WAV goes through SDL Mixer's own loaders
+    uint32_t bankSize = 0;
+    for (int i = 0; i < sfxLoadListSize; i++)
     {
-        FileIO_StrCopy(filePath, sizeof(filePath), array, sizeof(array));
-        FileIO_StrAdd(filePath, sizeof(filePath), fileName, (int)strlen(fileName));
-        if (FileIO_LoadFile(filePath, &fData))
+        struct SfxLoadJob* job = &sfxLoadList[i];
+        struct FileData fData;
+        if (job->opened && job->data == NULL && FileIO_LoadFile(job->filePath, &fData))
         {
             uint8_t* sampleData = malloc(fData.fileSize);
             FileIO_ReadByteArray(sampleData, fData.fileSize);
-            if (sfxLoaded[sfxNum])
+            FileIO_CloseFile();
+            Mix_Chunk* sample = Mix_LoadWAV_RW(SDL_RWFromMem(sampleData, fData.fileSize), SDL_TRUE);
+            free(sampleData);
+            if (sample != NULL)
             {
-                Mix_FreeChunk(sfxSamples[sfxNum]);
-                sfxLoaded[sfxNum] = false;
+                job->length = sample->alen & ~3u;
+                job->data = malloc(job->length);
+                memcpy(job->data, sample->abuf, job->length);
+                Mix_FreeChunk(sample);
             }
-            sfxSamples[sfxNum] = Mix_LoadWAV_RW(SDL_RWFromMem(sampleData, fData.fileSize), SDL_TRUE);
 #if DEBUG
-            if(!sfxSamples[sfxNum]) {
+            else
+            {
                 printf("Mix_LoadWAV_RW: %s\n", Mix_GetError());
             }
 #endif
-            sfxLoaded[sfxNum] = true;
-            FileIO_CloseFile();
         }
+        if (job->data != NULL)
+        {
+            bankSize += job->length;
+        }
+    }
+
+    //The new samples share one allocation, freed once none of them are cached anymore
+    int bank = -1;
+    uint32_t bankPos = 0;
+    for (int i = 0; i < SFX_CACHE_SIZE && bank < 0 && bankSize > 0; i++)
+    {
+        if (sfxBankData[i] == NULL)
+        {
+            bank = i;
+        }
+    }
+    if (bank > -1)
+    {
+        sfxBankData[bank] = malloc(bankSize);
+        sfxBankRefs[bank] = 0;
+        if (sfxBankData[bank] == NULL)
+        {
+            bank = -1;
+        }
+    }
+    for (int i = 0; i < sfxLoadListSize; i++)
+    {
+        struct SfxLoadJob* job = &sfxLoadList[i];
+        if (job->data == NULL)
+        {
+            continue;
+        }
+        int slot = bank > -1 ? AudioPlayback_GetSfxCacheSlot() : -1;
+        if (slot > -1)
+        {
+            struct SfxSample* cacheEntry = &sfxCache[slot];
+            memcpy(&sfxBankData[bank][bankPos], job->data, job->length);
+            FileIO_StrCopy(cacheEntry->filePath, sizeof(cacheEntry->filePath), job->filePath, sizeof(job->filePath));
+            cacheEntry->chunk.allocated = 0;
+            cacheEntry->chunk.abuf = &sfxBankData[bank][bankPos];
+            cacheEntry->chunk.alen = job->length;
+            cacheEntry->chunk.volume = MIX_MAX_VOLUME;
+            cacheEntry->bank = bank;
+            cacheEntry->lastUsed = sfxCacheTime;
+            sfxBankRefs[bank]++;
+            sfxCacheMemory += job->length;
+            bankPos += job->length;
+            job->cacheSlot = slot;
+        }
+        free(job->data);
+        job->data = NULL;
+    }
+    if (bank > -1 && sfxBankRefs[bank] == 0)
+    {
+        free(sfxBankData[bank]);
+        sfxBankData[bank] = NULL;
+    }
+
+    for (int i = 0; i < sfxLoadListSize; i++)
+    {
+        struct SfxLoadJob* job = &sfxLoadList[i];
+        if (job->cacheSlot > -1)
+        {
+            SDL_AtomicSetPtr((void**)&sfxSamples[job->sfxNum], &sfxCache[job->cacheSlot].chunk);
+            sfxLoaded[job->sfxNum] = true;
+        }
+        else
+        {
+            SDL_AtomicSetPtr((void**)&sfxSamples[job->sfxNum], NULL);
+            sfxLoaded[job->sfxNum] = false;
+        }
+        sfxSampleSlot[job->sfxNum] = job->cacheSlot;
     }
+    sfxLoadListSize = 0;
+    AudioPlayback_TrimSfxCache();
 }
-void AudioPlayback_PlaySfx(int sfxNum, uint8_t sLoop)
+int AudioPlayback_SfxLoadWorker(void* data)
 {
-    for (int i = 0; i < NUM_CHANNELS; i++)
+    int pos;
+    (void)data;
+    while ((pos = SDL_AtomicAdd(&sfxLoadListPos, 1)) < sfxLoadListSize)
     {
-        if (channelSfxNum[i] == sfxNum)
+        struct SfxLoadJob* job = &sfxLoadList[pos];
+        if (job->opened)
         {
-            Mix_HaltChannel(i);
-            nextChannelPos = i;
-            i = 8;
+            job->opened = FileIO_BeginFileStream(job->filePath, &job->stream);
+            if (job->opened)
+            {
+                AudioPlayback_DecodeSfx(job);
+            }
         }
     }
-    Mix_SetPanning(nextChannelPos, 255, 255);
-    Mix_PlayChannel(nextChannelPos, sfxSamples[sfxNum], (sLoop==1)?-1:0);
-    channelSfxNum[nextChannelPos] = sfxNum;
-    nextChannelPos++;
-    if (nextChannelPos == 8)
+    return 0;
+}
+void AudioPlayback_DecodeSfx(struct SfxLoadJob* job)
+{
+    SDL_AudioSpec spec;
+    Uint8* wavData;
+    Uint32 wavLength;
+    SDL_AudioCVT cvt;
+    uint8_t* fileData = malloc(job->stream.fileSize);
+    size_t fileSize = fileData != NULL ? FileIO_ReadFileStream(&job->stream, fileData, job->stream.fileSize) : 0;
+    FileIO_CloseFileStream(&job->stream);
+    if (fileSize > 0 && SDL_LoadWAV_RW(SDL_RWFromConstMem(fileData, (int)fileSize), 1, &spec, &wavData, &wavLength) != NULL)
     {
-        nextChannelPos = 0;
+        if (SDL_BuildAudioCVT(&cvt, spec.format, spec.channels, spec.freq, AUDIO_S16SYS, 2, sfxMixerFrequency) >= 0)
+        {
+            cvt.len = (int)wavLength;
+            cvt.buf = malloc(wavLength * cvt.len_mult);
+            if (cvt.buf != NULL)
+            {
+                memcpy(cvt.buf, wavData, wavLength);
+                if (SDL_ConvertAudio(&cvt) == 0)
+                {
+                    job->data = cvt.buf;
+                    job->length = (uint32_t)cvt.len_cvt & ~3u;
+                }
+                else
+                {
+                    free(cvt.buf);
+                }
+            }
+        }
+        SDL_FreeWAV(wavData);
     }
+    free(fileData);
 }
-void AudioPlayback_StopSfx(int sfxNum)
+int AudioPlayback_GetSfxCacheSlot()
 {
-    for (int i = 0; i < NUM_CHANNELS; i++)
+    //An evicted entry may still be on a voice until the mixer has run once since
+    int mixCount = SDL_AtomicGet(&sfxMixCount);
+    for (int i = 0; i < SFX_CACHE_SIZE; i++)
     {
-        if (channelSfxNum[i] == sfxNum)
+        if (sfxCache[i].bank < 0 && sfxCache[i].evictedAt != mixCount)
         {
-            channelSfxNum[i] = -1;
-            Mix_HaltChannel(i);
+            return i;
         }
     }
+    return -1;
 }
-void AudioPlayback_SetSfxAttributes(int sfxNum, int volume, int pan)
+void AudioPlayback_TrimSfxCache()
 {
-    for (int i = 0; i < NUM_CHANNELS; i++)
+    bool referenced[SFX_CACHE_SIZE];
+    int numEntries = 0;
+    bool waited = false;
+    memset(referenced, 0, sizeof(referenced));
+    for (int i = 0; i < 256; i++)
+    {
+        if (sfxSampleSlot[i] > -1)
+        {
+            referenced[sfxSampleSlot[i]] = true;
+        }
+    }
+    for (int i = 0; i < SFX_CACHE_SIZE; i++)
+    {
+        if (sfxCache[i].bank > -1)
+        {
+            numEntries++;
+        }
+    }
+    //Leave room for a full table of new sounds next time
+    while (sfxCacheMemory > SFX_CACHE_MEMORY || numEntries > SFX_CACHE_SIZE - 256)
     {
-        if (channelSfxNum[i] == sfxNum)
+        int oldest = -1;
+        for (int i = 0; i < SFX_CACHE_SIZE; i++)
         {
-            Mix_HaltChannel(i);
-            nextChannelPos = i;
-            i = 8;
+            if (sfxCache[i].bank > -1 && !referenced[i] && (oldest < 0 || sfxCacheTime - sfxCache[i].lastUsed > sfxCacheTime - sfxCache[oldest].lastUsed))
+            {
+                oldest = i;
+            }
+        }
+        if (oldest < 0)
+        {
+            break;
+        }
+        if (!waited)
+        {
+            //Setting the post mix callback waits for a mix in progress, after which no voice
+            //can start on a sample the table doesn't point to.
+            Mix_SetPostMix(AudioPlayback_MixSfx, NULL);
+            waited = true;
+        }
+        struct SfxSample* cacheEntry = &sfxCache[oldest];
+        sfxCacheMemory -= cacheEntry->chunk.alen;
+        sfxBankRefs[cacheEntry->bank]--;
+        if (sfxBankRefs[cacheEntry->bank] == 0)
+        {
+            free(sfxBankData[cacheEntry->bank]);
+            sfxBankData[cacheEntry->bank] = NULL;
         }
+        cacheEntry->filePath[0] = '\0';
+        cacheEntry->bank = -1;
+        cacheEntry->evictedAt = SDL_AtomicGet(&sfxMixCount);
+        numEntries--;
     }
+}
+void AudioPlayback_PlaySfx(int sfxNum, uint8_t sLoop)
+{
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_PLAY, sfxNum, (sLoop == 1) ? 1 : 0, 255, 255, 0);
+}
+void AudioPlayback_StopSfx(int sfxNum)
+{
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_STOP, sfxNum, 0, 0, 0, 0);
+}
+void AudioPlayback_SetSfxAttributes(int sfxNum, int volume, int pan)
+{
+    //Changes the pan of the playing sound in place, or starts it if it isn't playing.
     uint8_t sdlPan = (pan*255)/100;
-    Mix_SetPanning(nextChannelPos, sdlPan, 255-sdlPan);
-    Mix_PlayChannel(nextChannelPos, sfxSamples[sfxNum], 0);
-    channelSfxNum[nextChannelPos] = sfxNum;
-    nextChannelPos++;
-    if (nextChannelPos == 8)
+    AudioPlayback_PushSfxCommand(SFX_COMMAND_ATTRIBUTES, sfxNum, 0, sdlPan, 255-sdlPan, volume);
+}
+bool AudioPlayback_PushSfxCommand(uint8_t type, int sfxNum, uint8_t loop, uint8_t panL, uint8_t panR, int volume)
+{
+    //Single producer (the game thread), single consumer (the audio thread), so a full queue just drops the command.
+    int writePos = SDL_AtomicGet(&sfxCommandWritePos);
+    if (engineHeadless || !sfxMixerEnabled || writePos - SDL_AtomicGet(&sfxCommandReadPos) >= SFX_QUEUE_SIZE)
+    {
+        return false;
+    }
+    struct SfxCommand* command = &sfxCommands[writePos & (SFX_QUEUE_SIZE - 1)];
+    command->type = type;
+    command->loop = loop;
+    command->panL = panL;
+    command->panR = panR;
+    command->sfxNum = (short)sfxNum;
+    command->volume = (short)volume;
+    SDL_AtomicSet(&sfxCommandWritePos, writePos + 1);
+    return true;
+}
+void AudioPlayback_StartSfxVoice(struct SfxCommand* command)
+{
+    struct SfxVoice* voice = NULL;
+    Mix_Chunk* sample = (command->sfxNum >= 0 && command->sfxNum < 256) ? (Mix_Chunk*)SDL_AtomicGetPtr((void**)&sfxSamples[command->sfxNum]) : NULL;
+    if (sample == NULL || sample->alen < 4)
+    {
+        return;
+    }
+    //A sound that is already playing restarts on its own voice, otherwise take a free one,
+    //otherwise steal the oldest one-shot before touching any looping sound.
+    for (int i = 0; i < NUM_SFX_VOICES && voice == NULL; i++)
+    {
+        if (sfxVoices[i].chunk != NULL && sfxVoices[i].sfxNum == command->sfxNum)
+        {
+            voice = &sfxVoices[i];
+        }
+    }
+    for (int i = 0; i < NUM_SFX_VOICES && voice == NULL; i++)
+    {
+        if (sfxVoices[i].chunk == NULL)
+        {
+            voice = &sfxVoices[i];
+        }
+    }
+    if (voice == NULL)
+    {
+        voice = &sfxVoices[0];
+        for (int i = 1; i < NUM_SFX_VOICES; i++)
+        {
+            if (sfxVoices[i].priority < voice->priority || (sfxVoices[i].priority == voice->priority && sfxStartCount - sfxVoices[i].startTime > sfxStartCount - voice->startTime))
+            {
+                voice = &sfxVoices[i];
+            }
+        }
+    }
+    voice->chunk = sample;
+    voice->length = sample->alen >> 2;
+    voice->position = 0;
+    voice->sfxNum = command->sfxNum;
+    voice->loop = command->loop;
+    voice->priority = command->loop;
+    voice->panL = command->panL;
+    voice->panR = command->panR;
+    voice->gainL = voice->panL * sfxMasterVolume / 255;
+    voice->gainR = voice->panR * sfxMasterVolume / 255;
+    voice->startTime = sfxStartCount++;
+}
+void AudioPlayback_MixSfx(void* udata, Uint8* stream, int len)
+{
+    (void)udata;
+    Sint16* output = (Sint16*)stream;
+    int frames = len >> 2;
+    int readPos = SDL_AtomicGet(&sfxCommandReadPos);
+    int writePos = SDL_AtomicGet(&sfxCommandWritePos);
+    while (readPos != writePos)
+    {
+        struct SfxCommand* command = &sfxCommands[readPos & (SFX_QUEUE_SIZE - 1)];
+        switch (command->type)
+        {
+            case SFX_COMMAND_PLAY:
+                AudioPlayback_StartSfxVoice(command);
+                break;
+            case SFX_COMMAND_ATTRIBUTES:
+            {
+                bool playing = false;
+                for (int i = 0; i < NUM_SFX_VOICES; i++)
+                {
+                    if (sfxVoices[i].chunk != NULL && sfxVoices[i].sfxNum == command->sfxNum)
+                    {
+                        sfxVoices[i].panL = command->panL;
+                        sfxVoices[i].panR = command->panR;
+                        sfxVoices[i].gainL = sfxVoices[i].panL * sfxMasterVolume / 255;
+                        sfxVoices[i].gainR = sfxVoices[i].panR * sfxMasterVolume / 255;
+                        playing = true;
+                    }
+                }
+                if (!playing)
+                {
+                    AudioPlayback_StartSfxVoice(command);
+                }
+                break;
+            }
+            case SFX_COMMAND_STOP:
+                for (int i = 0; i < NUM_SFX_VOICES; i++)
+                {
+                    if (sfxVoices[i].sfxNum == command->sfxNum)
+                    {
+                        sfxVoices[i].chunk = NULL;
+                    }
+                }
+                break;
+            case SFX_COMMAND_STOP_ALL:
+                for (int i = 0; i < NUM_SFX_VOICES; i++)
+                {
+                    sfxVoices[i].chunk = NULL;
+                }
+                break;
+            case SFX_COMMAND_PAUSE:
+                sfxPaused = true;
+                break;
+            case SFX_COMMAND_RESUME:
+                sfxPaused = false;
+                break;
+            case SFX_COMMAND_VOLUME:
+                sfxMasterVolume = command->volume;
+                for (int i = 0; i < NUM_SFX_VOICES; i++)
+                {
+                    sfxVoices[i].gainL = sfxVoices[i].panL * sfxMasterVolume / 255;
+                    sfxVoices[i].gainR = sfxVoices[i].panR * sfxMasterVolume / 255;
+                }
+                break;
+        }
+        readPos++;
+    }
+    SDL_AtomicSet(&sfxCommandReadPos, readPos);
+    for (int i = 0; i < NUM_SFX_VOICES; i++)
+    {
+        //The sample was replaced or released since this voice started
+        if (sfxVoices[i].chunk != NULL && sfxVoices[i].chunk != SDL_AtomicGetPtr((void**)&sfxSamples[sfxVoices[i].sfxNum]))
+        {
+            sfxVoices[i].chunk = NULL;
+        }
+    }
+    SDL_AtomicAdd(&sfxMixCount, 1);
+    if (sfxPaused)
+    {
+        return;
+    }
+    while (frames > 0)
+    {
+        int blockSize = frames < SFX_MIX_BLOCK ? frames : SFX_MIX_BLOCK;
+        memset(sfxMixBuffer, 0, sizeof(int) * (blockSize << 1));
+        for (int v = 0; v < NUM_SFX_VOICES; v++)
+        {
+            struct SfxVoice* voice = &sfxVoices[v];
+            int mixPos = 0;
+            while (voice->chunk != NULL && mixPos < blockSize)
+            {
+                int count = voice->length - voice->position;
+                if (count > blockSize - mixPos)
+                {
+                    count = blockSize - mixPos;
+                }
+                //Plain loops over 32 bit accumulators so the compiler can vectorise them
+                const Sint16* src = (const Sint16*)voice->chunk->abuf + (voice->position << 1);
+                int* dst = &sfxMixBuffer[mixPos << 1];
+                int gainL = voice->gainL;
+                int gainR = voice->gainR;
+                for (int i = 0; i < count; i++)
+                {
+                    dst[i << 1] += src[i << 1] * gainL;
+                    dst[(i << 1) + 1] += src[(i << 1) + 1] * gainR;
+                }
+                mixPos += count;
+                voice->position += count;
+                if (voice->position >= voice->length)
+                {
+                    voice->position = 0;
+                    if (!voice->loop)
+                    {
+                        voice->chunk = NULL;
+                    }
+                }
+            }
+        }
+        for (int i = 0; i < (blockSize << 1); i++)
+        {
+            int sample = output[i] + (sfxMixBuffer[i] >> 8);
+            if (sample > 32767)
+            {
+                sample = 32767;
+            }
+            if (sample < -32768)
+            {
+                sample = -32768;
+            }
+            output[i] = (Sint16)sample;
+        }
+        output += blockSize << 1;
+        frames -= blockSize;
+    }
+}
+SDL_RWops* AudioPlayback_OpenMusicStream(char* filePath, uint32_t loopPoint)
+{
+    struct MusicStream* stream = malloc(sizeof(struct MusicStream));
+    if (stream == NULL)
+    {
+        return NULL;
+    }
+    if (!FileIO_OpenFileStream(filePath, &stream->file))
+    {
+        FileIO_CloseFileStream(&stream->file);
+        free(stream);
+        return NULL;
+    }
+    stream->commentPage = NULL;
+    stream->commentPageStart = 0u;
+    stream->commentPageLength = 0u;
+    stream->commentPageDelta = 0;
+    stream->size = stream->file.fileSize;
+    stream->position = 0u;
+    if (loopPoint > 0u)
+    {
+        AudioPlayback_InjectLoopPoint(stream, loopPoint);
+    }
+    SDL_RWops* ops = SDL_AllocRW();
+    if (ops == NULL)
+    {
+        FileIO_CloseFileStream(&stream->file);
+        free(stream->commentPage);
+        free(stream);
+        return NULL;
+    }
+    ops->size = AudioPlayback_MusicStreamSize;
+    ops->seek = AudioPlayback_MusicStreamSeek;
+    ops->read = AudioPlayback_MusicStreamRead;
+    ops->write = AudioPlayback_MusicStreamWrite;
+    ops->close = AudioPlayback_MusicStreamClose;
+    ops->type = SDL_RWOPS_UNKNOWN;
+    ops->hidden.unknown.data1 = stream;
+    return ops;
+}
+bool AudioPlayback_InjectLoopPoint(struct MusicStream* stream, uint32_t loopPoint)
+{
+    //SDL Mixer loops OGG tracks from a LOOPSTART comment, so the loop point is added to the
+    //comment header page as it's streamed in. Page 1 only holds the identification header.
+    uint8_t header[27 + 255];
+    if (FileIO_ReadFileStream(&stream->file, header, 27) != 27 || memcmp(header, "OggS", 4) != 0)
+    {
+        return false;
+    }
+    uint32_t pageStart = 27 + header[26];
+    if (FileIO_ReadFileStream(&stream->file, &header[27], header[26]) != header[26])
+    {
+        return false;
+    }
+    for (int i = 0; i < header[26]; i++)
+    {
+        pageStart += header[27 + i];
+    }
+    FileIO_SeekFileStream(&stream->file, pageStart);
+    if (FileIO_ReadFileStream(&stream->file, header, 27) != 27 || memcmp(header, "OggS", 4) != 0)
+    {
+        return false;
+    }
+    int numSegments = header[26];
+    if (FileIO_ReadFileStream(&stream->file, &header[27], numSegments) != (size_t)numSegments)
+    {
+        return false;
+    }
+    //The comment packet comes first and has to end on this page.
+    uint32_t bodyLength = 0;
+    uint32_t packetLength = 0;
+    int packetSegments = -1;
+    for (int i = 0; i < numSegments; i++)
+    {
+        bodyLength += header[27 + i];
+        if (packetSegments < 0)
+        {
+            packetLength += header[27 + i];
+            if (header[27 + i] < 255)
+            {
+                packetSegments = i + 1;
+            }
+        }
+    }
+    if (packetSegments < 0 || packetLength < 16)
+    {
+        return false;
+    }
+    char comment[32];
+    uint32_t commentLength = (uint32_t)snprintf(comment, sizeof(comment), "LOOPSTART=%u", loopPoint);
+    uint32_t newPacketLength = packetLength + 4 + commentLength;
+    int newPacketSegments = (int)(newPacketLength / 255) + 1;
+    int newNumSegments = numSegments - packetSegments + newPacketSegments;
+    if (newNumSegments > 255)
+    {
+        return false;
+    }
+    uint8_t* body = malloc(bodyLength);
+    uint32_t newPageLength = 27 + newNumSegments + bodyLength + 4 + commentLength;
+    uint8_t* page = malloc(newPageLength);
+    if (body == NULL || page == NULL || FileIO_ReadFileStream(&stream->file, body, bodyLength) != bodyLength
+        || body[0] != 3 || memcmp(&body[1], "vorbis", 6) != 0)
+    {
+        free(body);
+        free(page);
+        return false;
+    }
+    uint32_t vendorLength = body[7] + (body[8] << 8) + (body[9] << 16) + ((uint32_t)body[10] << 24);
+    uint32_t countPos = 11 + vendorLength;
+    if (vendorLength > packetLength || countPos + 4 >= packetLength)
+    {
+        free(body);
+        free(page);
+        return false;
+    }
+    uint32_t numComments = body[countPos] + (body[countPos + 1] << 8) + (body[countPos + 2] << 16) + ((uint32_t)body[countPos + 3] << 24) + 1;
+    body[countPos] = (uint8_t)numComments;
+    body[countPos + 1] = (uint8_t)(numComments >> 8);
+    body[countPos + 2] = (uint8_t)(numComments >> 16);
+    body[countPos + 3] = (uint8_t)(numComments >> 24);
+
+    memcpy(page, header, 26);
+    page[26] = (uint8_t)newNumSegments;
+    uint8_t* lacing = &page[27];
+    for (int i = 0; i < newPacketSegments - 1; i++)
+    {
+        *lacing++ = 255;
+    }
+    *lacing++ = (uint8_t)(newPacketLength % 255);
+    memcpy(lacing, &header[27 + packetSegments], numSegments - packetSegments);
+    uint8_t* data = &page[27 + newNumSegments];
+    memcpy(data, body, packetLength - 1);
+    data += packetLength - 1;
+    *data++ = (uint8_t)commentLength;
+    *data++ = 0;
+    *data++ = 0;
+    *data++ = 0;
+    memcpy(data, comment, commentLength);
+    data += commentLength;
+    memcpy(data, &body[packetLength - 1], bodyLength - packetLength + 1);
+    free(body);
+
+    uint32_t crc = 0;
+    page[22] = page[23] = page[24] = page[25] = 0;
+    for (uint32_t i = 0; i < newPageLength; i++)
+    {
+        crc ^= (uint32_t)page[i] << 24;
+        for (int b = 0; b < 8; b++)
+        {
+            crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : crc << 1;
+        }
+    }
+    page[22] = (uint8_t)crc;
+    page[23] = (uint8_t)(crc >> 8);
+    page[24] = (uint8_t)(crc >> 16);
+    page[25] = (uint8_t)(crc >> 24);
+
+    stream->commentPage = page;
+    stream->commentPageStart = pageStart;
+    stream->commentPageLength = newPageLength;
+    stream->commentPageDelta = (int)newPageLength - (int)(27 + numSegments + bodyLength);
+    stream->size = (uint32_t)((int)stream->file.fileSize + stream->commentPageDelta);
+    return true;
+}
+Sint64 AudioPlayback_MusicStreamSize(SDL_RWops* context)
+{
+    struct MusicStream* stream = (struct MusicStream*)context->hidden.unknown.data1;
+    return stream->size;
+}
+Sint64 AudioPlayback_MusicStreamSeek(SDL_RWops* context, Sint64 offset, int whence)
+{
+    struct MusicStream* stream = (struct MusicStream*)context->hidden.unknown.data1;
+    Sint64 position = offset;
+    if (whence == RW_SEEK_CUR)
+    {
+        position += stream->position;
+    }
+    else if (whence == RW_SEEK_END)
+    {
+        position += stream->size;
+    }
+    if (position < 0)
+    {
+        return SDL_SetError("Seek before start of music stream");
+    }
+    if (position > stream->size)
+    {
+        position = stream->size;
+    }
+    stream->position = (uint32_t)position;
+    return position;
+}
+size_t AudioPlayback_MusicStreamRead(SDL_RWops* context, void* ptr, size_t size, size_t maxnum)
+{
+    struct MusicStream* stream = (struct MusicStream*)context->hidden.unknown.data1;
+    if (size == 0)
+    {
+        return 0;
+    }
+    size_t numBytes = size * maxnum;
+    if (numBytes > stream->size - stream->position)
+    {
+        numBytes = stream->size - stream->position;
+    }
+    uint8_t* dest = (uint8_t*)ptr;
+    size_t readBytes = 0;
+    while (readBytes < numBytes)
     {
-        nextChannelPos = 0;
+        size_t length = numBytes - readBytes;
+        if (stream->commentPage != NULL && stream->position >= stream->commentPageStart
+            && stream->position < stream->commentPageStart + stream->commentPageLength)
+        {
+            uint32_t pagePos = stream->position - stream->commentPageStart;
+            if (length > stream->commentPageLength - pagePos)
+            {
+                length = stream->commentPageLength - pagePos;
+            }
+            memcpy(&dest[readBytes], &stream->commentPage[pagePos], length);
+        }
+        else
+        {
+            uint32_t filePos = stream->position;
+            if (stream->commentPage != NULL)
+            {
+                if (stream->position < stream->commentPageStart)
+                {
+                    if (length > stream->commentPageStart - stream->position)
+                    {
+                        length = stream->commentPageStart - stream->position;
+                    }
+                }
+                else
+                {
+                    filePos = (uint32_t)((int)stream->position - stream->commentPageDelta);
+                }
+            }
+            if (stream->file.position != filePos)
+            {
+                FileIO_SeekFileStream(&stream->file, filePos);
+            }
+            length = FileIO_ReadFileStream(&stream->file, &dest[readBytes], length);
+            if (length == 0)
+            {
+                break;
+            }
+        }
+        readBytes += length;
+        stream->position += (uint32_t)length;
     }
+    return readBytes / size;
+}
+size_t AudioPlayback_MusicStreamWrite(SDL_RWops* context, const void* ptr, size_t size, size_t num)
+{
+    (void)context;
+    (void)ptr;
+    (void)size;
+    (void)num;
+    SDL_SetError("Music streams are read-only");
+    return 0;
+}
+int AudioPlayback_MusicStreamClose(SDL_RWops* context)
+{
+    struct MusicStream* stream = (struct MusicStream*)context->hidden.unknown.data1;
+    FileIO_CloseFileStream(&stream->file);
+    free(stream->commentPage);
+    free(stream);
+    SDL_FreeRW(context);
+    return 0;
 }
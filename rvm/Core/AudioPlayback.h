@@ -13,19 +13,42 @@
 #include "FileData.h"
 #include "FileIO.h"
 #include "SDL_mixer.h"
+#include "SfxVoice.h"
+#include "SfxCommand.h"
+#include "MusicStream.h"
+#include "SfxSample.h"
+#include "SfxLoadJob.h"
+#include "EngineContext.h"
 
-extern int numGlobalSFX;
-extern int numStageSFX;
+#ifdef __EMSCRIPTEN__
+#define AUDIO_BUFFER_SIZE 2048
+#else
+#define AUDIO_BUFFER_SIZE 512
+#endif
+#define NUM_SFX_VOICES 16
+#define SFX_QUEUE_SIZE 256
+#define SFX_MIX_BLOCK 256
+#define SFX_CACHE_SIZE 512
+#ifdef __EMSCRIPTEN__
+#define SFX_CACHE_MEMORY 0x800000
+#else
+#define SFX_CACHE_MEMORY 0x2000000
+#endif
+#define SFX_LOAD_THREADS 4
+
+extern ENGINE_STATE int numGlobalSFX;
+extern ENGINE_STATE int numStageSFX;
 extern bool sfxLoaded[256];
-extern int channelSfxNum[8];
-extern int nextChannelPos;
-extern bool musicEnabled;
-extern int musicVolume;
-extern float musicVolumeSetting;
-extern float sfxVolumeSetting;
-extern int musicStatus;
-extern int currentMusicTrack;
-extern struct MusicTrackInfo musicTracks[16];
+extern struct SfxVoice sfxVoices[NUM_SFX_VOICES];
+extern bool sfxMixerEnabled;
+extern struct SfxSample sfxCache[SFX_CACHE_SIZE];
+extern uint32_t sfxCacheMemory;
+extern ENGINE_STATE bool musicEnabled;
+extern ENGINE_STATE int musicVolume;
+extern ENGINE_STATE float musicVolumeSetting;
+extern ENGINE_STATE float sfxVolumeSetting;
+extern ENGINE_STATE int musicStatus;
+extern ENGINE_STATE int currentMusicTrack;
 
 void InitAudioPlayback(void);
 void AudioPlayback_ReleaseAudioPlayback(void);
@@ -39,9 +62,24 @@ void AudioPlayback_SetMusicTrack(char* fileName, int trackNo, uint8_t loopTrack,
 void AudioPlayback_SetMusicVolume(int volume);
 void AudioPlayback_PlayMusic(int trackNo);
 void AudioPlayback_StopMusic(void);
-void AudioPlayback_LoadSfx(char* fileName, int sfxNum);
+void AudioPlayback_AddSfxToLoadList(char* fileName, int sfxNum);
+void AudioPlayback_LoadSfxList(void);
+int AudioPlayback_SfxLoadWorker(void* data);
+void AudioPlayback_DecodeSfx(struct SfxLoadJob* job);
+int AudioPlayback_GetSfxCacheSlot(void);
+void AudioPlayback_TrimSfxCache(void);
 void AudioPlayback_PlaySfx(int sfxNum, uint8_t sLoop);
 void AudioPlayback_StopSfx(int sfxNum);
 void AudioPlayback_SetSfxAttributes(int sfxNum, int volume, int pan);
+void AudioPlayback_StartSfxVoice(struct SfxCommand* command);
+bool AudioPlayback_PushSfxCommand(uint8_t type, int sfxNum, uint8_t loop, uint8_t panL, uint8_t panR, int volume);
+void AudioPlayback_MixSfx(void* udata, Uint8* stream, int len);
+SDL_RWops* AudioPlayback_OpenMusicStream(char* filePath, uint32_t loopPoint);
+bool AudioPlayback_InjectLoopPoint(struct MusicStream* stream, uint32_t loopPoint);
+Sint64 AudioPlayback_MusicStreamSize(SDL_RWops* context);
+Sint64 AudioPlayback_MusicStreamSeek(SDL_RWops* context, Sint64 offset, int whence);
+size_t AudioPlayback_MusicStreamRead(SDL_RWops* context, void* ptr, size_t size, size_t maxnum);
+size_t AudioPlayback_MusicStreamWrite(SDL_RWops* context, const void* ptr, size_t size, size_t num);
+int AudioPlayback_MusicStreamClose(SDL_RWops* context);
 
 #endif /* AudioPlayback_h */
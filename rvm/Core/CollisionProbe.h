@@ -0,0 +1,18 @@
+//
+//  CollisionProbe.h
+//  rvm
+//
+
+#ifndef CollisionProbe_h
+#define CollisionProbe_h
+
+struct CollisionProbe {
+    int xPos;
+    int yPos;
+    int tile;
+    int cFlag;
+    int mask;
+    int angle;
+};
+
+#endif /* CollisionProbe_h */
@@ -0,0 +1,19 @@
+//
+//  CompiledScriptEntry.h
+//  rvm
+//
+
+#ifndef CompiledScriptEntry_h
+#define CompiledScriptEntry_h
+
+//Generated from one script body by rvm/Tools/ScriptCompiler.c. Returns 1 once the whole script has
+//finished and 0 when a function body returns to the code that called it.
+typedef int (*CompiledScript)(int scriptSub);
+
+struct CompiledScriptEntry {
+    int scriptCodePtr;
+    int jumpTablePtr;
+    CompiledScript function;
+};
+
+#endif /* CompiledScriptEntry_h */
@@ -0,0 +1,18 @@
+//
+//  CompiledScriptModule.h
+//  rvm
+//
+
+#ifndef CompiledScriptModule_h
+#define CompiledScriptModule_h
+
+#include "SDL.h"
+#include "CompiledScriptEntry.h"
+
+struct CompiledScriptModule {
+    uint64_t hash;
+    int numEntries;
+    const struct CompiledScriptEntry* entries;
+};
+
+#endif /* CompiledScriptModule_h */
@@ -0,0 +1,13 @@
+//
+//  CompiledScripts.c
+//  rvm
+//
+
+//Replaced by the output of rvm/Tools/ScriptCompiler.c when building with compiled scripts.
+//With no modules listed every script runs through the interpreter.
+
+#include "ObjectSystem.h"
+#include "EngineBuffers.h"
+
+const struct CompiledScriptModule* const compiledScriptModules[] = { NULL };
+const int numCompiledScriptModules = 0;
@@ -0,0 +1,16 @@
+//
+//  DrawBatch3D.h
+//  rvm
+//
+
+#ifndef DrawBatch3D_h
+#define DrawBatch3D_h
+
+struct DrawBatch3D {
+    float matrix[16];
+    unsigned short indexPos;
+    unsigned short vertexStart;
+    unsigned short vertexCount;
+};
+
+#endif /* DrawBatch3D_h */
@@ -0,0 +1,223 @@
+//
+//  EngineBuffers.h
+//  rvm
+//
+
+#ifndef EngineBuffers_h
+#define EngineBuffers_h
+
+#include "SDL.h"
+#include "AnimationSystem.h"
+#include "AudioPlayback.h"
+#include "FileIO.h"
+#include "GifLoader.h"
+#include "GlobalAppDefinitions.h"
+#include "GraphicsSystem.h"
+#include "ObjectSystem.h"
+#include "PlayerSystem.h"
+#include "Scene3D.h"
+#include "StageSystem.h"
+#include "TextSystem.h"
+
+//The tables and buffers each instance works on, allocated with the instance so only the pointer to them
+//is thread local. The names below are macros for the fields, so include this after any other header.
+struct EngineBuffers {
+    //AnimationSystem
+    struct SpriteFrame animationFrames[4096];
+    struct SpriteQuad animationQuads[4096 * 4];
+    struct SpriteAnimation animationList[1024];
+    struct AnimationFileList animationFileList[256];
+    struct CollisionBox collisionBoxList[32];
+
+    //AudioPlayback
+    struct MusicTrackInfo musicTracks[16];
+
+    //FileIO
+    unsigned char fileBuffer[8192];
+    int saveRAM[8192];
+    struct SaveRAMWriter saveRAMWriter;
+    struct StageList pStageList[64];
+    struct StageList zStageList[128];
+    struct StageList bStageList[64];
+    struct StageList sStageList[64];
+
+    //GifLoader
+    struct GifDecoder gifDecoder;
+
+    //GlobalAppDefinitions
+    char gameDescriptionText[256];
+    int SinValue256[256];
+    int CosValue256[256];
+    int SinValue512[512];
+    int CosValue512[512];
+    int SinValueM7[512];
+    int CosValueM7[512];
+    uint8_t ATanValue256[256][256];
+
+    //GraphicsSystem
+    unsigned short texBuffer[0x100000];
+    unsigned char tileGfx[0x40000];
+    unsigned char graphicData[GRAPHIC_DATASIZE];
+    struct GfxSurfaceDesc gfxSurface[NUM_SPRITESHEETS];
+    struct DrawVertex gfxPolyList[VERTEX_LIMIT];
+    struct DrawVertex3D polyList3D[6404];
+    unsigned short gfxPolyListIndex[INDEX_LIMIT];
+    struct DrawVertex3D scenePolyList3D[SCENE_VERTEX_LIMIT];
+    struct DrawBatch3D sceneBatchList3D[SCENE_BATCH_LIMIT];
+    float tileUVArray[0x1000];
+    unsigned short blendLookupTable[0x2000];
+    unsigned short subtractiveLookupTable[0x2000];
+    struct PaletteEntry tilePalette[256];
+    unsigned short tilePalette16_Data[8][256];
+    struct InterpolationSpan interpolationSpans[INTERPOLATION_SPAN_LIMIT];
+
+    //ObjectSystem
+    int scriptData[0x40000];
+    int jumpTableData[0x4000];
+    int jumpTableStack[0x400];
+    int functionStack[0x400];
+    struct SpriteFrame scriptFrames[0x1000];
+    struct SpriteQuad scriptQuads[0x1000 * 4];
+    char globalVariableNames[0x100][32];
+    int globalVariables[0x100];
+    char scriptText[0x100];
+    struct ObjectScript objectScriptList[0x100];
+    struct FunctionScript functionScriptList[0x200];
+    struct ObjectEntity objectEntityList[0x4A0];
+    int objectEntityXPos[0x4A0];
+    int objectEntityYPos[0x4A0];
+    int objectEntityPrevXPos[0x4A0];
+    int objectEntityPrevYPos[0x4A0];
+    uint8_t objectEntityType[0x4A0];
+    uint8_t objectEntityPriority[0x4A0];
+    uint8_t objectEntityDrawOrder[0x4A0];
+    struct ObjectDrawList objectDrawOrderList[7];
+    const struct CompiledScriptEntry* compiledScriptTable[COMPILED_SCRIPT_TABLE_SIZE];
+    int superInstructionSites[SUPERINSTRUCTION_SITES];
+    uint8_t superInstructionSiteOpcodes[SUPERINSTRUCTION_SITES];
+    struct ScriptNGram scriptNGrams[SCRIPT_NGRAM_TABLE_SIZE];
+    struct ScriptStageProfile scriptStageProfiles[SCRIPT_STAGE_PROFILES];
+    char functionNames[0x200][32];
+    char typeNames[0x100][32];
+
+    //PlayerSystem
+    struct PlayerObject playerList[2];
+
+    //Scene3D
+    struct Vertex3D vertexBuffer[4096];
+    struct Vertex3D vertexBufferT[4096];
+    struct Face3D indexBuffer[1024];
+    struct SortList drawList[1024];
+    struct Vertex2D projectedVertices[4096];
+    struct SortList sortBuffer[1024];
+    unsigned int sortKeys[1024];
+
+    //StageSystem
+    struct Mappings128x128 tile128x128;
+    struct LayoutMap stageLayouts[9];
+    struct CollisionMask16x16 collisionMasks[2];
+    struct FlippedCollisionMask flippedCollisions[2];
+    struct LineScrollParallax hParallax;
+    struct LineScrollParallax vParallax;
+    int bgDeformationData0[0x240];
+    int bgDeformationData1[0x240];
+    int bgDeformationData2[0x240];
+    int bgDeformationData3[0x240];
+    int layerLinePos[9][256];
+    struct TextMenu gameMenu[2];
+    struct StageSnapshot stageSnapshot;
+    struct TileLayerQueue tileLayerQueue;
+
+    //TextSystem
+    struct FontCharacter fontCharacterList[1024];
+};
+
+#define animationFrames (engineBuffers->animationFrames)
+#define animationQuads (engineBuffers->animationQuads)
+#define animationList (engineBuffers->animationList)
+#define animationFileList (engineBuffers->animationFileList)
+#define collisionBoxList (engineBuffers->collisionBoxList)
+#define musicTracks (engineBuffers->musicTracks)
+#define fileBuffer (engineBuffers->fileBuffer)
+#define saveRAM (engineBuffers->saveRAM)
+#define saveRAMWriter (engineBuffers->saveRAMWriter)
+#define pStageList (engineBuffers->pStageList)
+#define zStageList (engineBuffers->zStageList)
+#define bStageList (engineBuffers->bStageList)
+#define sStageList (engineBuffers->sStageList)
+#define gifDecoder (engineBuffers->gifDecoder)
+#define gameDescriptionText (engineBuffers->gameDescriptionText)
+#define SinValue256 (engineBuffers->SinValue256)
+#define CosValue256 (engineBuffers->CosValue256)
+#define SinValue512 (engineBuffers->SinValue512)
+#define CosValue512 (engineBuffers->CosValue512)
+#define SinValueM7 (engineBuffers->SinValueM7)
+#define CosValueM7 (engineBuffers->CosValueM7)
+#define ATanValue256 (engineBuffers->ATanValue256)
+#define texBuffer (engineBuffers->texBuffer)
+#define tileGfx (engineBuffers->tileGfx)
+#define graphicData (engineBuffers->graphicData)
+#define gfxSurface (engineBuffers->gfxSurface)
+#define gfxPolyList (engineBuffers->gfxPolyList)
+#define polyList3D (engineBuffers->polyList3D)
+#define gfxPolyListIndex (engineBuffers->gfxPolyListIndex)
+#define scenePolyList3D (engineBuffers->scenePolyList3D)
+#define sceneBatchList3D (engineBuffers->sceneBatchList3D)
+#define tileUVArray (engineBuffers->tileUVArray)
+#define blendLookupTable (engineBuffers->blendLookupTable)
+#define subtractiveLookupTable (engineBuffers->subtractiveLookupTable)
+#define tilePalette (engineBuffers->tilePalette)
+#define tilePalette16_Data (engineBuffers->tilePalette16_Data)
+#define interpolationSpans (engineBuffers->interpolationSpans)
+#define scriptData (engineBuffers->scriptData)
+#define jumpTableData (engineBuffers->jumpTableData)
+#define jumpTableStack (engineBuffers->jumpTableStack)
+#define functionStack (engineBuffers->functionStack)
+#define scriptFrames (engineBuffers->scriptFrames)
+#define scriptQuads (engineBuffers->scriptQuads)
+#define globalVariableNames (engineBuffers->globalVariableNames)
+#define globalVariables (engineBuffers->globalVariables)
+#define scriptText (engineBuffers->scriptText)
+#define objectScriptList (engineBuffers->objectScriptList)
+#define functionScriptList (engineBuffers->functionScriptList)
+#define objectEntityList (engineBuffers->objectEntityList)
+#define objectEntityXPos (engineBuffers->objectEntityXPos)
+#define objectEntityYPos (engineBuffers->objectEntityYPos)
+#define objectEntityPrevXPos (engineBuffers->objectEntityPrevXPos)
+#define objectEntityPrevYPos (engineBuffers->objectEntityPrevYPos)
+#define objectEntityType (engineBuffers->objectEntityType)
+#define objectEntityPriority (engineBuffers->objectEntityPriority)
+#define objectEntityDrawOrder (engineBuffers->objectEntityDrawOrder)
+#define objectDrawOrderList (engineBuffers->objectDrawOrderList)
+#define compiledScriptTable (engineBuffers->compiledScriptTable)
+#define superInstructionSites (engineBuffers->superInstructionSites)
+#define superInstructionSiteOpcodes (engineBuffers->superInstructionSiteOpcodes)
+#define scriptNGrams (engineBuffers->scriptNGrams)
+#define scriptStageProfiles (engineBuffers->scriptStageProfiles)
+#define functionNames (engineBuffers->functionNames)
+#define typeNames (engineBuffers->typeNames)
+#define playerList (engineBuffers->playerList)
+#define vertexBuffer (engineBuffers->vertexBuffer)
+#define vertexBufferT (engineBuffers->vertexBufferT)
+#define indexBuffer (engineBuffers->indexBuffer)
+#define drawList (engineBuffers->drawList)
+#define projectedVertices (engineBuffers->projectedVertices)
+#define sortBuffer (engineBuffers->sortBuffer)
+#define sortKeys (engineBuffers->sortKeys)
+#define tile128x128 (engineBuffers->tile128x128)
+#define stageLayouts (engineBuffers->stageLayouts)
+#define collisionMasks (engineBuffers->collisionMasks)
+#define flippedCollisions (engineBuffers->flippedCollisions)
+#define hParallax (engineBuffers->hParallax)
+#define vParallax (engineBuffers->vParallax)
+#define bgDeformationData0 (engineBuffers->bgDeformationData0)
+#define bgDeformationData1 (engineBuffers->bgDeformationData1)
+#define bgDeformationData2 (engineBuffers->bgDeformationData2)
+#define bgDeformationData3 (engineBuffers->bgDeformationData3)
+#define layerLinePos (engineBuffers->layerLinePos)
+#define gameMenu (engineBuffers->gameMenu)
+#define stageSnapshot (engineBuffers->stageSnapshot)
+#define tileLayerQueue (engineBuffers->tileLayerQueue)
+#define fontCharacterList (engineBuffers->fontCharacterList)
+
+#endif /* EngineBuffers_h */
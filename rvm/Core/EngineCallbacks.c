@@ -20,9 +20,9 @@
 #define SETTINGS_SELECTED 12
 #define FULL_VERSION_ONLY 14
 
-int prevMessage;
-bool engineInit;
-int waitValue;
+ENGINE_STATE int prevMessage;
+ENGINE_STATE bool engineInit;
+ENGINE_STATE int waitValue;
 
 void EngineCallbacks_PlayVideoFile(char* fileName)
 {
@@ -204,6 +204,11 @@ void EngineCallbacks_StartupRetroEngine()
 }
 void EngineCallbacks_ProcessMainLoop()
 {
+    if (renderInterpolation)
+    {
+        numInterpolationSpans = 0;
+        StageSystem_StartInterpolationFrame();
+    }
     switch (gameMode)
     {
         case 0:
@@ -211,6 +216,8 @@ void EngineCallbacks_ProcessMainLoop()
             gfxVertexSize = 0;
             gfxIndexSizeOpaque = 0;
             gfxVertexSizeOpaque = 0;
+            sceneVertexSize3D = 0;
+            sceneBatchCount3D = 0;
             StageSystem_ProcessStageSelectMenu();
             return;
         case 1:
@@ -220,8 +227,11 @@ void EngineCallbacks_ProcessMainLoop()
             gfxVertexSizeOpaque = 0;
             vertexSize3D = 0;
             indexSize3D = 0;
+            sceneVertexSize3D = 0;
+            sceneBatchCount3D = 0;
             render3DEnabled = false;
             StageSystem_ProcessStage();
+            StateDigest_Update();
             if (prevMessage == gameMessage)
             {
                 gameMessage = 0;
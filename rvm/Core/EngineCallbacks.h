@@ -14,6 +14,8 @@
 #include "StageSystem.h"
 #include "ObjectSystem.h"
 #include "RenderDevice.h"
+#include "StateDigest.h"
+#include "EngineContext.h"
 
 void EngineCallbacks_PlayVideoFile(char* fileName);
 void EngineCallbacks_OnlineSetAchievement(int achievementID, int achievementDone);
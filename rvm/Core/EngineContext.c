@@ -0,0 +1,116 @@
+//
+//  EngineContext.c
+//  rvm
+//
+
+#include "EngineContext.h"
+#include "GlobalAppDefinitions.h"
+#include "RenderDevice.h"
+#include "FileIO.h"
+#include "InputSystem.h"
+#include "ObjectSystem.h"
+#include "AnimationSystem.h"
+#include "PlayerSystem.h"
+#include "StageSystem.h"
+#include "Scene3D.h"
+#include "EngineCallbacks.h"
+#include "StateDigest.h"
+#include "EngineBuffers.h"
+
+ENGINE_STATE bool engineHeadless;
+ENGINE_STATE struct EngineBuffers* engineBuffers;
+
+bool EngineContext_CreateBuffers()
+{
+    //Zeroed like the globals they replace
+    if (engineBuffers == NULL)
+    {
+        engineBuffers = (struct EngineBuffers*)calloc(1, sizeof(struct EngineBuffers));
+    }
+    return engineBuffers != NULL;
+}
+void EngineContext_FreeBuffers()
+{
+    free(engineBuffers);
+    engineBuffers = NULL;
+}
+void EngineContext_InitEngine()
+{
+    //Same order as the platform startup, a headless instance just leaves GL and the audio device alone
+    Init_GlobalAppDefinitions();
+    GlobalAppDefinitions_CalculateTrigAngles();
+    InitRenderDevice();
+    Init_FileIO();
+    Init_InputSystem();
+    Init_ObjectSystem();
+    Init_AnimationSystem();
+    Init_PlayerSystem();
+    Init_StageSystem();
+    Init_Scene3D();
+    RenderDevice_SetScreenDimensions(800, 480);
+    EngineCallbacks_StartupRetroEngine();
+    gameLanguage = 0;
+    gameTrialMode = GAME_FULL;
+}
+bool EngineContext_StartInstance(struct EngineInstance* instance, const char* replayPath, const char* digestPath, int frameLimit)
+{
+    FileIO_StrCopy(instance->replayPath, sizeof(instance->replayPath), (char*)replayPath, (int)strlen(replayPath) + 1);
+    if (digestPath != NULL)
+    {
+        FileIO_StrCopy(instance->digestPath, sizeof(instance->digestPath), (char*)digestPath, (int)strlen(digestPath) + 1);
+    }
+    else
+    {
+        instance->digestPath[0] = '\0';
+    }
+    instance->frameLimit = frameLimit;
+    instance->framesRun = 0;
+    instance->replayLoaded = false;
+    instance->digest = 0;
+    instance->thread = SDL_CreateThread(EngineContext_RunInstance, "Engine", instance);
+    return instance->thread != NULL;
+}
+int EngineContext_RunInstance(void* data)
+{
+    struct EngineInstance* instance = (struct EngineInstance*)data;
+    engineHeadless = true;
+    if (!EngineContext_CreateBuffers())
+    {
+        return 1;
+    }
+    EngineContext_InitEngine();
+    //Nothing is ever presented, so the tile layer vertices are never built
+    skipFrameDraw = true;
+    if (instance->digestPath[0] != '\0')
+    {
+        StateDigest_StartLog(instance->digestPath);
+    }
+    instance->replayLoaded = InputSystem_StartPlayback(instance->replayPath);
+    while (instance->replayLoaded && (instance->frameLimit <= 0 || instance->framesRun < instance->frameLimit))
+    {
+        //Same per frame input order as the windowed loop, minus the keyboard
+        InputSystem_UpdateReplay();
+        if (replayMode != REPLAY_PLAYBACK)
+        {
+            break;
+        }
+        InputSystem_ClearTouchData();
+        EngineCallbacks_ProcessMainLoop();
+        instance->framesRun++;
+    }
+    instance->digest = StateDigest_Hash(0xcbf29ce484222325ull, stateDigest, sizeof(stateDigest));
+    InputSystem_StopReplay();
+    StateDigest_StopLog();
+    StageSystem_StopTileLayerWorkers();
+    FileIO_StopSaveRAMWriter();
+    EngineContext_FreeBuffers();
+    return 0;
+}
+void EngineContext_WaitInstance(struct EngineInstance* instance)
+{
+    if (instance->thread != NULL)
+    {
+        SDL_WaitThread(instance->thread, NULL);
+        instance->thread = NULL;
+    }
+}
@@ -0,0 +1,37 @@
+//
+//  EngineContext.h
+//  rvm
+//
+
+#ifndef EngineContext_h
+#define EngineContext_h
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "SDL.h"
+#include "EngineInstance.h"
+
+//Engine state lives in thread local storage, so every thread that runs the engine is a separate instance
+//and the subsystems keep using it as plain globals. The web build only ever runs the one.
+//The large tables and buffers are on the heap in EngineBuffers, only the pointer to them is thread local.
+#if defined(__EMSCRIPTEN__)
+#define ENGINE_STATE
+#elif defined(_MSC_VER)
+#define ENGINE_STATE __declspec(thread)
+#else
+#define ENGINE_STATE __thread
+#endif
+
+struct EngineBuffers;
+
+extern ENGINE_STATE bool engineHeadless;
+extern ENGINE_STATE struct EngineBuffers* engineBuffers;
+
+bool EngineContext_CreateBuffers(void);
+void EngineContext_FreeBuffers(void);
+void EngineContext_InitEngine(void);
+bool EngineContext_StartInstance(struct EngineInstance* instance, const char* replayPath, const char* digestPath, int frameLimit);
+int EngineContext_RunInstance(void* data);
+void EngineContext_WaitInstance(struct EngineInstance* instance);
+
+#endif /* EngineContext_h */
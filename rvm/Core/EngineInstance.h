@@ -0,0 +1,22 @@
+//
+//  EngineInstance.h
+//  rvm
+//
+
+#ifndef EngineInstance_h
+#define EngineInstance_h
+
+#include <stdbool.h>
+#include "SDL.h"
+
+struct EngineInstance {
+    SDL_Thread* thread;
+    char replayPath[256];
+    char digestPath[256];
+    int frameLimit;
+    int framesRun;
+    bool replayLoaded;
+    uint64_t digest;
+};
+
+#endif /* EngineInstance_h */
@@ -3,37 +3,42 @@
 //  rvm
 //
 
+#ifndef WINDOWS
+//fileno and fsync are POSIX, the build otherwise asks for plain C99
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "FileIO.h"
+#include "StateDigest.h"
+#if WINDOWS
+#include <Windows.h>
+#include <io.h>
+#endif
+#include "EngineBuffers.h"
 
-unsigned char fileBuffer[8192];
-uint32_t bufferPosition;
-uint32_t fileSize;
-uint32_t readSize;
-uint32_t readPos;
-bool useRSDKFile;
-bool useByteCode;
-bool useOldSdkLayout;
-uint32_t vFileSize;
-uint32_t virtualFileOffset;
-int saveRAM[8192];
+ENGINE_STATE uint32_t bufferPosition;
+ENGINE_STATE uint32_t fileSize;
+ENGINE_STATE uint32_t readSize;
+ENGINE_STATE uint32_t readPos;
+ENGINE_STATE bool useRSDKFile;
+ENGINE_STATE bool useByteCode;
+ENGINE_STATE bool useOldSdkLayout;
+ENGINE_STATE uint32_t vFileSize;
+ENGINE_STATE uint32_t virtualFileOffset;
 const char encryptionStringA[] = "4RaS9D7KaEbxcp2o5r6t";
 const char encryptionStringB[] = "3tRaUxLmEaSn";
-uint8_t eStringPosA;
-uint8_t eStringPosB;
-uint8_t eStringNo;
-bool eNybbleSwap;
-char currentStageFolder[8];
-struct StageList pStageList[64];
-struct StageList zStageList[128];
-struct StageList bStageList[64];
-struct StageList sStageList[64];
-uint8_t activeStageList;
-uint8_t noPresentationStages;
-uint8_t noZoneStages;
-uint8_t noBonusStages;
-uint8_t noSpecialStages;
-int actNumber;
-FILE *fileReader;
+ENGINE_STATE uint8_t eStringPosA;
+ENGINE_STATE uint8_t eStringPosB;
+ENGINE_STATE uint8_t eStringNo;
+ENGINE_STATE bool eNybbleSwap;
+ENGINE_STATE char currentStageFolder[8];
+ENGINE_STATE uint8_t activeStageList;
+ENGINE_STATE uint8_t noPresentationStages;
+ENGINE_STATE uint8_t noZoneStages;
+ENGINE_STATE uint8_t noBonusStages;
+ENGINE_STATE uint8_t noSpecialStages;
+ENGINE_STATE int actNumber;
+ENGINE_STATE FILE *fileReader;
 
 void Init_FileIO()
 {
@@ -986,8 +991,18 @@ bool FileIO_ReachedEndOfFile()
     return (readPos - readSize + bufferPosition - virtualFileOffset) >= vFileSize;
 }
 const char* SAVE_GAME_FILE = "SGame.bin";
+const char* SAVE_GAME_TEMP_FILE = "SGame.bin.tmp";
 uint8_t FileIO_ReadSaveRAMData()
 {
+    struct SaveRAMHeader header;
+    long sramSize;
+    if (engineHeadless)
+    {
+        //Headless instances share the working directory, so their saves never leave saveRAM
+        return 1;
+    }
+    //Anything still queued is newer than the file, so let it land first
+    FileIO_StopSaveRAMWriter();
     //TODO: This should probably go into the appropriate platform specific directory instead.
 #if WINDOWS
 	if (_access(SAVE_GAME_FILE, 0) != -1)
@@ -996,19 +1011,172 @@ uint8_t FileIO_ReadSaveRAMData()
 #endif
     {
         FILE *sramReader = fopen(SAVE_GAME_FILE, "rb");
+        if (sramReader == NULL)
+        {
+            return 1;
+        }
+        fseek(sramReader, 0, SEEK_END);
+        sramSize = ftell(sramReader);
         fseek(sramReader, 0, SEEK_SET);
-        fread(saveRAM, 4, 8192, sramReader);
+        saveRAMWriter.hasWritten = false;
+        if (sramSize == (long)sizeof(saveRAM))
+        {
+            //Saves from before the header was added are taken as they are, the next save rewrites them
+            fread(saveRAM, 4, 8192, sramReader);
+        }
+        else if (sramSize == (long)(sizeof(header) + sizeof(saveRAM)) && fread(&header, sizeof(header), 1, sramReader) == 1
+            && memcmp(header.signature, "SRAM", 4) == 0 && header.version == SAVE_RAM_VERSION && header.dataSize == sizeof(saveRAM)
+            && fread(saveRAMWriter.written, 4, 8192, sramReader) == 8192 && FileIO_SaveRAMChecksum(saveRAMWriter.written) == header.checksum)
+        {
+            memcpy(saveRAM, saveRAMWriter.written, sizeof(saveRAM));
+            saveRAMWriter.hasWritten = true;
+        }
+        else
+        {
+            //A damaged save is left on disk untouched and the game carries on with what it has
+            printf("Ignoring damaged save file %s\n", SAVE_GAME_FILE);
+        }
         fclose(sramReader);
     }
     return 1;
 }
 uint8_t FileIO_WriteSaveRAMData()
 {
-    FILE* sramWriter = fopen(SAVE_GAME_FILE, "wb");
-    fwrite(saveRAM, 4, 8192, sramWriter);
-    fclose(sramWriter);
+    if (engineHeadless)
+    {
+        return 1;
+    }
+    //Only the copy happens on the game thread, the file is written behind it
+    if (saveRAMWriter.thread == NULL && !FileIO_StartSaveRAMWriter())
+    {
+        FileIO_StoreSaveRAM(&saveRAMWriter, saveRAM);
+        return 1;
+    }
+    SDL_LockMutex(saveRAMWriter.lock);
+    memcpy(saveRAMWriter.pending, saveRAM, sizeof(saveRAM));
+    //A save made before the last one reached the disk simply replaces it
+    if (!saveRAMWriter.hasPending)
+    {
+        saveRAMWriter.hasPending = true;
+        SDL_SemPost(saveRAMWriter.wake);
+    }
+    SDL_UnlockMutex(saveRAMWriter.lock);
     return 1;
 }
+uint32_t FileIO_SaveRAMChecksum(const int* data)
+{
+    uint64_t hash = StateDigest_Hash(0xcbf29ce484222325ull, data, sizeof(saveRAM));
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+int FileIO_SaveRAMWorker(void* data)
+{
+    struct SaveRAMWriter* writer = (struct SaveRAMWriter*)data;
+    bool store;
+    bool quit = false;
+    while (!quit)
+    {
+        SDL_SemWait(writer->wake);
+        SDL_LockMutex(writer->lock);
+        store = writer->hasPending;
+        if (store)
+        {
+            memcpy(writer->image, writer->pending, sizeof(writer->image));
+            writer->hasPending = false;
+        }
+        quit = writer->quit;
+        SDL_UnlockMutex(writer->lock);
+        if (store)
+        {
+            FileIO_StoreSaveRAM(writer, writer->image);
+        }
+    }
+    return 0;
+}
+bool FileIO_StartSaveRAMWriter()
+{
+    //The writer is handed this instance's state, saveRAMWriter names a different one on its own thread
+    saveRAMWriter.hasPending = false;
+    saveRAMWriter.quit = false;
+    saveRAMWriter.lock = SDL_CreateMutex();
+    saveRAMWriter.wake = SDL_CreateSemaphore(0);
+    if (saveRAMWriter.lock != NULL && saveRAMWriter.wake != NULL)
+    {
+        saveRAMWriter.thread = SDL_CreateThread(FileIO_SaveRAMWorker, "SaveRAM", &saveRAMWriter);
+    }
+    if (saveRAMWriter.thread == NULL)
+    {
+        //No threads on this platform, saves are written in place instead
+        FileIO_StopSaveRAMWriter();
+        return false;
+    }
+    return true;
+}
+void FileIO_StopSaveRAMWriter()
+{
+    if (saveRAMWriter.thread != NULL)
+    {
+        //The writer finishes whatever is pending before it exits
+        SDL_LockMutex(saveRAMWriter.lock);
+        saveRAMWriter.quit = true;
+        SDL_UnlockMutex(saveRAMWriter.lock);
+        SDL_SemPost(saveRAMWriter.wake);
+        SDL_WaitThread(saveRAMWriter.thread, NULL);
+        saveRAMWriter.thread = NULL;
+    }
+    if (saveRAMWriter.lock != NULL)
+    {
+        SDL_DestroyMutex(saveRAMWriter.lock);
+        saveRAMWriter.lock = NULL;
+    }
+    if (saveRAMWriter.wake != NULL)
+    {
+        SDL_DestroySemaphore(saveRAMWriter.wake);
+        saveRAMWriter.wake = NULL;
+    }
+}
+bool FileIO_StoreSaveRAM(struct SaveRAMWriter* writer, const int* data)
+{
+    struct SaveRAMHeader header;
+    FILE* sramWriter;
+    bool stored;
+    //Scripts save far more often than the data changes, a save matching the file is dropped
+    if (writer->hasWritten && memcmp(writer->written, data, sizeof(writer->written)) == 0)
+    {
+        return true;
+    }
+    memcpy(header.signature, "SRAM", 4);
+    header.version = SAVE_RAM_VERSION;
+    header.dataSize = sizeof(writer->written);
+    header.checksum = FileIO_SaveRAMChecksum(data);
+    //Written to the side and renamed over the old save, so a crash part way leaves the old one whole
+    sramWriter = fopen(SAVE_GAME_TEMP_FILE, "wb");
+    if (sramWriter == NULL)
+    {
+        return false;
+    }
+    stored = fwrite(&header, sizeof(header), 1, sramWriter) == 1 && fwrite(data, 4, 8192, sramWriter) == 8192;
+    //The data has to be on the disk before the rename is, or a power cut can leave an empty save behind
+    stored = stored && fflush(sramWriter) == 0;
+#if WINDOWS
+    stored = stored && _commit(_fileno(sramWriter)) == 0;
+#else
+    stored = stored && fsync(fileno(sramWriter)) == 0;
+#endif
+    stored = fclose(sramWriter) == 0 && stored;
+#if WINDOWS
+    stored = stored && MoveFileExA(SAVE_GAME_TEMP_FILE, SAVE_GAME_FILE, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    stored = stored && rename(SAVE_GAME_TEMP_FILE, SAVE_GAME_FILE) == 0;
+#endif
+    if (!stored)
+    {
+        remove(SAVE_GAME_TEMP_FILE);
+        return false;
+    }
+    memcpy(writer->written, data, sizeof(writer->written));
+    writer->hasWritten = true;
+    return true;
+}
 bool FileIO_IsValidDataRsdk(const char* filePath){
     FILE* file = fopen(filePath,"rb");
     if(file){
@@ -1027,3 +1195,192 @@ bool FileIO_IsValidDataRsdk(const char* filePath){
     }
     return false;
 }
+bool FileIO_OpenFileStream(char* filePath, struct FileStream* stream)
+{
+    //Gives a file its own handle and decryption state, so it can be read from another thread
+    //while the shared reader above keeps loading other files.
+    return FileIO_FindFileStream(filePath, stream) && FileIO_BeginFileStream(filePath, stream);
+}
+bool FileIO_FindFileStream(char* filePath, struct FileStream* stream)
+{
+    //Only the lookup goes through the shared reader, so this part has to stay on one thread
+    struct FileData fData;
+    stream->file = NULL;
+    stream->checkpoints = NULL;
+    if (!FileIO_LoadFile(filePath, &fData))
+    {
+        return false;
+    }
+    stream->encrypted = useRSDKFile;
+    stream->fileOffset = useRSDKFile ? fData.virtualFileOffset : 0u;
+    stream->fileSize = fData.fileSize;
+    FileIO_CloseFile();
+    return true;
+}
+bool FileIO_BeginFileStream(char* filePath, struct FileStream* stream)
+{
+    //Opens a stream found above, touches nothing shared so any thread can call it
+    stream->file = fopen(stream->encrypted ? "Data.rsdk" : filePath, "rb");
+    if (stream->file == NULL)
+    {
+        return false;
+    }
+    stream->position = 0u;
+    stream->numCheckpoints = 0u;
+    if (stream->encrypted)
+    {
+        //The decryption state is kept every few KB so seeking doesn't have to replay the whole file.
+        //Only the start is known up front, the rest are filled in as reads and seeks first pass them.
+        stream->checkpoints = malloc((stream->fileSize / FILE_STREAM_CHECKPOINT + 1) * 4);
+        if (stream->checkpoints == NULL)
+        {
+            FileIO_CloseFileStream(stream);
+            return false;
+        }
+        stream->eStringNo = (uint8_t)((stream->fileSize & 0x1FC) >> 2);
+        stream->eStringPosB = (uint8_t)(1 + stream->eStringNo % 9);
+        stream->eStringPosA = (uint8_t)(1 + stream->eStringNo % stream->eStringPosB);
+        stream->eNybbleSwap = false;
+        FileIO_AddFileStreamCheckpoint(stream);
+    }
+    FileIO_SeekFileStream(stream, 0u);
+    return true;
+}
+void FileIO_AddFileStreamCheckpoint(struct FileStream* stream)
+{
+    //Called on block boundaries, keeps the state if this is the first time the stream got this far
+    uint8_t* checkpoint;
+    if (stream->position / FILE_STREAM_CHECKPOINT != stream->numCheckpoints)
+    {
+        return;
+    }
+    checkpoint = &stream->checkpoints[stream->numCheckpoints << 2];
+    checkpoint[0] = stream->eStringPosA;
+    checkpoint[1] = stream->eStringPosB;
+    checkpoint[2] = stream->eStringNo;
+    checkpoint[3] = stream->eNybbleSwap;
+    stream->numCheckpoints++;
+}
+void FileIO_AdvanceFileStream(struct FileStream* stream, uint32_t numBytes)
+{
+    uint32_t run;
+    while (numBytes > 0u)
+    {
+        //Until one of the string positions wraps they just count up, so step straight to the next wrap
+        run = stream->eStringPosA < 19 && stream->eStringPosB < 11 ? (uint32_t)(19 - stream->eStringPosA < 11 - stream->eStringPosB ? 19 - stream->eStringPosA : 11 - stream->eStringPosB) : 0u;
+        if (run > 0u)
+        {
+            if (run > numBytes)
+            {
+                run = numBytes;
+            }
+            stream->eStringPosA += (uint8_t)run;
+            stream->eStringPosB += (uint8_t)run;
+            stream->position += run;
+            numBytes -= run;
+            continue;
+        }
+        stream->eStringPosA += 1;
+        stream->eStringPosB += 1;
+        if (stream->eStringPosA > 19 && stream->eStringPosB > 11)
+        {
+            stream->eStringNo += 1;
+            stream->eStringNo &= 0x7F;
+            if (!stream->eNybbleSwap)
+            {
+                stream->eNybbleSwap = true;
+                stream->eStringPosA = (uint8_t)(3 + stream->eStringNo % 0xF);
+                stream->eStringPosB = (uint8_t)(1 + stream->eStringNo % 0x7);
+            }
+            else
+            {
+                stream->eNybbleSwap = false;
+                stream->eStringPosA = (uint8_t)(6 + stream->eStringNo % 0xC);
+                stream->eStringPosB = (uint8_t)(4 + stream->eStringNo % 0x5);
+            }
+        }
+        else
+        {
+            if (stream->eStringPosA > 19)
+            {
+                stream->eStringPosA = 1;
+                stream->eNybbleSwap = !stream->eNybbleSwap;
+            }
+            if (stream->eStringPosB > 11)
+            {
+                stream->eStringPosB = 1;
+                stream->eNybbleSwap = !stream->eNybbleSwap;
+            }
+        }
+        stream->position += 1u;
+        numBytes--;
+    }
+}
+size_t FileIO_ReadFileStream(struct FileStream* stream, uint8_t* dest, size_t numBytes)
+{
+    if (numBytes > stream->fileSize - stream->position)
+    {
+        numBytes = stream->fileSize - stream->position;
+    }
+    numBytes = fread(dest, 1, numBytes, stream->file);
+    if (!stream->encrypted)
+    {
+        stream->position += (uint32_t)numBytes;
+        return numBytes;
+    }
+    for (size_t i = 0; i < numBytes; i++)
+    {
+        uint8_t b = (uint8_t)((char)(dest[i] ^ stream->eStringNo) ^ encryptionStringB[stream->eStringPosB]);
+        if (stream->eNybbleSwap)
+        {
+            b = (uint8_t)((b >> 4) + ((int)(b & 0xF) << 4));
+        }
+        dest[i] = b ^ (uint8_t)encryptionStringA[stream->eStringPosA];
+        FileIO_AdvanceFileStream(stream, 1u);
+        if (stream->position % FILE_STREAM_CHECKPOINT == 0u)
+        {
+            FileIO_AddFileStreamCheckpoint(stream);
+        }
+    }
+    return numBytes;
+}
+void FileIO_SeekFileStream(struct FileStream* stream, uint32_t position)
+{
+    if (position > stream->fileSize)
+    {
+        position = stream->fileSize;
+    }
+    fseek(stream->file, (long)(stream->fileOffset + position), SEEK_SET);
+    if (!stream->encrypted)
+    {
+        stream->position = position;
+        return;
+    }
+    //Start from the nearest block reached so far, and keep the ones walked through on the way
+    uint32_t block = position / FILE_STREAM_CHECKPOINT < stream->numCheckpoints ? position / FILE_STREAM_CHECKPOINT : stream->numCheckpoints - 1;
+    uint8_t* checkpoint = &stream->checkpoints[block << 2];
+    stream->eStringPosA = checkpoint[0];
+    stream->eStringPosB = checkpoint[1];
+    stream->eStringNo = checkpoint[2];
+    stream->eNybbleSwap = checkpoint[3];
+    stream->position = block * FILE_STREAM_CHECKPOINT;
+    while (position - stream->position >= FILE_STREAM_CHECKPOINT)
+    {
+        FileIO_AdvanceFileStream(stream, FILE_STREAM_CHECKPOINT);
+        FileIO_AddFileStreamCheckpoint(stream);
+    }
+    FileIO_AdvanceFileStream(stream, position - stream->position);
+}
+void FileIO_CloseFileStream(struct FileStream* stream)
+{
+    if (stream->file != NULL)
+    {
+        fclose(stream->file);
+        stream->file = NULL;
+    }
+    if (stream->checkpoints != NULL)
+    {
+        free(stream->checkpoints);
+        stream->checkpoints = NULL;
+    }
+}
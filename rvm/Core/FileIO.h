@@ -16,39 +16,38 @@
 #endif
 #include "StageList.h"
 #include "FileData.h"
+#include "FileStream.h"
+#include "SaveRAMHeader.h"
+#include "SaveRAMWriter.h"
 #include "SDL.h"
+#include "EngineContext.h"
 
 #define PRESENTATION_STAGE 0
 #define ZONE_STAGE 1
 #define BONUS_STAGE 2
 #define SPECIAL_STAGE 3
+#define SAVE_RAM_VERSION 1
 
-extern unsigned char fileBuffer[8192];
-extern uint32_t bufferPosition;
-extern uint32_t fileSize;
-extern uint32_t readSize;
-extern uint32_t readPos;
-extern bool useRSDKFile;
-extern bool useByteCode;
-extern bool useOldSdkLayout;
-extern uint32_t vFileSize;
-extern uint32_t virtualFileOffset;
-extern int saveRAM[8192];
-extern uint8_t eStringPosA;
-extern uint8_t eStringPosB;
-extern uint8_t eStringNo;
-extern bool eNybbleSwap;
-extern char currentStageFolder[8];
-extern struct StageList pStageList[64];
-extern struct StageList zStageList[128];
-extern struct StageList bStageList[64];
-extern struct StageList sStageList[64];
-extern uint8_t activeStageList;
-extern uint8_t noPresentationStages;
-extern uint8_t noZoneStages;
-extern uint8_t noBonusStages;
-extern uint8_t noSpecialStages;
-extern int actNumber;
+extern ENGINE_STATE uint32_t bufferPosition;
+extern ENGINE_STATE uint32_t fileSize;
+extern ENGINE_STATE uint32_t readSize;
+extern ENGINE_STATE uint32_t readPos;
+extern ENGINE_STATE bool useRSDKFile;
+extern ENGINE_STATE bool useByteCode;
+extern ENGINE_STATE bool useOldSdkLayout;
+extern ENGINE_STATE uint32_t vFileSize;
+extern ENGINE_STATE uint32_t virtualFileOffset;
+extern ENGINE_STATE uint8_t eStringPosA;
+extern ENGINE_STATE uint8_t eStringPosB;
+extern ENGINE_STATE uint8_t eStringNo;
+extern ENGINE_STATE bool eNybbleSwap;
+extern ENGINE_STATE char currentStageFolder[8];
+extern ENGINE_STATE uint8_t activeStageList;
+extern ENGINE_STATE uint8_t noPresentationStages;
+extern ENGINE_STATE uint8_t noZoneStages;
+extern ENGINE_STATE uint8_t noBonusStages;
+extern ENGINE_STATE uint8_t noSpecialStages;
+extern ENGINE_STATE int actNumber;
 
 void Init_FileIO(void);
 void FileIO_StrCopy(char* strA, int len_strA, char* strB, int len_strB);
@@ -78,6 +77,19 @@ void FileIO_SetFilePosition(uint32_t newFilePos);
 bool FileIO_ReachedEndOfFile(void);
 uint8_t FileIO_ReadSaveRAMData(void);
 uint8_t FileIO_WriteSaveRAMData(void);
+uint32_t FileIO_SaveRAMChecksum(const int* data);
+int FileIO_SaveRAMWorker(void* data);
+bool FileIO_StartSaveRAMWriter(void);
+void FileIO_StopSaveRAMWriter(void);
+bool FileIO_StoreSaveRAM(struct SaveRAMWriter* writer, const int* data);
 bool FileIO_IsValidDataRsdk(const char* filePath);
+bool FileIO_OpenFileStream(char* filePath, struct FileStream* stream);
+bool FileIO_FindFileStream(char* filePath, struct FileStream* stream);
+bool FileIO_BeginFileStream(char* filePath, struct FileStream* stream);
+void FileIO_AddFileStreamCheckpoint(struct FileStream* stream);
+void FileIO_AdvanceFileStream(struct FileStream* stream, uint32_t numBytes);
+size_t FileIO_ReadFileStream(struct FileStream* stream, uint8_t* dest, size_t numBytes);
+void FileIO_SeekFileStream(struct FileStream* stream, uint32_t position);
+void FileIO_CloseFileStream(struct FileStream* stream);
 
 #endif /* FileIO_h */
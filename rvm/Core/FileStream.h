@@ -0,0 +1,29 @@
+//
+//  FileStream.h
+//  rvm
+//
+
+#ifndef FileStream_h
+#define FileStream_h
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "SDL.h"
+
+#define FILE_STREAM_CHECKPOINT 0x1000
+
+struct FileStream {
+    FILE* file;
+    uint32_t fileOffset;
+    uint32_t fileSize;
+    uint32_t position;
+    bool encrypted;
+    uint8_t eStringPosA;
+    uint8_t eStringPosB;
+    uint8_t eStringNo;
+    bool eNybbleSwap;
+    uint8_t* checkpoints;
+    uint32_t numCheckpoints;
+};
+
+#endif /* FileStream_h */
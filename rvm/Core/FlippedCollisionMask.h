@@ -0,0 +1,20 @@
+//
+//  FlippedCollisionMask.h
+//  rvm
+//
+
+#ifndef FlippedCollisionMask_h
+#define FlippedCollisionMask_h
+
+struct FlippedCollisionMask {
+    signed char floorMask[0x10000];
+    signed char leftWallMask[0x10000];
+    signed char rightWallMask[0x10000];
+    signed char roofMask[0x10000];
+    int floorAngle[0x1000];
+    int leftWallAngle[0x1000];
+    int rightWallAngle[0x1000];
+    int roofAngle[0x1000];
+};
+
+#endif /* FlippedCollisionMask_h */
@@ -4,6 +4,7 @@
 //
 
 #include "GifLoader.h"
+#include "EngineBuffers.h"
 
 const int LOADING_IMAGE = 0;
 const int LOAD_COMPLETE = 1;
@@ -15,7 +16,6 @@ const int NO_SUCH_CODE = 4098;
 const int HT_SIZE = 8192;
 const int HT_KEY_MASK = 8191;
 
-struct GifDecoder gifDecoder;
 int codeMasks[] = {
     0,
     1,
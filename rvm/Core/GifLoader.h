@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include "GifDecoder.h"
 #include "FileIO.h"
+#include "EngineContext.h"
 
 void Init_GifDecoder(void);
 void GifLoader_ReadGifPictureData(int width, int height, bool interlaced, uint8_t* gfxData, int offset);
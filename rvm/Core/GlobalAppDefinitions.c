@@ -4,6 +4,7 @@
 //
 
 #include "GlobalAppDefinitions.h"
+#include "EngineBuffers.h"
 
 const int RETRO_EN = 0;
 const int RETRO_FR = 1;
@@ -36,38 +37,31 @@ const int GAME_TRIAL = 1;
 const int OBJECT_BORDER_Y1 = 256;
 const int OBJECT_BORDER_Y2 = 496;
 const double Pi = 3.141592654;
-char gameWindowText[] = "Retro-Engine";
-char gameVersion[] = "2.0.1";
-char gameDescriptionText[256];
-char gamePlatform[] = "Mobile";
-char gameRenderType[] = "HW_Rendering";
-char gameHapticsSetting[] = "No_Haptics";
-uint8_t gameMode;
-uint8_t gameLanguage;
-int gameMessage;
-uint8_t gameOnlineActive;
-uint8_t gameHapticsEnabled;
-uint8_t frameCounter;
-int frameSkipTimer;
-int frameSkipSetting;
-int gameSFXVolume;
-int gameBGMVolume;
-uint8_t gameTrialMode;
-int gamePlatformID;
-bool HQ3DFloorEnabled;
-int SCREEN_XSIZE;
-int SCREEN_CENTER;
-int SCREEN_SCROLL_LEFT;
-int SCREEN_SCROLL_RIGHT;
-int OBJECT_BORDER_X1;
-int OBJECT_BORDER_X2;
-int SinValue256[256];
-int CosValue256[256];
-int SinValue512[512];
-int CosValue512[512];
-int SinValueM7[512];
-int CosValueM7[512];
-uint8_t ATanValue256[256][256];
+ENGINE_STATE char gameWindowText[] = "Retro-Engine";
+ENGINE_STATE char gameVersion[] = "2.0.1";
+ENGINE_STATE char gamePlatform[] = "Mobile";
+ENGINE_STATE char gameRenderType[] = "HW_Rendering";
+ENGINE_STATE char gameHapticsSetting[] = "No_Haptics";
+ENGINE_STATE uint8_t gameMode;
+ENGINE_STATE uint8_t gameLanguage;
+ENGINE_STATE int gameMessage;
+ENGINE_STATE uint8_t gameOnlineActive;
+ENGINE_STATE uint8_t gameHapticsEnabled;
+ENGINE_STATE uint8_t frameCounter;
+ENGINE_STATE int frameSkipTimer;
+ENGINE_STATE int frameSkipSetting;
+ENGINE_STATE bool skipFrameDraw;
+ENGINE_STATE int gameSFXVolume;
+ENGINE_STATE int gameBGMVolume;
+ENGINE_STATE uint8_t gameTrialMode;
+ENGINE_STATE int gamePlatformID;
+ENGINE_STATE bool HQ3DFloorEnabled;
+ENGINE_STATE int SCREEN_XSIZE;
+ENGINE_STATE int SCREEN_CENTER;
+ENGINE_STATE int SCREEN_SCROLL_LEFT;
+ENGINE_STATE int SCREEN_SCROLL_RIGHT;
+ENGINE_STATE int OBJECT_BORDER_X1;
+ENGINE_STATE int OBJECT_BORDER_X2;
 
 void Init_GlobalAppDefinitions()
 {
@@ -79,6 +73,7 @@ void Init_GlobalAppDefinitions()
     frameCounter = 0;
     frameSkipTimer = -1;
     frameSkipSetting = 0;
+    skipFrameDraw = false;
     gameSFXVolume = 100;
     gameBGMVolume = 100;
     gameTrialMode = GAME_FULL;
@@ -11,6 +11,7 @@
 #include <math.h>
 #include "FileIO.h"
 #include "ObjectSystem.h"
+#include "EngineContext.h"
 
 extern const int RETRO_EN;
 extern const int RETRO_FR;
@@ -43,38 +44,31 @@ extern const int GAME_TRIAL;
 extern const int OBJECT_BORDER_Y1;
 extern const int OBJECT_BORDER_Y2;
 extern const double Pi;
-extern char gameWindowText[];
-extern char gameVersion[];
-extern char gameDescriptionText[256];
-extern char gamePlatform[];
-extern char gameRenderType[];
-extern char gameHapticsSetting[];
-extern uint8_t gameMode;
-extern uint8_t gameLanguage;
-extern int gameMessage;
-extern uint8_t gameOnlineActive;
-extern uint8_t gameHapticsEnabled;
-extern uint8_t frameCounter;
-extern int frameSkipTimer;
-extern int frameSkipSetting;
-extern int gameSFXVolume;
-extern int gameBGMVolume;
-extern uint8_t gameTrialMode;
-extern int gamePlatformID;
-extern bool HQ3DFloorEnabled;
-extern int SCREEN_XSIZE;
-extern int SCREEN_CENTER;
-extern int SCREEN_SCROLL_LEFT;
-extern int SCREEN_SCROLL_RIGHT;
-extern int OBJECT_BORDER_X1;
-extern int OBJECT_BORDER_X2;
-extern int SinValue256[256];
-extern int CosValue256[256];
-extern int SinValue512[512];
-extern int CosValue512[512];
-extern int SinValueM7[512];
-extern int CosValueM7[512];
-extern uint8_t ATanValue256[256][256];
+extern ENGINE_STATE char gameWindowText[];
+extern ENGINE_STATE char gameVersion[];
+extern ENGINE_STATE char gamePlatform[];
+extern ENGINE_STATE char gameRenderType[];
+extern ENGINE_STATE char gameHapticsSetting[];
+extern ENGINE_STATE uint8_t gameMode;
+extern ENGINE_STATE uint8_t gameLanguage;
+extern ENGINE_STATE int gameMessage;
+extern ENGINE_STATE uint8_t gameOnlineActive;
+extern ENGINE_STATE uint8_t gameHapticsEnabled;
+extern ENGINE_STATE uint8_t frameCounter;
+extern ENGINE_STATE int frameSkipTimer;
+extern ENGINE_STATE int frameSkipSetting;
+extern ENGINE_STATE bool skipFrameDraw;
+extern ENGINE_STATE int gameSFXVolume;
+extern ENGINE_STATE int gameBGMVolume;
+extern ENGINE_STATE uint8_t gameTrialMode;
+extern ENGINE_STATE int gamePlatformID;
+extern ENGINE_STATE bool HQ3DFloorEnabled;
+extern ENGINE_STATE int SCREEN_XSIZE;
+extern ENGINE_STATE int SCREEN_CENTER;
+extern ENGINE_STATE int SCREEN_SCROLL_LEFT;
+extern ENGINE_STATE int SCREEN_SCROLL_RIGHT;
+extern ENGINE_STATE int OBJECT_BORDER_X1;
+extern ENGINE_STATE int OBJECT_BORDER_X2;
 
 void Init_GlobalAppDefinitions(void);
 void GlobalAppDefinitions_CalculateTrigAngles(void);
@@ -5,41 +5,35 @@
 
 #include "GraphicsSystem.h"
 #include <stdio.h>
+#include "EngineBuffers.h"
 
-bool render3DEnabled;
-unsigned char fadeMode;
-unsigned char fadeR;
-unsigned char fadeG;
-unsigned char fadeB;
-unsigned char fadeA;
-unsigned char paletteMode;
-unsigned char colourMode;
-unsigned short texBuffer[0x100000];
-unsigned char texBufferMode;
-unsigned char tileGfx[0x40000];
-unsigned char graphicData[GRAPHIC_DATASIZE];
-struct GfxSurfaceDesc gfxSurface[NUM_SPRITESHEETS];
-uint32_t gfxDataPosition;
-struct DrawVertex gfxPolyList[VERTEX_LIMIT];
-struct DrawVertex3D polyList3D[6404];
-unsigned short gfxPolyListIndex[INDEX_LIMIT];
-unsigned short gfxVertexSize;
-unsigned short gfxVertexSizeOpaque;
-unsigned short gfxIndexSize;
-unsigned short gfxIndexSizeOpaque;
-unsigned short vertexSize3D;
-unsigned short indexSize3D;
-float tileUVArray[0x1000];
-struct Vector3 floor3DPos;
-float floor3DAngle;
-unsigned short blendLookupTable[0x2000];
-unsigned short subtractiveLookupTable[0x2000];
-struct PaletteEntry tilePalette[256];
-unsigned short tilePalette16_Data[8][256];
-int texPaletteNum;
-int waterDrawPos;
-bool videoPlaying;
-int currentVideoFrame;
+ENGINE_STATE bool render3DEnabled;
+ENGINE_STATE unsigned char fadeMode;
+ENGINE_STATE unsigned char fadeR;
+ENGINE_STATE unsigned char fadeG;
+ENGINE_STATE unsigned char fadeB;
+ENGINE_STATE unsigned char fadeA;
+ENGINE_STATE unsigned char paletteMode;
+ENGINE_STATE unsigned char colourMode;
+ENGINE_STATE unsigned char texBufferMode;
+ENGINE_STATE uint32_t gfxDataPosition;
+ENGINE_STATE unsigned short gfxVertexSize;
+ENGINE_STATE unsigned short gfxVertexSizeOpaque;
+ENGINE_STATE unsigned short gfxIndexSize;
+ENGINE_STATE unsigned short gfxIndexSizeOpaque;
+ENGINE_STATE unsigned short vertexSize3D;
+ENGINE_STATE unsigned short indexSize3D;
+ENGINE_STATE unsigned short sceneVertexSize3D;
+ENGINE_STATE int sceneBatchCount3D;
+ENGINE_STATE struct Vector3 floor3DPos;
+ENGINE_STATE float floor3DAngle;
+ENGINE_STATE int texPaletteNum;
+ENGINE_STATE unsigned char gfxLineBuffer[240];
+ENGINE_STATE int waterDrawPos;
+ENGINE_STATE bool videoPlaying;
+ENGINE_STATE int currentVideoFrame;
+ENGINE_STATE bool renderInterpolation;
+ENGINE_STATE int numInterpolationSpans;
 
 //Dump the texture buffer in pallete 0 for testing purposes.
 void DumpTexBuffer(){
@@ -75,7 +69,13 @@ void Init_GraphicsSystem()
     gfxIndexSizeOpaque = 0;
     vertexSize3D = 0;
     indexSize3D = 0;
+    sceneVertexSize3D = 0;
+    sceneBatchCount3D = 0;
     texPaletteNum = 0;
+    for (int i = 0; i < 240; i++)
+    {
+        gfxLineBuffer[i] = 0;
+    }
     waterDrawPos = 320;
     videoPlaying = false;
 }
@@ -873,6 +873,51 @@ void GraphicsSystem_DrawSprite(int xPos, int yPos, int xSize, int ySize, int xBe
         gfxIndexSize += 6;
     }
 }
+void GraphicsSystem_BuildSpriteQuads(struct SpriteQuad* quads, struct SpriteFrame* frame, int surfaceNum)
+{
+    //Bakes the four flip variants of a frame, indexed by direction, against the current atlas.
+    //Positions are in 1/16th pixels relative to the object with the pivot already applied.
+    for (int direction = 0; direction < 4; direction++)
+    {
+        struct SpriteQuad* quad = &quads[direction];
+        int xOffset = (direction & 1) ? -frame->xSize - frame->xPivot : frame->xPivot;
+        int yOffset = (direction & 2) ? -frame->ySize - frame->yPivot : frame->yPivot;
+        int texLeft = gfxSurface[surfaceNum].texStartX + frame->left;
+        int texTop = gfxSurface[surfaceNum].texStartY + frame->top;
+        quad->visible = gfxSurface[surfaceNum].texStartX > -1;
+        for (int i = 0; i < 4; i++)
+        {
+            int column = i & 1;
+            int row = i >> 1;
+            quad->position[i].X = (short)((xOffset + column * frame->xSize) << 4);
+            quad->position[i].Y = (short)((yOffset + row * frame->ySize) << 4);
+            quad->texCoord[i].X = (short)(texLeft + (column ^ (direction & 1)) * frame->xSize);
+            quad->texCoord[i].Y = (short)(texTop + (row ^ (direction >> 1)) * frame->ySize);
+        }
+    }
+}
+void GraphicsSystem_DrawSpriteQuad(struct SpriteQuad* quad, int xPos, int yPos)
+{
+    int left = xPos + (quad->position[0].X >> 4);
+    int top = yPos + (quad->position[0].Y >> 4);
+    if (quad->visible && gfxVertexSize < VERTEX_LIMIT && left > -512 && left < 872 && top > -512 && top < 752)
+    {
+        xPos <<= 4;
+        yPos <<= 4;
+        for (int i = 0; i < 4; i++)
+        {
+            gfxPolyList[(int)gfxVertexSize].position.X = (short)(xPos + quad->position[i].X);
+            gfxPolyList[(int)gfxVertexSize].position.Y = (short)(yPos + quad->position[i].Y);
+            gfxPolyList[(int)gfxVertexSize].color.R = 0xFF;
+            gfxPolyList[(int)gfxVertexSize].color.G = 0xFF;
+            gfxPolyList[(int)gfxVertexSize].color.B = 0xFF;
+            gfxPolyList[(int)gfxVertexSize].color.A = 0xFF;
+            gfxPolyList[(int)gfxVertexSize].texCoord = quad->texCoord[i];
+            gfxVertexSize += 1;
+        }
+        gfxIndexSize += 6;
+    }
+}
 void GraphicsSystem_DrawSpriteFlipped(int xPos, int yPos, int xSize, int ySize, int xBegin, int yBegin, int direction, int surfaceNum)
 {
     if (gfxSurface[surfaceNum].texStartX > -1 && gfxVertexSize < VERTEX_LIMIT && xPos > -512 && xPos < 872 && yPos > -512 && yPos < 752)
@@ -1744,6 +1789,18 @@ void GraphicsSystem_SetActivePalette(uint8_t paletteNum, int minY, int maxY)
     if (paletteNum < 8)
     {
         texPaletteNum = (int)paletteNum;
+        if (minY < 0)
+        {
+            minY = 0;
+        }
+        if (maxY > 240)
+        {
+            maxY = 240;
+        }
+        for (int i = minY; i < maxY; i++)
+        {
+            gfxLineBuffer[i] = paletteNum;
+        }
     }
 }
 void GraphicsSystem_CopyPalette(uint8_t paletteSource, uint8_t paletteDest)
@@ -1797,3 +1854,55 @@ void GraphicsSystem_GenerateBlendLookupTable()
         }
     }
 }
+void GraphicsSystem_AddInterpolationSpan(int vertexStart, int vertexEnd, int deltaX, int deltaY)
+{
+    //Deltas are in pixels, how far the vertices moved on screen over the last step
+    if (vertexEnd <= vertexStart || numInterpolationSpans >= INTERPOLATION_SPAN_LIMIT || (deltaX == 0 && deltaY == 0))
+    {
+        return;
+    }
+    //Anything that moved further than this teleported, drawing it part way there would only smear it
+    if (deltaX < -INTERPOLATION_SNAP_DISTANCE || deltaX > INTERPOLATION_SNAP_DISTANCE || deltaY < -INTERPOLATION_SNAP_DISTANCE || deltaY > INTERPOLATION_SNAP_DISTANCE)
+    {
+        return;
+    }
+    struct InterpolationSpan* span = &interpolationSpans[numInterpolationSpans];
+    span->vertexStart = (unsigned short)vertexStart;
+    span->vertexEnd = (unsigned short)vertexEnd;
+    span->deltaX = (short)(deltaX << 4);
+    span->deltaY = (short)(deltaY << 4);
+    span->offsetX = 0;
+    span->offsetY = 0;
+    numInterpolationSpans++;
+}
+void GraphicsSystem_InterpolatePolyList(float alpha)
+{
+    //The lists hold the latest step, each span is pulled back towards where it was the step before
+    for (int i = 0; i < numInterpolationSpans; i++)
+    {
+        struct InterpolationSpan* span = &interpolationSpans[i];
+        int vertexEnd = span->vertexEnd < gfxVertexSize ? span->vertexEnd : gfxVertexSize;
+        span->offsetX = (short)((alpha - 1.0f) * span->deltaX);
+        span->offsetY = (short)((alpha - 1.0f) * span->deltaY);
+        for (int v = span->vertexStart; v < vertexEnd; v++)
+        {
+            gfxPolyList[v].position.X = (short)(gfxPolyList[v].position.X + span->offsetX);
+            gfxPolyList[v].position.Y = (short)(gfxPolyList[v].position.Y + span->offsetY);
+        }
+    }
+}
+void GraphicsSystem_RestorePolyList()
+{
+    for (int i = 0; i < numInterpolationSpans; i++)
+    {
+        struct InterpolationSpan* span = &interpolationSpans[i];
+        int vertexEnd = span->vertexEnd < gfxVertexSize ? span->vertexEnd : gfxVertexSize;
+        for (int v = span->vertexStart; v < vertexEnd; v++)
+        {
+            gfxPolyList[v].position.X = (short)(gfxPolyList[v].position.X - span->offsetX);
+            gfxPolyList[v].position.Y = (short)(gfxPolyList[v].position.Y - span->offsetY);
+        }
+        span->offsetX = 0;
+        span->offsetY = 0;
+    }
+}
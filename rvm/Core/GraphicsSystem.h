@@ -13,51 +13,53 @@
 #include "PaletteEntry.h"
 #include "DrawVertex.h"
 #include "DrawVertex3D.h"
+#include "DrawBatch3D.h"
 #include "Quad2D.h"
+#include "SpriteFrame.h"
+#include "SpriteQuad.h"
 #include "FileIO.h"
 #include "GifLoader.h"
 #include "GlobalAppDefinitions.h"
 #include "Quad2D.h"
+#include "InterpolationSpan.h"
+#include "EngineContext.h"
 
 #define NUM_SPRITESHEETS 24
 #define GRAPHIC_DATASIZE 0x200000
 #define VERTEX_LIMIT 0x2000
 #define INDEX_LIMIT 0xC000
+#define SCENE_VERTEX_LIMIT 0x1000
+#define SCENE_BATCH_LIMIT 64
+#define INTERPOLATION_SPAN_LIMIT 0x800
+#define INTERPOLATION_SNAP_DISTANCE 64
 
-extern bool render3DEnabled;
-extern unsigned char fadeMode;
-extern unsigned char fadeR;
-extern unsigned char fadeG;
-extern unsigned char fadeB;
-extern unsigned char fadeA;
-extern unsigned char paletteMode;
-extern unsigned char colourMode;
-extern unsigned short texBuffer[0x100000];
-extern unsigned char texBufferMode;
-extern unsigned char tileGfx[0x40000];
-extern unsigned char graphicData[GRAPHIC_DATASIZE];
-extern struct GfxSurfaceDesc gfxSurface[NUM_SPRITESHEETS];
-extern unsigned int gfxDataPosition;
-extern struct DrawVertex gfxPolyList[VERTEX_LIMIT];
-extern struct DrawVertex3D polyList3D[6404];
-extern unsigned short gfxPolyListIndex[INDEX_LIMIT];
-extern unsigned short gfxVertexSize;
-extern unsigned short gfxVertexSizeOpaque;
-extern unsigned short gfxIndexSize;
-extern unsigned short gfxIndexSizeOpaque;
-extern unsigned short vertexSize3D;
-extern unsigned short indexSize3D;
-extern float tileUVArray[0x1000];
-extern struct Vector3 floor3DPos;
-extern float floor3DAngle;
-extern unsigned short blendLookupTable[0x2000];
-extern unsigned short subtractiveLookupTable[0x2000];
-extern struct PaletteEntry tilePalette[256];
-extern unsigned short tilePalette16_Data[8][256];
-extern int texPaletteNum;
-extern int waterDrawPos;
-extern bool videoPlaying;
-extern int currentVideoFrame;
+extern ENGINE_STATE bool render3DEnabled;
+extern ENGINE_STATE unsigned char fadeMode;
+extern ENGINE_STATE unsigned char fadeR;
+extern ENGINE_STATE unsigned char fadeG;
+extern ENGINE_STATE unsigned char fadeB;
+extern ENGINE_STATE unsigned char fadeA;
+extern ENGINE_STATE unsigned char paletteMode;
+extern ENGINE_STATE unsigned char colourMode;
+extern ENGINE_STATE unsigned char texBufferMode;
+extern ENGINE_STATE unsigned int gfxDataPosition;
+extern ENGINE_STATE unsigned short gfxVertexSize;
+extern ENGINE_STATE unsigned short gfxVertexSizeOpaque;
+extern ENGINE_STATE unsigned short gfxIndexSize;
+extern ENGINE_STATE unsigned short gfxIndexSizeOpaque;
+extern ENGINE_STATE unsigned short vertexSize3D;
+extern ENGINE_STATE unsigned short indexSize3D;
+extern ENGINE_STATE unsigned short sceneVertexSize3D;
+extern ENGINE_STATE int sceneBatchCount3D;
+extern ENGINE_STATE struct Vector3 floor3DPos;
+extern ENGINE_STATE float floor3DAngle;
+extern ENGINE_STATE int texPaletteNum;
+extern ENGINE_STATE unsigned char gfxLineBuffer[240];
+extern ENGINE_STATE int waterDrawPos;
+extern ENGINE_STATE bool videoPlaying;
+extern ENGINE_STATE int currentVideoFrame;
+extern ENGINE_STATE bool renderInterpolation;
+extern ENGINE_STATE int numInterpolationSpans;
 
 void DumpTexBuffer(void); //TODO: Test function to be deleted later
 
@@ -79,6 +81,8 @@ void GraphicsSystem_LoadStageGIFFile(int zNumber);
 void GraphicsSystem_Copy16x16Tile(int tDest, int tSource);
 void GraphicsSystem_ClearScreen(uint8_t clearColour);
 void GraphicsSystem_DrawSprite(int xPos, int yPos, int xSize, int ySize, int xBegin, int yBegin, int surfaceNum);
+void GraphicsSystem_BuildSpriteQuads(struct SpriteQuad* quads, struct SpriteFrame* frame, int surfaceNum);
+void GraphicsSystem_DrawSpriteQuad(struct SpriteQuad* quad, int xPos, int yPos);
 void GraphicsSystem_DrawSpriteFlipped(int xPos, int yPos, int xSize, int ySize, int xBegin, int yBegin, int direction, int surfaceNum);
 void GraphicsSystem_DrawBlendedSprite(int xPos, int yPos, int xSize, int ySize, int xBegin, int yBegin, int surfaceNum);
 void GraphicsSystem_DrawAlphaBlendedSprite(int xPos, int yPos, int xSize, int ySize, int xBegin, int yBegin, int alpha, int surfaceNum);
@@ -101,5 +105,8 @@ void GraphicsSystem_SetActivePalette(uint8_t paletteNum, int minY, int maxY);
 void GraphicsSystem_CopyPalette(uint8_t paletteSource, uint8_t paletteDest);
 void GraphicsSystem_RotatePalette(uint8_t pStart, uint8_t pEnd, uint8_t pDirection);
 void GraphicsSystem_GenerateBlendLookupTable(void);
+void GraphicsSystem_AddInterpolationSpan(int vertexStart, int vertexEnd, int deltaX, int deltaY);
+void GraphicsSystem_InterpolatePolyList(float alpha);
+void GraphicsSystem_RestorePolyList(void);
 
 #endif /* GraphicsSystem_h */
@@ -4,6 +4,8 @@
 //
 
 #include "InputSystem.h"
+#include "ObjectSystem.h"
+#include "EngineBuffers.h"
 
 const int BUTTON_UP = 1;
 const int BUTTON_DOWN = 2;
@@ -15,18 +17,27 @@ const int BUTTON_C = 64;
 const int BUTTON_START = 128;
 const int ALL_BUTTONS = 255;
 const int NO_BUTTONS = 0;
-int touchWidth;
-int touchHeight;
-bool touchControls;
-struct InputResult inputPress;
-struct InputResult touchData;
-SDL_GameController* sdlController;
+const int REPLAY_OFF = 0;
+const int REPLAY_RECORD = 1;
+const int REPLAY_PLAYBACK = 2;
+ENGINE_STATE int touchWidth;
+ENGINE_STATE int touchHeight;
+ENGINE_STATE bool touchControls;
+ENGINE_STATE struct InputResult inputPress;
+ENGINE_STATE struct InputResult touchData;
+ENGINE_STATE SDL_GameController* sdlController;
+ENGINE_STATE uint8_t replayMode;
+ENGINE_STATE uint8_t replayButtons;
+ENGINE_STATE unsigned short replayRunLength;
+ENGINE_STATE FILE* replayFile;
 
 void Init_InputSystem()
 {
     touchControls = false;
     sdlController = NULL;
-    if(SDL_NumJoysticks() > 0)
+    replayMode = REPLAY_OFF;
+    replayFile = NULL;
+    if(!engineHeadless && SDL_NumJoysticks() > 0)
     {
         for (int i = 0; i < SDL_NumJoysticks(); ++i) {
             if (SDL_IsGameController(i)) {
@@ -439,3 +450,105 @@ void InputSystem_CheckKeyPress(struct InputResult* gameInput, uint8_t keyFlags)
         }
     }
 }
+
+bool InputSystem_StartRecording(const char* filePath, uint32_t seed)
+{
+    //Replays start with "RVMR" and the random seed, followed by runs of [buttons, length lo, length hi]
+    uint8_t header[8] = { 'R', 'V', 'M', 'R', (uint8_t)seed, (uint8_t)(seed >> 8), (uint8_t)(seed >> 16), (uint8_t)(seed >> 24) };
+    InputSystem_StopReplay();
+    replayFile = fopen(filePath, "wb");
+    if (replayFile == NULL)
+    {
+        return false;
+    }
+    fwrite(header, 1, 8, replayFile);
+    ObjectSystem_SetRandomSeed(seed);
+    replayButtons = 0;
+    replayRunLength = 0;
+    replayMode = REPLAY_RECORD;
+    return true;
+}
+
+bool InputSystem_StartPlayback(const char* filePath)
+{
+    uint8_t header[8];
+    InputSystem_StopReplay();
+    replayFile = fopen(filePath, "rb");
+    if (replayFile == NULL)
+    {
+        return false;
+    }
+    if (fread(header, 1, 8, replayFile) != 8 || memcmp(header, "RVMR", 4) != 0)
+    {
+        fclose(replayFile);
+        replayFile = NULL;
+        return false;
+    }
+    ObjectSystem_SetRandomSeed((uint32_t)header[4] | (uint32_t)header[5] << 8 | (uint32_t)header[6] << 16 | (uint32_t)header[7] << 24);
+    replayRunLength = 0;
+    replayMode = REPLAY_PLAYBACK;
+    return true;
+}
+
+void InputSystem_StopReplay()
+{
+    uint8_t run[3];
+    if (replayFile == NULL)
+    {
+        return;
+    }
+    if (replayMode == REPLAY_RECORD && replayRunLength > 0)
+    {
+        run[0] = replayButtons;
+        run[1] = (uint8_t)replayRunLength;
+        run[2] = (uint8_t)(replayRunLength >> 8);
+        fwrite(run, 1, 3, replayFile);
+    }
+    fclose(replayFile);
+    replayFile = NULL;
+    replayMode = REPLAY_OFF;
+}
+
+void InputSystem_UpdateReplay()
+{
+    //Call once per frame, after the keyboard and gamepad have been read
+    uint8_t run[3];
+    uint8_t buttons;
+    if (replayMode == REPLAY_RECORD)
+    {
+        buttons = (uint8_t)((touchData.up ? BUTTON_UP : 0) | (touchData.down ? BUTTON_DOWN : 0) | (touchData.left ? BUTTON_LEFT : 0) | (touchData.right ? BUTTON_RIGHT : 0) | (touchData.buttonA ? BUTTON_A : 0) | (touchData.buttonB ? BUTTON_B : 0) | (touchData.buttonC ? BUTTON_C : 0) | (touchData.start ? BUTTON_START : 0));
+        if (replayRunLength > 0 && (buttons != replayButtons || replayRunLength == 0xffff))
+        {
+            run[0] = replayButtons;
+            run[1] = (uint8_t)replayRunLength;
+            run[2] = (uint8_t)(replayRunLength >> 8);
+            fwrite(run, 1, 3, replayFile);
+            replayRunLength = 0;
+        }
+        replayButtons = buttons;
+        replayRunLength++;
+    }
+    else if (replayMode == REPLAY_PLAYBACK)
+    {
+        while (replayRunLength == 0)
+        {
+            if (fread(run, 1, 3, replayFile) != 3)
+            {
+                //End of the replay, hand control back to the player
+                InputSystem_StopReplay();
+                return;
+            }
+            replayButtons = run[0];
+            replayRunLength = (unsigned short)(run[1] | run[2] << 8);
+        }
+        touchData.up = (replayButtons & BUTTON_UP) != 0;
+        touchData.down = (replayButtons & BUTTON_DOWN) != 0;
+        touchData.left = (replayButtons & BUTTON_LEFT) != 0;
+        touchData.right = (replayButtons & BUTTON_RIGHT) != 0;
+        touchData.buttonA = (replayButtons & BUTTON_A) != 0;
+        touchData.buttonB = (replayButtons & BUTTON_B) != 0;
+        touchData.buttonC = (replayButtons & BUTTON_C) != 0;
+        touchData.start = (replayButtons & BUTTON_START) != 0;
+        replayRunLength--;
+    }
+}
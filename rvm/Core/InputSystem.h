@@ -11,9 +11,12 @@
 #include "InputResult.h"
 #include "GlobalAppDefinitions.h"
 #include "SDL.h"
+#include "EngineContext.h"
 
-extern int touchWidth;
-extern int touchHeight;
+extern const int REPLAY_PLAYBACK;
+extern ENGINE_STATE int touchWidth;
+extern ENGINE_STATE int touchHeight;
+extern ENGINE_STATE uint8_t replayMode;
 
 void Init_InputSystem(void);
 void InputSystem_Dispose(void);
@@ -26,5 +29,9 @@ void InputSystem_CheckGamepadInput(void);
 void InputSystem_CheckKeyDown(struct InputResult* gameInput, uint8_t keyFlags);
 void InputSystem_MenuKeyDown(struct InputResult* gameInput, uint8_t keyFlags);
 void InputSystem_CheckKeyPress(struct InputResult* gameInput, uint8_t keyFlags);
+bool InputSystem_StartRecording(const char* filePath, uint32_t seed);
+bool InputSystem_StartPlayback(const char* filePath);
+void InputSystem_StopReplay(void);
+void InputSystem_UpdateReplay(void);
 
 #endif /* InputSystem_h */
@@ -0,0 +1,20 @@
+//
+//  InterpolationSpan.h
+//  rvm
+//
+
+#ifndef InterpolationSpan_h
+#define InterpolationSpan_h
+
+#include "SDL.h"
+
+struct InterpolationSpan {
+    unsigned short vertexStart;
+    unsigned short vertexEnd;
+    short deltaX;
+    short deltaY;
+    short offsetX;
+    short offsetY;
+};
+
+#endif /* InterpolationSpan_h */
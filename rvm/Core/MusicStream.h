@@ -0,0 +1,22 @@
+//
+//  MusicStream.h
+//  rvm
+//
+
+#ifndef MusicStream_h
+#define MusicStream_h
+
+#include "SDL.h"
+#include "FileStream.h"
+
+struct MusicStream {
+    struct FileStream file;
+    uint8_t* commentPage;
+    uint32_t commentPageStart;
+    uint32_t commentPageLength;
+    int commentPageDelta;
+    uint32_t size;
+    uint32_t position;
+};
+
+#endif /* MusicStream_h */
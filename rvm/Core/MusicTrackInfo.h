@@ -12,7 +12,6 @@ struct MusicTrackInfo {
     char trackName[64];
     bool loop;
     unsigned int loopPoint;
-    unsigned char* musicData;
     Mix_Music* mixerAudio;
 };
 
@@ -5,19 +5,16 @@
 #ifndef ObjectEntity_h
 #define ObjectEntity_h
 
+//xPos, yPos, type, priority and drawOrder live in the dense objectEntity* arrays in ObjectSystem
+//so the per-frame activation scan doesn't have to walk the whole entity table
 struct ObjectEntity {
-    int xPos;
-    int yPos;
     int value[8];
     int scale;
     int rotation;
     int animationTimer;
     int animationSpeed;
-    unsigned char type;
     unsigned char propertyValue;
     unsigned char state;
-    unsigned char priority;
-    unsigned char drawOrder;
     unsigned char direction;
     unsigned char inkEffect;
     unsigned char alpha;
@@ -22,6 +22,12 @@ struct ObjectScript{
     int startupJumpTable;
     int frameListOffset;
     struct AnimationFileList* animationFile;
+    uint8_t interactionBounds;
+    uint8_t interactionType;
+    int interactionLeft;
+    int interactionTop;
+    int interactionRight;
+    int interactionBottom;
 };
 
 #endif /* ObjectScript_h */
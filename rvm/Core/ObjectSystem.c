@@ -4,6 +4,7 @@
 //
 
 #include "ObjectSystem.h"
+#include "EngineBuffers.h"
 
 const int SUB_MAIN = 0;
 const int SUB_PLAYER = 1;
@@ -16,35 +17,44 @@ const int NUM_VARIABLE_NAMES = 229;
 const int NUM_CONSTANTS = 31;
 const int SCRIPT_DATA_SIZE = 0x40000;
 const int JUMP_TABLE_SIZE = 0x4000;
-int scriptData[0x40000];
-int scriptDataPos;
-int scriptDataOffset;
-int scriptLineNumber;
-int jumpTableData[0x4000];
-int jumpTableDataPos;
-int jumpTableOffset;
-int jumpTableStack[0x400];
-int jumpTableStackPos;
-int NUM_FUNCTIONS;
-int functionStack[0x400];
-int functionStackPos;
-struct SpriteFrame scriptFrames[0x1000];
-int scriptFramesNo;
-uint8_t NO_GLOBALVARIABLES;
-char globalVariableNames[0x100][32];
-int globalVariables[0x100];
-int objectLoop;
-struct ScriptEngine scriptEng;
-char scriptText[0x100];
-struct ObjectScript objectScriptList[0x100];
-struct FunctionScript functionScriptList[0x200];
-struct ObjectEntity objectEntityList[0x4A0];
-struct ObjectDrawList objectDrawOrderList[7];
-int playerNum;
-struct CollisionSensor object_cSensor[6];
+ENGINE_STATE int scriptDataPos;
+ENGINE_STATE int scriptDataOffset;
+ENGINE_STATE int scriptLineNumber;
+ENGINE_STATE int jumpTableDataPos;
+ENGINE_STATE int jumpTableOffset;
+ENGINE_STATE int jumpTableStackPos;
+ENGINE_STATE int NUM_FUNCTIONS;
+ENGINE_STATE int functionStackPos;
+ENGINE_STATE int scriptFramesNo;
+ENGINE_STATE uint8_t NO_GLOBALVARIABLES;
+ENGINE_STATE int objectLoop;
+ENGINE_STATE struct ScriptEngine scriptEng;
+ENGINE_STATE bool objectDrawnInWorld;
+ENGINE_STATE int playerNum;
+ENGINE_STATE uint32_t randomState;
+ENGINE_STATE bool objectBroadphase;
+ENGINE_STATE unsigned int playerScriptCalls;
+ENGINE_STATE unsigned int playerScriptSkips;
+ENGINE_STATE int tempObjectPoolSize;
+ENGINE_STATE uint32_t tempObjectFreeMap[TEMP_OBJECT_COUNT >> 5];
+ENGINE_STATE int tempObjectFreeCount;
+ENGINE_STATE int tempObjectPeak;
+ENGINE_STATE unsigned int tempObjectEvictions;
+ENGINE_STATE bool compiledScriptsEnabled = true;
+ENGINE_STATE const struct CompiledScriptModule* compiledScriptModule;
+ENGINE_STATE struct ScriptSuperInstruction superInstructions[SUPERINSTRUCTION_COUNT];
+ENGINE_STATE int numSuperInstructions;
+ENGINE_STATE int numSuperInstructionSites;
+ENGINE_STATE bool scriptProfileEnabled;
+ENGINE_STATE int numScriptNGrams;
+ENGINE_STATE int scriptProfileHistory[2];
+ENGINE_STATE int scriptProfileHistoryLength;
+ENGINE_STATE int scriptProfileNext;
+ENGINE_STATE unsigned int scriptInstructionCount;
+ENGINE_STATE unsigned int scriptDispatchCount;
+ENGINE_STATE int numScriptStageProfiles;
+ENGINE_STATE struct CollisionSensor object_cSensor[6];
 
-char functionNames[0x200][32];
-char typeNames[0x100][32];
 signed char scriptOpcodeSizes[] = { 0, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
     1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 2, 0, 0, 2, 2, 2, 2,
     2, 5, 5, 3, 4, 7, 1, 1, 1, 3, 3, 4, 7, 7, 3, 6, 6, 5, 3, 4, 3, 7, 2, 1, 4, 4, 1,
@@ -59,14 +69,56 @@ void Init_ObjectSystem()
     jumpTableStackPos = 0;
     functionStackPos = 0;
     scriptFramesNo = 0;
+    tempObjectPoolSize = TEMP_OBJECT_COUNT;
+    tempObjectPeak = 0;
+    tempObjectEvictions = 0;
+    ObjectSystem_ResetTempObjects();
     time_t t;
-    srand((unsigned) time(&t));
+    ObjectSystem_SetRandomSeed((uint32_t)time(&t));
+}
+
+int ObjectSystem_AllocTempObject()
+{
+    //Keeps the old ring order (reuse the last slot if it is free, otherwise the next one along) but
+    //skips live objects instead of overwriting them. Only a full pool evicts, and that gets counted.
+    int slot = scriptEng.arrayPosition[2] - TEMP_OBJECT_START;
+    int occupied;
+    if (slot < 0 || slot >= tempObjectPoolSize)
+    {
+        slot = 0;
+    }
+    if (objectEntityType[TEMP_OBJECT_START + slot] > 0)
+    {
+        int next = slot + 1 == tempObjectPoolSize ? 0 : slot + 1;
+        slot = ObjectSystem_FindFreeTempObject(next);
+        if (slot < 0)
+        {
+            //A script may have cleared an object through a path that never marked it, so recount before giving up
+            ObjectSystem_ResetTempObjects();
+            slot = ObjectSystem_FindFreeTempObject(next);
+        }
+        if (slot < 0)
+        {
+            slot = next;
+            tempObjectEvictions++;
+        }
+    }
+    occupied = tempObjectPoolSize - tempObjectFreeCount;
+    if (objectEntityType[TEMP_OBJECT_START + slot] == 0)
+    {
+        occupied++;
+    }
+    if (occupied > tempObjectPeak)
+    {
+        tempObjectPeak = occupied;
+    }
+    return TEMP_OBJECT_START + slot;
 }
 
 void ObjectSystem_BasicCollision(int cLeft, int cTop, int cRight, int cBottom)
 {
     struct PlayerObject* playerObject = &playerList[playerNum];
-    struct CollisionBox* collisionBox = &collisionBoxList[playerObject->animationFile->cbListOffset + animationFrames[animationList[playerObject->animationFile->aniListOffset + playerObject->objectPtr->animation].frameListOffset + playerObject->objectPtr->frame].collisionBox];
+    struct CollisionBox* collisionBox = PlayerSystem_GetCollisionBox(playerObject);
     collisionLeft = playerObject->xPos >> 16;
     collisionTop = playerObject->yPos >> 16;
     collisionRight = collisionLeft;
@@ -83,11 +135,55 @@ void ObjectSystem_BasicCollision(int cLeft, int cTop, int cRight, int cBottom)
     scriptEng.checkResult = 0;
 }
 
+void ObjectSystem_BindCompiledScripts()
+{
+    //Modules are keyed by a hash of everything the stage loaded, so compiled code only ever runs
+    //against the exact bytecode and jump tables it was generated from
+    uint64_t hash = 0xcbf29ce484222325ull;
+    int i;
+    int j;
+    compiledScriptModule = NULL;
+    memset(compiledScriptTable, 0, sizeof(compiledScriptTable));
+    if (!compiledScriptsEnabled || numCompiledScriptModules == 0)
+    {
+        return;
+    }
+    for (i = 0; i < scriptDataPos; i++)
+    {
+        hash = (hash ^ (uint32_t)scriptData[i]) * 0x100000001b3ull;
+    }
+    for (i = 0; i < jumpTableDataPos; i++)
+    {
+        hash = (hash ^ (uint32_t)jumpTableData[i]) * 0x100000001b3ull;
+    }
+    for (i = 0; i < numCompiledScriptModules; i++)
+    {
+        if (compiledScriptModules[i]->hash == hash && compiledScriptModules[i]->numEntries <= (COMPILED_SCRIPT_TABLE_SIZE >> 1))
+        {
+            compiledScriptModule = compiledScriptModules[i];
+            break;
+        }
+    }
+    if (compiledScriptModule == NULL)
+    {
+        return;
+    }
+    for (i = 0; i < compiledScriptModule->numEntries; i++)
+    {
+        j = (int)(((uint32_t)compiledScriptModule->entries[i].scriptCodePtr * 0x9e3779b1u) >> 20);
+        while (compiledScriptTable[j] != NULL)
+        {
+            j = (j + 1) & (COMPILED_SCRIPT_TABLE_SIZE - 1);
+        }
+        compiledScriptTable[j] = &compiledScriptModule->entries[i];
+    }
+}
+
 void ObjectSystem_BoxCollision(int cLeft, int cTop, int cRight, int cBottom)
 {
     int i = 0;
     struct PlayerObject* playerObject = &playerList[playerNum];
-    struct CollisionBox* collisionBox = &collisionBoxList[playerObject->animationFile->cbListOffset + animationFrames[animationList[playerObject->animationFile->aniListOffset + playerObject->objectPtr->animation].frameListOffset + playerObject->objectPtr->frame].collisionBox];
+    struct CollisionBox* collisionBox = PlayerSystem_GetCollisionBox(playerObject);
     collisionLeft = collisionBox->left[0];
     collisionTop = collisionBox->top[0];
     collisionRight = collisionBox->right[0];
@@ -359,6 +455,19 @@ void ObjectSystem_BoxCollision(int cLeft, int cTop, int cRight, int cBottom)
     }
 }
 
+int ObjectSystem_CallFunctionScript(int functionNum, int scriptSub)
+{
+    //Compiled callers push their return position the same way opcode 105 does, so an interpreted
+    //function can return straight into the interpreter and finish the caller from there
+    struct FunctionScript* functionScript = &functionScriptList[functionNum];
+    CompiledScript compiledScript = ObjectSystem_FindCompiledScript(functionScript->mainScript, functionScript->mainJumpTable);
+    if (compiledScript != NULL)
+    {
+        return compiledScript(scriptSub);
+    }
+    return ObjectSystem_RunScript(functionScript->mainScript, functionScript->mainJumpTable, functionScript->mainScript, scriptSub);
+}
+
 void ObjectSystem_ClearScriptData()
 {
     int i;
@@ -375,6 +484,9 @@ void ObjectSystem_ClearScriptData()
     jumpTableDataPos = 0;
     scriptFramesNo = 0;
     NUM_FUNCTIONS = 0;
+    numSuperInstructionSites = 0;
+    compiledScriptModule = NULL;
+    memset(compiledScriptTable, 0, sizeof(compiledScriptTable));
     AnimationSystem_ClearAnimationData();
     for (i = 0; i < 2; i++)
     {
@@ -395,6 +507,7 @@ void ObjectSystem_ClearScriptData()
         objectScriptList[i].numFrames = 0;
         objectScriptList[i].surfaceNum = 0;
         objectScriptList[i].animationFile = AnimationSystem_GetDefaultAnimationRef();
+        objectScriptList[i].interactionBounds = 0;
         functionScriptList[i].mainScript = 0x3ffff;
         functionScriptList[i].mainJumpTable = 0x3fff;
         typeNames[i][0] = '\0';
@@ -402,5554 +515,4638 @@ void ObjectSystem_ClearScriptData()
     ObjectSystem_SetObjectTypeName(charArray, 0);
 }
 
+void ObjectSystem_CountNGram(uint32_t key)
+{
+    int i = (int)((key * 0x9e3779b1u) >> 19);
+    while (scriptNGrams[i].key != key)
+    {
+        if (scriptNGrams[i].key == 0)
+        {
+            //Keep a quarter of the table free so lookups stay short, new sequences are dropped after that
+            if (numScriptNGrams >= SCRIPT_NGRAM_TABLE_SIZE - (SCRIPT_NGRAM_TABLE_SIZE >> 2))
+            {
+                return;
+            }
+            scriptNGrams[i].key = key;
+            numScriptNGrams++;
+            break;
+        }
+        i = (i + 1) & (SCRIPT_NGRAM_TABLE_SIZE - 1);
+    }
+    scriptNGrams[i].count++;
+}
+
 void ObjectSystem_DrawObjectList(int DrawListNo)
 {
     int num = objectDrawOrderList[DrawListNo].listSize;
     for (int i = 0; i < num; i++)
     {
         objectLoop = objectDrawOrderList[DrawListNo].entityRef[i];
-        if (objectEntityList[objectLoop].type > 0)
+        if (objectEntityType[objectLoop] > 0)
         {
             playerNum = 0;
-            if (scriptData[objectScriptList[objectEntityList[objectLoop].type].drawScript] > 0)
+            if (scriptData[objectScriptList[objectEntityType[objectLoop]].drawScript] > 0)
             {
-                ObjectSystem_ProcessScript(objectScriptList[objectEntityList[objectLoop].type].drawScript, objectScriptList[objectEntityList[objectLoop].type].drawJumpTable, 2);
+                int vertexStart = gfxVertexSize;
+                objectDrawnInWorld = false;
+                ObjectSystem_ProcessScript(objectScriptList[objectEntityType[objectLoop]].drawScript, objectScriptList[objectEntityType[objectLoop]].drawJumpTable, 2);
+                if (renderInterpolation && objectDrawnInWorld)
+                {
+                    //Only world space sprites follow the object, HUD and screen effects stay put
+                    int deltaX = ((objectEntityXPos[objectLoop] >> 16) - xScrollOffset) - ((objectEntityPrevXPos[objectLoop] >> 16) - prevXScrollOffset);
+                    int deltaY = ((objectEntityYPos[objectLoop] >> 16) - yScrollOffset) - ((objectEntityPrevYPos[objectLoop] >> 16) - prevYScrollOffset);
+                    GraphicsSystem_AddInterpolationSpan(vertexStart, gfxVertexSize, deltaX, deltaY);
+                }
             }
         }
     }
 }
 
-void ObjectSystem_LoadByteCodeFile(int fileType, int scriptNum)
+int ObjectSystem_ExecuteOpcode(int opcode, int scriptSub)
 {
-    int num;
-    int num1;
-    int i;
-    uint8_t num2;
-    struct FileData fileDatum;
-    char charArray[] = "Data/Scripts/ByteCode/";
-    char chrArray[] = ".bin";
-    FileIO_StrCopy(scriptText, sizeof(scriptText), charArray, sizeof(charArray));
-    switch (fileType)
+    int num5 = scriptOpcodeSizes[opcode];
+    switch (opcode)
     {
-        case PRESENTATION_STAGE:
+        case 1:
         {
-            if(useOldSdkLayout){
-                sprintf(scriptText,"%sPS%03d.bin",scriptText,stageListPosition);
+            scriptEng.operands[0] = scriptEng.operands[1];
+            break;
+        }
+        case 2:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] + scriptEng.operands[1];
+            break;
+        }
+        case 3:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] - scriptEng.operands[1];
+            break;
+        }
+        case 4:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] + 1;
+            break;
+        }
+        case 5:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] - 1;
+            break;
+        }
+        case 6:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] * scriptEng.operands[1];
+            break;
+        }
+        case 7:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] / scriptEng.operands[1];
+            break;
+        }
+        case 8:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] >> (scriptEng.operands[1] & 31);
+            break;
+        }
+        case 9:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] << (scriptEng.operands[1] & 31);
+            break;
+        }
+        case 10:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] & scriptEng.operands[1];
+            break;
+        }
+        case 11:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] | scriptEng.operands[1];
+            break;
+        }
+        case 12:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] ^ scriptEng.operands[1];
+            break;
+        }
+        case 13:
+        {
+            scriptEng.operands[0] = scriptEng.operands[0] % scriptEng.operands[1];
+            break;
+        }
+        case 14:
+        {
+            scriptEng.operands[0] = -scriptEng.operands[0];
+            break;
+        }
+        case 15:
+        {
+            if (scriptEng.operands[0] != scriptEng.operands[1])
+            {
+                scriptEng.checkResult = 0;
             }
-            else{
-                FileIO_StrAdd(scriptText, sizeof(scriptText), pStageList[stageListPosition].stageFolderName, sizeof(pStageList[stageListPosition].stageFolderName));
-                FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            else
+            {
+                scriptEng.checkResult = 1;
             }
+            num5 = 0;
             break;
         }
-        case ZONE_STAGE:
+        case 16:
         {
-            if(useOldSdkLayout){
-                sprintf(scriptText,"%sRS%03d.bin",scriptText,stageListPosition);
+            if (scriptEng.operands[0] <= scriptEng.operands[1])
+            {
+                scriptEng.checkResult = 0;
             }
-            else{
-                FileIO_StrAdd(scriptText, sizeof(scriptText), zStageList[stageListPosition].stageFolderName, sizeof(zStageList[stageListPosition].stageFolderName));
-                FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            else
+            {
+                scriptEng.checkResult = 1;
             }
+            num5 = 0;
             break;
         }
-        case BONUS_STAGE:
+        case 17:
         {
-            FileIO_StrAdd(scriptText, sizeof(scriptText), bStageList[stageListPosition].stageFolderName, sizeof(bStageList[stageListPosition].stageFolderName));
-            FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            if (scriptEng.operands[0] >= scriptEng.operands[1])
+            {
+                scriptEng.checkResult = 0;
+            }
+            else
+            {
+                scriptEng.checkResult = 1;
+            }
+            num5 = 0;
             break;
         }
-        case SPECIAL_STAGE:
+        case 18:
         {
-            if(useOldSdkLayout){
-                sprintf(scriptText,"%sSS%03d.bin",scriptText,stageListPosition);
+            if (scriptEng.operands[0] == scriptEng.operands[1])
+            {
+                scriptEng.checkResult = 0;
             }
-            else{
-                FileIO_StrAdd(scriptText, sizeof(scriptText), sStageList[stageListPosition].stageFolderName, sizeof(sStageList[stageListPosition].stageFolderName));
-                FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            else
+            {
+                scriptEng.checkResult = 1;
             }
+            num5 = 0;
             break;
         }
-        case 4:
+        case 37:
         {
-            if(useOldSdkLayout){
-                sprintf(scriptText,"%sGS000.bin", scriptText);
+            scriptEng.operands[0] = ObjectSystem_Random() % scriptEng.operands[1];
+            break;
+        }
+        case 38:
+        {
+            scriptEng.sRegister = scriptEng.operands[1];
+            if (scriptEng.sRegister < 0)
+            {
+                scriptEng.sRegister = 0x200 - scriptEng.sRegister;
             }
-            else{
-                sprintf(scriptText,"%sGlobalCode.bin", scriptText);
+            scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
+            scriptEng.operands[0] = SinValue512[scriptEng.sRegister];
+            break;
+        }
+        case 39:
+        {
+            scriptEng.sRegister = scriptEng.operands[1];
+            if (scriptEng.sRegister < 0)
+            {
+                scriptEng.sRegister = 0x200 - scriptEng.sRegister;
             }
+            scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
+            scriptEng.operands[0] = CosValue512[scriptEng.sRegister];
             break;
         }
-    }
-    if (FileIO_LoadFile(scriptText, &fileDatum))
-    {
-        int num3 = scriptDataPos;
-        uint8_t num4 = FileIO_ReadByte();
-        int num5 = num4;
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 8);
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 16);
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 24);
-        while (num5 > 0)
+        case 40:
         {
-            num4 = FileIO_ReadByte();
-            num2 = (uint8_t)(num4 & 127);
-            if (num4 >= 128)
+            scriptEng.sRegister = scriptEng.operands[1];
+            if (scriptEng.sRegister < 0)
             {
-                while (num2 > 0)
-                {
-                    num4 = FileIO_ReadByte();
-                    num = num4;
-                    num4 = FileIO_ReadByte();
-                    num = num + (num4 << 8);
-                    num4 = FileIO_ReadByte();
-                    num = num + (num4 << 16);
-                    num4 = FileIO_ReadByte();
-                    num = num + (num4 << 24);
-                    scriptData[num3] = num;
-                    num3++;
-                    scriptDataPos = scriptDataPos + 1;
-                    num5--;
-                    num2 = (uint8_t)(num2 - 1);
-                }
+                scriptEng.sRegister = 0x100 - scriptEng.sRegister;
             }
-            else
+            scriptEng.sRegister = scriptEng.sRegister & 0xff;
+            scriptEng.operands[0] = SinValue256[scriptEng.sRegister];
+            break;
+        }
+        case 41:
+        {
+            scriptEng.sRegister = scriptEng.operands[1];
+            if (scriptEng.sRegister < 0)
             {
-                while (num2 > 0)
-                {
-                    num4 = FileIO_ReadByte();
-                    scriptData[num3] = num4;
-                    num3++;
-                    scriptDataPos = scriptDataPos + 1;
-                    num5--;
-                    num2 = (uint8_t)(num2 - 1);
-                }
+                scriptEng.sRegister = 0x100 - scriptEng.sRegister;
             }
+            scriptEng.sRegister = scriptEng.sRegister & 0xff;
+            scriptEng.operands[0] = CosValue256[scriptEng.sRegister];
+            break;
         }
-        num3 = jumpTableDataPos;
-        num4 = FileIO_ReadByte();
-        num5 = num4;
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 8);
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 16);
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 24);
-        while (num5 > 0)
+        case 42:
         {
-            num4 = FileIO_ReadByte();
-            num2 = (uint8_t)(num4 & 127);
-            if (num4 >= 128)
+            scriptEng.sRegister = scriptEng.operands[1];
+            if (scriptEng.sRegister < 0)
             {
-                while (num2 > 0)
-                {
-                    num4 = FileIO_ReadByte();
-                    num = num4;
-                    num4 = FileIO_ReadByte();
-                    num = num + (num4 << 8);
-                    num4 = FileIO_ReadByte();
-                    num = num + (num4 << 16);
-                    num4 = FileIO_ReadByte();
-                    num = num + (num4 << 24);
-                    jumpTableData[num3] = num;
-                    num3++;
-                    jumpTableDataPos = jumpTableDataPos + 1;
-                    num5--;
-                    num2 = (uint8_t)(num2 - 1);
-                }
+                scriptEng.sRegister = 0x200 - scriptEng.sRegister;
             }
-            else
+            scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
+            scriptEng.operands[0] = (SinValue512[scriptEng.sRegister] >> (scriptEng.operands[2] & 31)) + scriptEng.operands[3] - scriptEng.operands[4];
+            break;
+        }
+        case 43:
+        {
+            scriptEng.sRegister = scriptEng.operands[1];
+            if (scriptEng.sRegister < 0)
             {
-                while (num2 > 0)
-                {
-                    num4 = FileIO_ReadByte();
-                    jumpTableData[num3] = num4;
-                    num3++;
-                    jumpTableDataPos = jumpTableDataPos + 1;
-                    num5--;
-                    num2 = (uint8_t)(num2 - 1);
-                }
+                scriptEng.sRegister = 0x200 - scriptEng.sRegister;
             }
+            scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
+            scriptEng.operands[0] = (CosValue512[scriptEng.sRegister] >> (scriptEng.operands[2] & 31)) + scriptEng.operands[3] - scriptEng.operands[4];
+            break;
         }
-        num4 = FileIO_ReadByte();
-        num5 = num4;
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 8);
-        num = scriptNum;
-        for (i = num5; i > 0; i--)
+        case 44:
         {
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].mainScript = num1;
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].playerScript = num1;
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].drawScript = num1;
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].startupScript = num1;
-            num++;
+            scriptEng.operands[0] = GlobalAppDefinitions_ArcTanLookup(scriptEng.operands[1], scriptEng.operands[2]);
+            break;
         }
-        num = scriptNum;
-        for (i = num5; i > 0; i--)
+        case 45:
         {
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].mainJumpTable = num1;
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].playerJumpTable = num1;
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].drawJumpTable = num1;
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            objectScriptList[num].startupJumpTable = num1;
-            num++;
+            scriptEng.operands[0] = (scriptEng.operands[1] * scriptEng.operands[3] + scriptEng.operands[2] * (0x100 - scriptEng.operands[3])) >> 8;
+            break;
         }
-        num4 = FileIO_ReadByte();
-        num5 = num4;
-        num4 = FileIO_ReadByte();
-        num5 = num5 + (num4 << 8);
-        num = 0;
-        for (i = num5; i > 0; i--)
+        case 46:
         {
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            functionScriptList[num].mainScript = num1;
-            num++;
+            scriptEng.operands[0] = (scriptEng.operands[2] * scriptEng.operands[6] >> 8) + (scriptEng.operands[3] * (0x100 - scriptEng.operands[6]) >> 8);
+            scriptEng.operands[1] = (scriptEng.operands[4] * scriptEng.operands[6] >> 8) + (scriptEng.operands[5] * (0x100 - scriptEng.operands[6]) >> 8);
+            break;
         }
-        num = 0;
-        for (i = num5; i > 0; i--)
+        case 47:
         {
-            num4 = FileIO_ReadByte();
-            num1 = num4;
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 8);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 16);
-            num4 = FileIO_ReadByte();
-            num1 = num1 + (num4 << 24);
-            functionScriptList[num].mainJumpTable = num1;
-            num++;
+            num5 = 0;
+            objectScriptList[objectEntityType[objectLoop]].surfaceNum = GraphicsSystem_AddGraphicsFile(scriptText);
+            ObjectSystem_UpdateScriptQuads((int)objectEntityType[objectLoop]);
+            break;
         }
-        FileIO_CloseFile();
-    }
-}
-
-void ObjectSystem_ObjectFloorCollision(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
-    {
-        int num3 = num1 >> 7;
-        int num4 = (num1 & 127) >> 4;
-        int num5 = num2 >> 7;
-        int num6 = (num2 & 127) >> 4;
-        int num7 = stageLayouts[0].tileMap[num3 + (num5 << 8)] << 6;
-        num7 = num7 + num4 + (num6 << 3);
-        int num8 = tile128x128.tile16x16[num7];
-        if (tile128x128.collisionFlag[cPlane][num7] != 2 && tile128x128.collisionFlag[cPlane][num7] != 3)
+        case 48:
+        {
+            num5 = 0;
+            GraphicsSystem_RemoveGraphicsFile(scriptText, -1);
+            break;
+        }
+        case 49:
+        {
+            num5 = 0;
+            objectDrawnInWorld = true;
+            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2], (objectEntityXPos[objectLoop] >> 16) - xScrollOffset, (objectEntityYPos[objectLoop] >> 16) - yScrollOffset);
+            break;
+        }
+        case 50:
+        {
+            num5 = 0;
+            objectDrawnInWorld = true;
+            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2], (scriptEng.operands[1] >> 16) - xScrollOffset, (scriptEng.operands[2] >> 16) - yScrollOffset);
+            break;
+        }
+        case 51:
+        {
+            num5 = 0;
+            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2], scriptEng.operands[1], scriptEng.operands[2]);
+            break;
+        }
+        case 52:
         {
-            switch (tile128x128.direction[num7])
+            num5 = 0;
+            GraphicsSystem_DrawTintRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+            break;
+        }
+        case 53:
+        {
+            num5 = 0;
+            scriptEng.operands[7] = 10;
+            if (scriptEng.operands[6] != 0)
             {
-                case 0:
+                while (scriptEng.operands[4] > 0)
                 {
-                    num = (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) <= tileCollisions[cPlane].floorMask[num])
-                    {
-                        break;
-                    }
-                    num2 = tileCollisions[cPlane].floorMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
+                    scriptEng.sRegister = (scriptEng.operands[3] - scriptEng.operands[3] / scriptEng.operands[7] * scriptEng.operands[7]) / (scriptEng.operands[7] / 10);
+                    scriptEng.sRegister = scriptEng.sRegister + scriptEng.operands[0];
+                    GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.sRegister) << 2], scriptEng.operands[1], scriptEng.operands[2]);
+                    scriptEng.operands[1] = scriptEng.operands[1] - scriptEng.operands[5];
+                    scriptEng.operands[7] = scriptEng.operands[7] * 10;
+                    scriptEng.operands[4] = scriptEng.operands[4] - 1;
                 }
-                case 1:
+                break;
+            }
+            else
+            {
+                if (scriptEng.operands[3] != 0)
                 {
-                    num = 15 - (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) <= tileCollisions[cPlane].floorMask[num])
-                    {
-                        break;
-                    }
-                    num2 = tileCollisions[cPlane].floorMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
+                    scriptEng.operands[8] = scriptEng.operands[3] * 10;
                 }
-                case 2:
+                else
                 {
-                    num = (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) <= 15 - tileCollisions[cPlane].roofMask[num])
-                    {
-                        break;
-                    }
-                    num2 = 15 - tileCollisions[cPlane].roofMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
+                    scriptEng.operands[8] = 10;
                 }
-                case 3:
+                while (scriptEng.operands[4] > 0)
                 {
-                    num = 15 - (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) <= 15 - tileCollisions[cPlane].roofMask[num])
+                    if (scriptEng.operands[8] >= scriptEng.operands[7])
                     {
-                        break;
+                        scriptEng.sRegister = (scriptEng.operands[3] - scriptEng.operands[3] / scriptEng.operands[7] * scriptEng.operands[7]) / (scriptEng.operands[7] / 10);
+                        scriptEng.sRegister = scriptEng.sRegister + scriptEng.operands[0];
+                        GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.sRegister) << 2], scriptEng.operands[1], scriptEng.operands[2]);
                     }
-                    num2 = 15 - tileCollisions[cPlane].roofMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
+                    scriptEng.operands[1] = scriptEng.operands[1] - scriptEng.operands[5];
+                    scriptEng.operands[7] = scriptEng.operands[7] * 10;
+                    scriptEng.operands[4] = scriptEng.operands[4] - 1;
                 }
+                break;
             }
         }
-        if (scriptEng.checkResult == 1)
-        {
-            objectEntityList[objectLoop].yPos = (num2 - yOffset) << 16;
-        }
-    }
-}
-
-void ObjectSystem_ObjectFloorGrip(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    int num3 = num2;
-    num2 = num2 - 16;
-    for (int i = 3; i > 0; i--)
-    {
-        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        case 54:
         {
-            int num4 = num1 >> 7;
-            int num5 = (num1 & 127) >> 4;
-            int num6 = num2 >> 7;
-            int num7 = (num2 & 127) >> 4;
-            int num8 = stageLayouts[0].tileMap[num4 + (num6 << 8)] << 6;
-            num8 = num8 + num5 + (num7 << 3);
-            int num9 = tile128x128.tile16x16[num8];
-            if (tile128x128.collisionFlag[cPlane][num8] != 2 && tile128x128.collisionFlag[cPlane][num8] != 3)
+            num5 = 0;
+            switch (scriptEng.operands[3])
             {
-                switch (tile128x128.direction[num8])
+                case 1:
                 {
-                    case 0:
+                    scriptEng.sRegister = 0;
+                    if (scriptEng.operands[4] == 1 && titleCardText[scriptEng.sRegister] != 0)
                     {
-                        num = (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].floorMask[num] >= 64)
+                        scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
+                        if (scriptEng.operands[7] == 32)
                         {
-                            break;
+                            scriptEng.operands[7] = 0;
                         }
-                        objectEntityList[objectLoop].yPos = tileCollisions[cPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
+                        if (scriptEng.operands[7] == 45)
+                        {
+                            scriptEng.operands[7] = 0;
+                        }
+                        if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] - 22;
+                        }
+                        if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] - 65;
+                        }
+                        if (scriptEng.operands[7] <= -1)
+                        {
+                            scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
+                        }
+                        else
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
+                            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]) << 2], scriptEng.operands[1], scriptEng.operands[2]);
+                            scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
+                        }
+                        scriptEng.operands[0] = scriptEng.operands[0] + 26;
+                        scriptEng.sRegister = scriptEng.sRegister + 1;
                     }
-                    case 1:
+                    while (titleCardText[scriptEng.sRegister] != 0)
                     {
-                        num = 15 - (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].floorMask[num] >= 64)
+                        if (titleCardText[scriptEng.sRegister] != '-')
                         {
-                            break;
+                            scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
+                            if (scriptEng.operands[7] == 32)
+                            {
+                                scriptEng.operands[7] = 0;
+                            }
+                            if (scriptEng.operands[7] == 45)
+                            {
+                                scriptEng.operands[7] = 0;
+                            }
+                            if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
+                            {
+                                scriptEng.operands[7] = scriptEng.operands[7] - 22;
+                            }
+                            if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
+                            {
+                                scriptEng.operands[7] = scriptEng.operands[7] - 65;
+                            }
+                            if (scriptEng.operands[7] <= -1)
+                            {
+                                scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
+                            }
+                            else
+                            {
+                                scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
+                                GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]) << 2], scriptEng.operands[1], scriptEng.operands[2]);
+                                scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
+                            }
+                            scriptEng.sRegister = scriptEng.sRegister + 1;
                         }
-                        objectEntityList[objectLoop].yPos = tileCollisions[cPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
                     }
-                    case 2:
+                    break;
+                }
+                case 2:
+                {
+                    scriptEng.sRegister = titleCardWord2;
+                    if (scriptEng.operands[4] == 1 && titleCardText[scriptEng.sRegister] != 0)
                     {
-                        num = (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].roofMask[num] <= -64)
+                        scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
+                        if (scriptEng.operands[7] == 32)
                         {
-                            break;
+                            scriptEng.operands[7] = 0;
                         }
-                        objectEntityList[objectLoop].yPos = 15 - tileCollisions[cPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
+                        if (scriptEng.operands[7] == 45)
+                        {
+                            scriptEng.operands[7] = 0;
+                        }
+                        if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] - 22;
+                        }
+                        if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] - 65;
+                        }
+                        if (scriptEng.operands[7] <= -1)
+                        {
+                            scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
+                        }
+                        else
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
+                            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]) << 2], scriptEng.operands[1], scriptEng.operands[2]);
+                            scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
+                        }
+                        scriptEng.operands[0] = scriptEng.operands[0] + 26;
+                        scriptEng.sRegister = scriptEng.sRegister + 1;
                     }
-                    case 3:
+                    while (titleCardText[scriptEng.sRegister] != 0)
                     {
-                        num = 15 - (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].roofMask[num] <= -64)
+                        scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
+                        if (scriptEng.operands[7] == 32)
                         {
-                            break;
+                            scriptEng.operands[7] = 0;
                         }
-                        objectEntityList[objectLoop].yPos = 15 - tileCollisions[cPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                }
-            }
-        }
-        num2 = num2 + 16;
-    }
-    if (scriptEng.checkResult == 1)
-    {
-        if (abs(objectEntityList[objectLoop].yPos - num3) < 16)
-        {
-            objectEntityList[objectLoop].yPos = (objectEntityList[objectLoop].yPos - yOffset) << 16;
-            return;
+                        if (scriptEng.operands[7] == 45)
+                        {
+                            scriptEng.operands[7] = 0;
+                        }
+                        if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] - 22;
+                        }
+                        if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] - 65;
+                        }
+                        if (scriptEng.operands[7] <= -1)
+                        {
+                            scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
+                        }
+                        else
+                        {
+                            scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
+                            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]) << 2], scriptEng.operands[1], scriptEng.operands[2]);
+                            scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
+                        }
+                        scriptEng.sRegister = scriptEng.sRegister + 1;
+                    }
+                    break;
+                }
+            }
+            break;
         }
-        objectEntityList[objectLoop].yPos = (num3 - yOffset) << 16;
-        scriptEng.checkResult = 0;
-    }
-}
-
-void ObjectSystem_ObjectLWallCollision(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
-    {
-        int num3 = num1 >> 7;
-        int num4 = (num1 & 127) >> 4;
-        int num5 = num2 >> 7;
-        int num6 = (num2 & 127) >> 4;
-        int num7 = stageLayouts[0].tileMap[num3 + (num5 << 8)] << 6;
-        num7 = num7 + num4 + (num6 << 3);
-        int num8 = tile128x128.tile16x16[num7];
-        if (tile128x128.collisionFlag[cPlane][num7] != 1 && tile128x128.collisionFlag[cPlane][num7] < 3)
+        case 55:
+        {
+            num5 = 0;
+            textMenuSurfaceNo = objectScriptList[objectEntityType[objectLoop]].surfaceNum;
+            TextSystem_DrawTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2]);
+            break;
+        }
+        case 56:
+        {
+            num5 = 0;
+            if (scriptSub != 3 || scriptFramesNo >= 0x1000)
+            {
+                break;
+            }
+            scriptFrames[scriptFramesNo].xPivot = scriptEng.operands[0];
+            scriptFrames[scriptFramesNo].yPivot = scriptEng.operands[1];
+            scriptFrames[scriptFramesNo].xSize = scriptEng.operands[2];
+            scriptFrames[scriptFramesNo].ySize = scriptEng.operands[3];
+            scriptFrames[scriptFramesNo].left = scriptEng.operands[4];
+            scriptFrames[scriptFramesNo].top = scriptEng.operands[5];
+            scriptFramesNo = scriptFramesNo + 1;
+            break;
+        }
+        case 57:
+        {
+            num5 = 0;
+            break;
+        }
+        case 58:
+        {
+            num5 = 0;
+            GraphicsSystem_LoadPalette(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
+            break;
+        }
+        case 59:
+        {
+            num5 = 0;
+            GraphicsSystem_RotatePalette((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1], (uint8_t)scriptEng.operands[2]);
+            break;
+        }
+        case 60:
+        {
+            num5 = 0;
+            GraphicsSystem_SetFade((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1], (uint8_t)scriptEng.operands[2], (uint16_t)scriptEng.operands[3]);
+            break;
+        }
+        case 61:
+        {
+            num5 = 0;
+            GraphicsSystem_SetActivePalette((uint8_t)scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
+            break;
+        }
+        case 62:
+        {
+            GraphicsSystem_SetLimitedFade((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1], (uint8_t)scriptEng.operands[2], (uint8_t)scriptEng.operands[3], (uint16_t)scriptEng.operands[4], scriptEng.operands[5], scriptEng.operands[6]);
+            break;
+        }
+        case 63:
+        {
+            num5 = 0;
+            GraphicsSystem_CopyPalette((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1]);
+            break;
+        }
+        case 64:
+        {
+            num5 = 0;
+            GraphicsSystem_ClearScreen((uint8_t)scriptEng.operands[0]);
+            break;
+        }
+        case 65:
         {
-            switch (tile128x128.direction[num7])
+            num5 = 0;
+            objectDrawnInWorld = true;
+            switch (scriptEng.operands[1])
             {
                 case 0:
                 {
-                    num = (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) <= tileCollisions[cPlane].leftWallMask[num])
-                    {
-                        break;
-                    }
-                    num1 = tileCollisions[cPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
+                    GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     break;
                 }
                 case 1:
                 {
-                    num = (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) <= 15 - tileCollisions[cPlane].rightWallMask[num])
-                    {
-                        break;
-                    }
-                    num1 = 15 - tileCollisions[cPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
+                    GraphicsSystem_DrawRotatedSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     break;
                 }
                 case 2:
                 {
-                    num = 15 - (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) <= tileCollisions[cPlane].leftWallMask[num])
-                    {
-                        break;
-                    }
-                    num1 = tileCollisions[cPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
+                    GraphicsSystem_DrawRotoZoomSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, objectEntityList[objectLoop].scale, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     break;
                 }
                 case 3:
                 {
-                    num = 15 - (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) <= 15 - tileCollisions[cPlane].rightWallMask[num])
-                    {
-                        break;
-                    }
-                    num1 = 15 - tileCollisions[cPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
-                }
-            }
-        }
-        if (scriptEng.checkResult == 1)
-        {
-            objectEntityList[objectLoop].xPos = (num1 - xOffset) << 16;
-        }
-    }
-}
-
-void ObjectSystem_ObjectLWallGrip(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    int num3 = num1;
-    num1 = num1 - 16;
-    for (int i = 3; i > 0; i--)
-    {
-        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
-        {
-            int num4 = num1 >> 7;
-            int num5 = (num1 & 127) >> 4;
-            int num6 = num2 >> 7;
-            int num7 = (num2 & 127) >> 4;
-            int num8 = stageLayouts[0].tileMap[num4 + (num6 << 8)] << 6;
-            num8 = num8 + num5 + (num7 << 3);
-            int num9 = tile128x128.tile16x16[num8];
-            if (tile128x128.collisionFlag[cPlane][num8] < 3)
-            {
-                switch (tile128x128.direction[num8])
-                {
-                    case 0:
+                    switch (objectEntityList[objectLoop].inkEffect)
                     {
-                        num = (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].leftWallMask[num] >= 64)
+                        case 0:
                         {
+                            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2], (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset);
                             break;
                         }
-                        objectEntityList[objectLoop].xPos = tileCollisions[cPlane].leftWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 1:
-                    {
-                        num = (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].rightWallMask[num] <= -64)
+                        case 1:
                         {
+                            GraphicsSystem_DrawBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                             break;
                         }
-                        objectEntityList[objectLoop].xPos = 15 - tileCollisions[cPlane].rightWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 2:
-                    {
-                        num = 15 - (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].leftWallMask[num] >= 64)
+                        case 2:
                         {
+                            GraphicsSystem_DrawAlphaBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                             break;
                         }
-                        objectEntityList[objectLoop].xPos = tileCollisions[cPlane].leftWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 3:
-                    {
-                        num = 15 - (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].rightWallMask[num] <= -64)
+                        case 3:
                         {
+                            GraphicsSystem_DrawAdditiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
+                            break;
+                        }
+                        case 4:
+                        {
+                            GraphicsSystem_DrawSubtractiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                             break;
                         }
-                        objectEntityList[objectLoop].xPos = 15 - tileCollisions[cPlane].rightWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                }
-            }
-        }
-        num1 = num1 + 16;
-    }
-    if (scriptEng.checkResult == 1)
-    {
-        if (abs(objectEntityList[objectLoop].xPos - num3) < 16)
-        {
-            objectEntityList[objectLoop].xPos = (objectEntityList[objectLoop].xPos - xOffset) << 16;
-            return;
-        }
-        objectEntityList[objectLoop].xPos = (num3 - xOffset) << 16;
-        scriptEng.checkResult = 0;
-    }
-}
-
-void ObjectSystem_ObjectRoofCollision(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
-    {
-        int num3 = num1 >> 7;
-        int num4 = (num1 & 127) >> 4;
-        int num5 = num2 >> 7;
-        int num6 = (num2 & 127) >> 4;
-        int num7 = stageLayouts[0].tileMap[num3 + (num5 << 8)] << 6;
-        num7 = num7 + num4 + (num6 << 3);
-        int num8 = tile128x128.tile16x16[num7];
-        if (tile128x128.collisionFlag[cPlane][num7] != 1 && tile128x128.collisionFlag[cPlane][num7] < 3)
-        {
-            switch (tile128x128.direction[num7])
-            {
-                case 0:
-                {
-                    num = (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) >= tileCollisions[cPlane].roofMask[num])
-                    {
-                        break;
                     }
-                    num2 = tileCollisions[cPlane].roofMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
                     break;
                 }
-                case 1:
+                case 4:
                 {
-                    num = 15 - (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) >= tileCollisions[cPlane].roofMask[num])
+                    if (objectEntityList[objectLoop].inkEffect == 2)
                     {
-                        break;
+                        GraphicsSystem_DrawScaledTintMask(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     }
-                    num2 = tileCollisions[cPlane].roofMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
-                }
-                case 2:
-                {
-                    num = (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) >= 15 - tileCollisions[cPlane].floorMask[num])
+                    else
                     {
-                        break;
+                        GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     }
-                    num2 = 15 - tileCollisions[cPlane].floorMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
                     break;
                 }
-                case 3:
+                case 5:
                 {
-                    num = 15 - (num1 & 15) + (num8 << 4);
-                    if ((num2 & 15) >= 15 - tileCollisions[cPlane].floorMask[num])
+                    if (objectEntityList[objectLoop].direction < 4)
                     {
-                        break;
+                        GraphicsSystem_DrawSpriteQuad(&scriptQuads[((objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2) + objectEntityList[objectLoop].direction], (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset);
                     }
-                    num2 = 15 - tileCollisions[cPlane].floorMask[num] + (num5 << 7) + (num6 << 4);
-                    scriptEng.checkResult = 1;
                     break;
                 }
             }
+            break;
         }
-        if (scriptEng.checkResult == 1)
-        {
-            objectEntityList[objectLoop].yPos = (num2 - yOffset) << 16;
-        }
-    }
-}
-
-void ObjectSystem_ObjectRoofGrip(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    int num3 = num2;
-    num2 = num2 + 16;
-    for (int i = 3; i > 0; i--)
-    {
-        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        case 66:
         {
-            int num4 = num1 >> 7;
-            int num5 = (num1 & 127) >> 4;
-            int num6 = num2 >> 7;
-            int num7 = (num2 & 127) >> 4;
-            int num8 = stageLayouts[0].tileMap[num4 + (num6 << 8)] << 6;
-            num8 = num8 + num5 + (num7 << 3);
-            int num9 = tile128x128.tile16x16[num8];
-            if (tile128x128.collisionFlag[cPlane][num8] < 3)
+            num5 = 0;
+            switch (scriptEng.operands[1])
             {
-                switch (tile128x128.direction[num8])
+                case 0:
+                {
+                    GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
+                    break;
+                }
+                case 1:
                 {
-                    case 0:
+                    GraphicsSystem_DrawRotatedSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
+                    break;
+                }
+                case 2:
+                {
+                    GraphicsSystem_DrawRotoZoomSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, objectEntityList[objectLoop].scale, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
+                    break;
+                }
+                case 3:
+                {
+                    switch (objectEntityList[objectLoop].inkEffect)
                     {
-                        num = (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].roofMask[num] <= -64)
+                        case 0:
                         {
+                            GraphicsSystem_DrawSpriteQuad(&scriptQuads[(objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2], scriptEng.operands[2], scriptEng.operands[3]);
                             break;
                         }
-                        objectEntityList[objectLoop].yPos = tileCollisions[cPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 1:
-                    {
-                        num = 15 - (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].roofMask[num] <= -64)
+                        case 1:
                         {
+                            GraphicsSystem_DrawBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                             break;
                         }
-                        objectEntityList[objectLoop].yPos = tileCollisions[cPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 2:
-                    {
-                        num = (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].floorMask[num] >= 64)
+                        case 2:
                         {
+                            GraphicsSystem_DrawAlphaBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                             break;
                         }
-                        objectEntityList[objectLoop].yPos = 15 - tileCollisions[cPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 3:
-                    {
-                        num = 15 - (num1 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].floorMask[num] >= 64)
+                        case 3:
                         {
+                            GraphicsSystem_DrawAdditiveBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
+                            break;
+                        }
+                        case 4:
+                        {
+                            GraphicsSystem_DrawSubtractiveBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                             break;
                         }
-                        objectEntityList[objectLoop].yPos = 15 - tileCollisions[cPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
                     }
+                    break;
                 }
-            }
-        }
-        num2 = num2 - 16;
-    }
-    if (scriptEng.checkResult == 1)
-    {
-        if (abs(objectEntityList[objectLoop].yPos - num3) < 16)
-        {
-            objectEntityList[objectLoop].yPos = (objectEntityList[objectLoop].yPos - yOffset) << 16;
-            return;
-        }
-        objectEntityList[objectLoop].yPos = (num3 - yOffset) << 16;
-        scriptEng.checkResult = 0;
-    }
-}
-
-void ObjectSystem_ObjectRWallCollision(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
-    {
-        int num3 = num1 >> 7;
-        int num4 = (num1 & 127) >> 4;
-        int num5 = num2 >> 7;
-        int num6 = (num2 & 127) >> 4;
-        int num7 = stageLayouts[0].tileMap[num3 + (num5 << 8)] << 6;
-        num7 = num7 + num4 + (num6 << 3);
-        int num8 = tile128x128.tile16x16[num7];
-        if (tile128x128.collisionFlag[cPlane][num7] != 1 && tile128x128.collisionFlag[cPlane][num7] < 3)
-        {
-            switch (tile128x128.direction[num7])
-            {
-                case 0:
+                case 4:
                 {
-                    num = (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) >= tileCollisions[cPlane].rightWallMask[num])
+                    if (objectEntityList[objectLoop].inkEffect == 2)
                     {
-                        break;
+                        GraphicsSystem_DrawScaledTintMask(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     }
-                    num1 = tileCollisions[cPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
-                }
-                case 1:
-                {
-                    num = (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) >= 15 - tileCollisions[cPlane].leftWallMask[num])
+                    else
                     {
-                        break;
+                        GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
                     }
-                    num1 = 15 - tileCollisions[cPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
                     break;
                 }
-                case 2:
+                case 5:
                 {
-                    num = 15 - (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) >= tileCollisions[cPlane].rightWallMask[num])
+                    if (objectEntityList[objectLoop].direction < 4)
                     {
-                        break;
+                        GraphicsSystem_DrawSpriteQuad(&scriptQuads[((objectScriptList[objectEntityType[objectLoop]].frameListOffset + scriptEng.operands[0]) << 2) + objectEntityList[objectLoop].direction], scriptEng.operands[2], scriptEng.operands[3]);
                     }
-                    num1 = tileCollisions[cPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
-                    break;
-                }
-                case 3:
-                {
-                    num = 15 - (num2 & 15) + (num8 << 4);
-                    if ((num1 & 15) >= 15 - tileCollisions[cPlane].leftWallMask[num])
-                    {
-                        break;
-                    }
-                    num1 = 15 - tileCollisions[cPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                    scriptEng.checkResult = 1;
                     break;
                 }
             }
+            break;
         }
-        if (scriptEng.checkResult == 1)
+        case 67:
         {
-            objectEntityList[objectLoop].xPos = (num1 - xOffset) << 16;
+            num5 = 0;
+            objectScriptList[objectEntityType[objectLoop]].animationFile = AnimationSystem_AddAnimationFile(scriptText);
+            break;
         }
-    }
-}
-
-void ObjectSystem_ObjectRWallGrip(int xOffset, int yOffset, int cPlane)
-{
-    int num;
-    scriptEng.checkResult = 0;
-    int num1 = (objectEntityList[objectLoop].xPos >> 16) + xOffset;
-    int num2 = (objectEntityList[objectLoop].yPos >> 16) + yOffset;
-    int num3 = num1;
-    num1 = num1 + 16;
-    for (int i = 3; i > 0; i--)
-    {
-        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        case 68:
         {
-            int num4 = num1 >> 7;
-            int num5 = (num1 & 127) >> 4;
-            int num6 = num2 >> 7;
-            int num7 = (num2 & 127) >> 4;
-            int num8 = stageLayouts[0].tileMap[num4 + (num6 << 8)] << 6;
-            num8 = num8 + num5 + (num7 << 3);
-            int num9 = tile128x128.tile16x16[num8];
-            if (tile128x128.collisionFlag[cPlane][num8] < 3)
-            {
-                switch (tile128x128.direction[num8])
-                {
-                    case 0:
-                    {
-                        num = (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].rightWallMask[num] <= -64)
-                        {
-                            break;
-                        }
-                        objectEntityList[objectLoop].xPos = tileCollisions[cPlane].rightWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 1:
-                    {
-                        num = (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].leftWallMask[num] >= 64)
-                        {
-                            break;
-                        }
-                        objectEntityList[objectLoop].xPos = 15 - tileCollisions[cPlane].leftWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 2:
-                    {
-                        num = 15 - (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].rightWallMask[num] <= -64)
-                        {
-                            break;
-                        }
-                        objectEntityList[objectLoop].xPos = tileCollisions[cPlane].rightWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                    case 3:
-                    {
-                        num = 15 - (num2 & 15) + (num9 << 4);
-                        if (tileCollisions[cPlane].leftWallMask[num] >= 64)
-                        {
-                            break;
-                        }
-                        objectEntityList[objectLoop].xPos = 15 - tileCollisions[cPlane].leftWallMask[num] + (num4 << 7) + (num5 << 4);
-                        scriptEng.checkResult = 1;
-                        break;
-                    }
-                }
-            }
+            num5 = 0;
+            TextSystem_SetupTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1]);
+            gameMenu[scriptEng.operands[0]].numSelections = (uint8_t)scriptEng.operands[2];
+            gameMenu[scriptEng.operands[0]].alignment = (uint8_t)scriptEng.operands[3];
+            break;
         }
-        num1 = num1 - 16;
-    }
-    if (scriptEng.checkResult == 1)
-    {
-        if (abs(objectEntityList[objectLoop].xPos - num3) < 16)
+        case 69:
         {
-            objectEntityList[objectLoop].xPos = (objectEntityList[objectLoop].xPos - xOffset) << 16;
-            return;
+            num5 = 0;
+            gameMenu[scriptEng.operands[0]].entryHighlight[gameMenu[scriptEng.operands[0]].numRows] = (uint8_t)scriptEng.operands[2];
+            TextSystem_AddTextMenuEntry(&gameMenu[scriptEng.operands[0]], scriptText);
+            break;
         }
-        objectEntityList[objectLoop].xPos = (num3 - xOffset) << 16;
-        scriptEng.checkResult = 0;
-    }
-}
-
-void ObjectSystem_PlatformCollision(int cLeft, int cTop, int cRight, int cBottom)
-{
-    struct PlayerObject* playerObject = &playerList[playerNum];
-    struct CollisionBox* collisionBox = &collisionBoxList[playerObject->animationFile->cbListOffset + animationFrames[animationList[playerObject->animationFile->aniListOffset + playerObject->objectPtr->animation].frameListOffset + playerObject->objectPtr->frame].collisionBox];
-    collisionLeft = collisionBox->left[0];
-    collisionTop = collisionBox->top[0];
-    collisionRight = collisionBox->right[0];
-    collisionBottom = collisionBox->bottom[0];
-    object_cSensor[0].collided = 0;
-    object_cSensor[1].collided = 0;
-    object_cSensor[2].collided = 0;
-    object_cSensor[0].xPos = playerObject->xPos + ((collisionLeft + 1) << 16);
-    object_cSensor[1].xPos = playerObject->xPos;
-    object_cSensor[2].xPos = playerObject->xPos + (collisionRight << 16);
-    object_cSensor[0].yPos = playerObject->yPos + (collisionBottom << 16);
-    object_cSensor[1].yPos = object_cSensor[0].yPos;
-    object_cSensor[2].yPos = object_cSensor[0].yPos;
-    scriptEng.checkResult = 0;
-    for (int i = 0; i < 3; i++)
-    {
-        if (object_cSensor[i].xPos > cLeft && object_cSensor[i].xPos < cRight && object_cSensor[i].yPos > cTop - 2 && object_cSensor[i].yPos < cBottom && playerObject->yVelocity >= 0)
+        case 70:
         {
-            object_cSensor[i].collided = 1;
-            playerObject->flailing[i] = 1;
+            num5 = 0;
+            TextSystem_EditTextMenuEntry(&gameMenu[scriptEng.operands[0]], scriptText, scriptEng.operands[2]);
+            gameMenu[scriptEng.operands[0]].entryHighlight[scriptEng.operands[2]] = (uint8_t)scriptEng.operands[3];
+            break;
         }
-    }
-    if (object_cSensor[0].collided == 1 || object_cSensor[1].collided == 1 || object_cSensor[2].collided == 1)
-    {
-        if (playerObject->gravity == 0 && (playerObject->collisionMode == 1 || playerObject->collisionMode == 3))
+        case 71:
         {
-            playerObject->xVelocity = 0;
-            playerObject->speed = 0;
+            num5 = 0;
+            stageMode = 0;
+            break;
         }
-        playerObject->yPos = cTop - (collisionBottom << 16);
-        playerObject->gravity = 0;
-        playerObject->yVelocity = 0;
-        playerObject->angle = 0;
-        playerObject->objectPtr->rotation = 0;
-        playerObject->controlLock = 0;
-        scriptEng.checkResult = 1;
-    }
-}
-
-void ObjectSystem_ProcessObjects()
-{
-    int num;
-    int num1;
-    bool flag = false;
-    objectDrawOrderList[0].listSize = 0;
-    objectDrawOrderList[1].listSize = 0;
-    objectDrawOrderList[2].listSize = 0;
-    objectDrawOrderList[3].listSize = 0;
-    objectDrawOrderList[4].listSize = 0;
-    objectDrawOrderList[5].listSize = 0;
-    objectDrawOrderList[6].listSize = 0;
-    objectLoop = 0;
-    while (objectLoop < 0x4a0)
-    {
-        switch (objectEntityList[objectLoop].priority)
+        case 72:
         {
-            case 0:
+            num5 = 0;
+            GraphicsSystem_DrawRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4], scriptEng.operands[5], scriptEng.operands[6], scriptEng.operands[7]);
+            break;
+        }
+        case 73:
+        {
+            num5 = 0;
+            objectEntityType[scriptEng.operands[0]] = (uint8_t)scriptEng.operands[1];
+            ObjectSystem_MarkTempObject(scriptEng.operands[0]);
+            objectEntityList[scriptEng.operands[0]].propertyValue = (uint8_t)scriptEng.operands[2];
+            objectEntityXPos[scriptEng.operands[0]] = scriptEng.operands[3];
+            objectEntityYPos[scriptEng.operands[0]] = scriptEng.operands[4];
+            objectEntityList[scriptEng.operands[0]].direction = 0;
+            objectEntityList[scriptEng.operands[0]].frame = 0;
+            objectEntityPriority[scriptEng.operands[0]] = 0;
+            objectEntityList[scriptEng.operands[0]].rotation = 0;
+            objectEntityList[scriptEng.operands[0]].state = 0;
+            objectEntityDrawOrder[scriptEng.operands[0]] = 3;
+            objectEntityList[scriptEng.operands[0]].scale = 0x200;
+            objectEntityList[scriptEng.operands[0]].inkEffect = 0;
+            objectEntityList[scriptEng.operands[0]].value[0] = 0;
+            objectEntityList[scriptEng.operands[0]].value[1] = 0;
+            objectEntityList[scriptEng.operands[0]].value[2] = 0;
+            objectEntityList[scriptEng.operands[0]].value[3] = 0;
+            objectEntityList[scriptEng.operands[0]].value[4] = 0;
+            objectEntityList[scriptEng.operands[0]].value[5] = 0;
+            objectEntityList[scriptEng.operands[0]].value[6] = 0;
+            objectEntityList[scriptEng.operands[0]].value[7] = 0;
+            break;
+        }
+        case 74:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
             {
-                num = objectEntityList[objectLoop].xPos >> 16;
-                num1 = objectEntityList[objectLoop].yPos >> 16;
-                if (num <= xScrollOffset - OBJECT_BORDER_X1 || num >= xScrollOffset + OBJECT_BORDER_X2 || num1 <= yScrollOffset - 0x100 || num1 >= yScrollOffset + 0x1f0)
+                case 0:
                 {
-                    flag = false;
+                    scriptEng.operands[5] = objectEntityXPos[objectLoop] >> 16;
+                    scriptEng.operands[6] = objectEntityYPos[objectLoop] >> 16;
+                    ObjectSystem_BasicCollision(scriptEng.operands[1] + scriptEng.operands[5], scriptEng.operands[2] + scriptEng.operands[6], scriptEng.operands[3] + scriptEng.operands[5], scriptEng.operands[4] + scriptEng.operands[6]);
                     break;
                 }
-                else
+                case 1:
+                case 2:
                 {
-                    flag = true;
+                    ObjectSystem_BoxCollision((scriptEng.operands[1] << 16) + objectEntityXPos[objectLoop], (scriptEng.operands[2] << 16) + objectEntityYPos[objectLoop], (scriptEng.operands[3] << 16) + objectEntityXPos[objectLoop], (scriptEng.operands[4] << 16) + objectEntityYPos[objectLoop]);
+                    break;
+                }
+                case 3:
+                {
+                    ObjectSystem_PlatformCollision((scriptEng.operands[1] << 16) + objectEntityXPos[objectLoop], (scriptEng.operands[2] << 16) + objectEntityYPos[objectLoop], (scriptEng.operands[3] << 16) + objectEntityXPos[objectLoop], (scriptEng.operands[4] << 16) + objectEntityYPos[objectLoop]);
                     break;
                 }
             }
-            case 1:
+            break;
+        }
+        case 75:
+        {
+            num5 = 0;
+            scriptEng.arrayPosition[2] = ObjectSystem_AllocTempObject();
+            objectEntityType[scriptEng.arrayPosition[2]] = (uint8_t)scriptEng.operands[0];
+            ObjectSystem_MarkTempObject(scriptEng.arrayPosition[2]);
+            objectEntityList[scriptEng.arrayPosition[2]].propertyValue = (uint8_t)scriptEng.operands[1];
+            objectEntityXPos[scriptEng.arrayPosition[2]] = scriptEng.operands[2];
+            objectEntityYPos[scriptEng.arrayPosition[2]] = scriptEng.operands[3];
+            objectEntityList[scriptEng.arrayPosition[2]].direction = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].frame = 0;
+            objectEntityPriority[scriptEng.arrayPosition[2]] = 1;
+            objectEntityList[scriptEng.arrayPosition[2]].rotation = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].state = 0;
+            objectEntityDrawOrder[scriptEng.arrayPosition[2]] = 3;
+            objectEntityList[scriptEng.arrayPosition[2]].scale = 0x200;
+            objectEntityList[scriptEng.arrayPosition[2]].inkEffect = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].alpha = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].animation = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].prevAnimation = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].animationSpeed = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].animationTimer = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[0] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[1] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[2] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[3] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[4] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[5] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[6] = 0;
+            objectEntityList[scriptEng.arrayPosition[2]].value[7] = 0;
+            break;
+        }
+        case 76:
+        {
+            num5 = 0;
+            playerList[scriptEng.operands[0]].animationFile = objectScriptList[objectEntityType[scriptEng.operands[1]]].animationFile;
+            playerList[scriptEng.operands[0]].objectPtr = &objectEntityList[scriptEng.operands[1]];
+            playerList[scriptEng.operands[0]].objectNum = scriptEng.operands[1];
+            break;
+        }
+        case 77:
+        {
+            num5 = 0;
+            if (playerList[playerNum].tileCollisions != 1)
             {
-                flag = true;
+                struct PlayerObject* playerObject = &playerList[playerNum];
+                playerObject->xPos = playerObject->xPos + playerList[playerNum].xVelocity;
+                struct PlayerObject* playerObject1 = &playerList[playerNum];
+                playerObject1->yPos = playerObject1->yPos + playerList[playerNum].yVelocity;
                 break;
             }
-            case 2:
+            else
             {
-                flag = true;
+                PlayerSystem_ProcessPlayerTileCollisions(&playerList[playerNum]);
                 break;
             }
-            case 3:
+        }
+        case 78:
+        {
+            num5 = 0;
+            PlayerSystem_ProcessPlayerControl(&playerList[playerNum]);
+            break;
+        }
+        case 79:
+        {
+            AnimationSystem_ProcessObjectAnimation(&animationList[objectScriptList[objectEntityType[objectLoop]].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop]);
+            num5 = 0;
+            break;
+        }
+        case 80:
+        {
+            num5 = 0;
+            AnimationSystem_DrawObjectAnimation(&animationList[objectScriptList[objectEntityType[objectLoop]].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop], (objectEntityXPos[objectLoop] >> 16) - xScrollOffset, (objectEntityYPos[objectLoop] >> 16) - yScrollOffset);
+            break;
+        }
+        case 81:
+        {
+            num5 = 0;
+            if (playerList[playerNum].visible != 1)
             {
-                num = objectEntityList[objectLoop].xPos >> 16;
-                if (num <= xScrollOffset - OBJECT_BORDER_X1 || num >= xScrollOffset + OBJECT_BORDER_X2)
+                break;
+            }
+            if (cameraEnabled != playerNum)
+            {
+                AnimationSystem_DrawObjectAnimation(&animationList[objectScriptList[objectEntityType[objectLoop]].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop], (playerList[playerNum].xPos >> 16) - xScrollOffset, (playerList[playerNum].yPos >> 16) - yScrollOffset);
+                break;
+            }
+            else
+            {
+                AnimationSystem_DrawObjectAnimation(&animationList[objectScriptList[objectEntityType[objectLoop]].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop], playerList[playerNum].screenXPos, playerList[playerNum].screenYPos);
+                break;
+            }
+        }
+        case 82:
+        {
+            num5 = 0;
+            if (scriptEng.operands[2] <= 1)
+            {
+                AudioPlayback_SetMusicTrack(scriptText, scriptEng.operands[1], (uint8_t)scriptEng.operands[2], 0);
+                break;
+            }
+            else
+            {
+                AudioPlayback_SetMusicTrack(scriptText, scriptEng.operands[1], 1, (uint32_t)scriptEng.operands[2]);
+                break;
+            }
+        }
+        case 83:
+        {
+            num5 = 0;
+            AudioPlayback_PlayMusic(scriptEng.operands[0]);
+            break;
+        }
+        case 84:
+        {
+            num5 = 0;
+            AudioPlayback_StopMusic();
+            break;
+        }
+        case 85:
+        {
+            num5 = 0;
+            AudioPlayback_PlaySfx(scriptEng.operands[0], (uint8_t)scriptEng.operands[1]);
+            break;
+        }
+        case 86:
+        {
+            num5 = 0;
+            AudioPlayback_StopSfx(scriptEng.operands[0]);
+            break;
+        }
+        case 87:
+        {
+            num5 = 0;
+            AudioPlayback_SetSfxAttributes(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
+            break;
+        }
+        case 88:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
                 {
-                    flag = false;
+                    ObjectSystem_ObjectFloorCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
                     break;
                 }
-                else
+                case 1:
                 {
-                    flag = true;
+                    ObjectSystem_ObjectLWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
                     break;
                 }
-            }
-            case 4:
-            {
-                num = objectEntityList[objectLoop].xPos >> 16;
-                num1 = objectEntityList[objectLoop].yPos >> 16;
-                if (num <= xScrollOffset - OBJECT_BORDER_X1 || num >= xScrollOffset + OBJECT_BORDER_X2 || num1 <= yScrollOffset - 0x100 || num1 >= yScrollOffset + 0x1f0)
+                case 2:
                 {
-                    flag = false;
-                    objectEntityList[objectLoop].type = 0;
+                    ObjectSystem_ObjectRWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
                     break;
                 }
-                else
+                case 3:
                 {
-                    flag = true;
+                    ObjectSystem_ObjectRoofCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
                     break;
                 }
             }
-            case 5:
-            {
-                flag = false;
-                break;
-            }
+            break;
         }
-        if (flag && objectEntityList[objectLoop].type > 0)
+        case 89:
         {
-            int num2 = objectEntityList[objectLoop].type;
-            playerNum = 0;
-            if (scriptData[objectScriptList[num2].mainScript] > 0)
+            num5 = 0;
+            switch (scriptEng.operands[0])
             {
-                ObjectSystem_ProcessScript(objectScriptList[num2].mainScript, objectScriptList[num2].mainJumpTable, 0);
-            }
-            if (scriptData[objectScriptList[num2].playerScript] > 0)
-            {
-                while (playerNum < numActivePlayers)
+                case 0:
                 {
-                    if (playerList[playerNum].objectInteraction == 1)
-                    {
-                        ObjectSystem_ProcessScript(objectScriptList[num2].playerScript, objectScriptList[num2].playerJumpTable, 1);
-                    }
-                    playerNum = playerNum + 1;
+                    ObjectSystem_ObjectFloorGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 1:
+                {
+                    ObjectSystem_ObjectLWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 2:
+                {
+                    ObjectSystem_ObjectRWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 3:
+                {
+                    ObjectSystem_ObjectRoofGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
                 }
             }
-            num2 = objectEntityList[objectLoop].drawOrder;
-            if (num2 < 7)
-            {
-                objectDrawOrderList[num2].entityRef[objectDrawOrderList[num2].listSize] = objectLoop;
-                struct ObjectDrawList* objectDrawList = &objectDrawOrderList[num2];
-                objectDrawList->listSize = objectDrawList->listSize + 1;
-            }
+            break;
         }
-        objectLoop = objectLoop + 1;
-    }
-}
-
-void ObjectSystem_ProcessPausedObjects()
-{
-    objectDrawOrderList[0].listSize = 0;
-    objectDrawOrderList[1].listSize = 0;
-    objectDrawOrderList[2].listSize = 0;
-    objectDrawOrderList[3].listSize = 0;
-    objectDrawOrderList[4].listSize = 0;
-    objectDrawOrderList[5].listSize = 0;
-    objectDrawOrderList[6].listSize = 0;
-    objectLoop = 0;
-    while (objectLoop < 0x4a0)
-    {
-        if (objectEntityList[objectLoop].priority == 2 && objectEntityList[objectLoop].type > 0)
+        case 90:
         {
-            int num = objectEntityList[objectLoop].type;
-            playerNum = 0;
-            if (scriptData[objectScriptList[num].mainScript] > 0)
-            {
-                ObjectSystem_ProcessScript(objectScriptList[num].mainScript, objectScriptList[num].mainJumpTable, 0);
-            }
-            if (scriptData[objectScriptList[num].playerScript] > 0)
+            num5 = 0;
+            AudioPlayback_PauseSound();
+            EngineCallbacks_PlayVideoFile(scriptText);
+            AudioPlayback_ResumeSound();
+            break;
+        }
+        case 91:
+        {
+            num5 = 0;
+            break;
+        }
+        case 92:
+        {
+            num5 = 0;
+            AudioPlayback_PlaySfx(scriptEng.operands[0] + numGlobalSFX, (uint8_t)scriptEng.operands[1]);
+            break;
+        }
+        case 93:
+        {
+            num5 = 0;
+            AudioPlayback_StopSfx(scriptEng.operands[0] + numGlobalSFX);
+            break;
+        }
+        case 94:
+        {
+            scriptEng.operands[0] = ~scriptEng.operands[0];
+            break;
+        }
+        case 95:
+        {
+            num5 = 0;
+            Scene3D_TransformVertexBuffer();
+            Scene3D_Sort3DDrawList();
+            Scene3D_Draw3DScene((int)objectScriptList[objectEntityType[objectLoop]].surfaceNum);
+            break;
+        }
+        case 96:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
             {
-                while (playerNum < numActivePlayers)
+                case 0:
                 {
-                    if (playerList[playerNum].objectInteraction == 1)
-                    {
-                        ObjectSystem_ProcessScript(objectScriptList[num].playerScript, objectScriptList[num].playerJumpTable, 1);
-                    }
-                    playerNum = playerNum + 1;
+                    Scene3D_SetIdentityMatrix(matWorld);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_SetIdentityMatrix(matView);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_SetIdentityMatrix(matTemp);
+                    break;
                 }
             }
-            num = objectEntityList[objectLoop].drawOrder;
-            if (num < 7)
-            {
-                objectDrawOrderList[num].entityRef[objectDrawOrderList[num].listSize] = objectLoop;
-                struct ObjectDrawList* objectDrawList = &objectDrawOrderList[num];
-                objectDrawList->listSize = objectDrawList->listSize + 1;
-            }
+            break;
         }
-        objectLoop = objectLoop + 1;
-    }
-}
-
-void ObjectSystem_ProcessScript(int scriptCodePtr, int jumpTablePtr, int scriptSub)
-{
-    int i;
-    int num;
-    bool flag = false;
-    int num1 = 0;
-    int num2 = scriptCodePtr;
-    jumpTableStackPos = 0;
-    functionStackPos = 0;
-    while (!flag)
-    {
-        int num3 = scriptData[scriptCodePtr];
-        scriptCodePtr++;
-        int num4 = 0;
-        signed char num5 = scriptOpcodeSizes[num3];
-        for (i = 0; i < num5; i++)
+        case 97:
         {
-            switch (scriptData[scriptCodePtr])
+            num5 = 0;
+            switch (scriptEng.operands[0])
             {
-                case 1:
+                case 0:
                 {
-                    scriptCodePtr++;
-                    num4++;
-                    switch (scriptData[scriptCodePtr])
+                    switch (scriptEng.operands[1])
                     {
                         case 0:
                         {
-                            num1 = objectLoop;
+                            Scene3D_MatrixMultiply(matWorld, matWorld);
                             break;
                         }
                         case 1:
                         {
-                            scriptCodePtr++;
-                            if (scriptData[scriptCodePtr] != 1)
-                            {
-                                scriptCodePtr++;
-                                num1 = scriptData[scriptCodePtr];
-                            }
-                            else
-                            {
-                                scriptCodePtr++;
-                                num1 = scriptEng.arrayPosition[scriptData[scriptCodePtr]];
-                            }
-                            num4 = num4 + 2;
+                            Scene3D_MatrixMultiply(matWorld, matView);
                             break;
                         }
                         case 2:
                         {
-                            scriptCodePtr++;
-                            if (scriptData[scriptCodePtr] != 1)
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop + scriptData[scriptCodePtr];
-                            }
-                            else
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop + scriptEng.arrayPosition[scriptData[scriptCodePtr]];
-                            }
-                            num4 = num4 + 2;
-                            break;
-                        }
-                        case 3:
-                        {
-                            scriptCodePtr++;
-                            if (scriptData[scriptCodePtr] != 1)
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop - scriptData[scriptCodePtr];
-                            }
-                            else
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop - scriptEng.arrayPosition[scriptData[scriptCodePtr]];
-                            }
-                            num4 = num4 + 2;
+                            Scene3D_MatrixMultiply(matWorld, matTemp);
                             break;
                         }
                     }
-                    scriptCodePtr++;
-                    num4++;
-                    switch (scriptData[scriptCodePtr])
+                    break;
+                }
+                case 1:
+                {
+                    switch (scriptEng.operands[1])
                     {
                         case 0:
                         {
-                            scriptEng.operands[i] = scriptEng.tempValue[0];
+                            Scene3D_MatrixMultiply(matView, matWorld);
                             break;
                         }
                         case 1:
                         {
-                            scriptEng.operands[i] = scriptEng.tempValue[1];
+                            Scene3D_MatrixMultiply(matView, matView);
                             break;
                         }
                         case 2:
                         {
-                            scriptEng.operands[i] = scriptEng.tempValue[2];
-                            break;
-                        }
-                        case 3:
-                        {
-                            scriptEng.operands[i] = scriptEng.tempValue[3];
-                            break;
-                        }
-                        case 4:
-                        {
-                            scriptEng.operands[i] = scriptEng.tempValue[4];
-                            break;
-                        }
-                        case 5:
-                        {
-                            scriptEng.operands[i] = scriptEng.tempValue[5];
-                            break;
-                        }
-                        case 6:
-                        {
-                            scriptEng.operands[i] = scriptEng.tempValue[6];
-                            break;
-                        }
-                        case 7:
-                        {
-                            scriptEng.operands[i] = scriptEng.tempValue[7];
-                            break;
-                        }
-                        case 8:
-                        {
-                            scriptEng.operands[i] = scriptEng.checkResult;
-                            break;
-                        }
-                        case 9:
-                        {
-                            scriptEng.operands[i] = scriptEng.arrayPosition[0];
-                            break;
-                        }
-                        case 10:
-                        {
-                            scriptEng.operands[i] = scriptEng.arrayPosition[1];
-                            break;
-                        }
-                        case 11:
-                        {
-                            scriptEng.operands[i] = globalVariables[num1];
-                            break;
-                        }
-                        case 12:
-                        {
-                            scriptEng.operands[i] = num1;
-                            break;
-                        }
-                        case 13:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].type;
-                            break;
-                        }
-                        case 14:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].propertyValue;
-                            break;
-                        }
-                        case 15:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].xPos;
-                            break;
-                        }
-                        case 16:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].yPos;
-                            break;
-                        }
-                        case 17:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].xPos >> 16;
-                            break;
-                        }
-                        case 18:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].yPos >> 16;
-                            break;
-                        }
-                        case 19:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].state;
-                            break;
-                        }
-                        case 20:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].rotation;
-                            break;
-                        }
-                        case 21:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].scale;
+                            Scene3D_MatrixMultiply(matView, matTemp);
                             break;
                         }
-                        case 22:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].priority;
-                            break;
-                        }
-                        case 23:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].drawOrder;
-                            break;
-                        }
-                        case 24:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].direction;
-                            break;
-                        }
-                        case 25:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].inkEffect;
-                            break;
-                        }
-                        case 26:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].alpha;
-                            break;
-                        }
-                        case 27:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].frame;
-                            break;
-                        }
-                        case 28:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].animation;
-                            break;
-                        }
-                        case 29:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].prevAnimation;
-                            break;
-                        }
-                        case 30:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].animationSpeed;
-                            break;
-                        }
-                        case 31:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].animationTimer;
-                            break;
-                        }
-                        case 32:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].value[0];
-                            break;
-                        }
-                        case 33:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].value[1];
-                            break;
-                        }
-                        case 34:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].value[2];
-                            break;
-                        }
-                        case 35:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].value[3];
-                            break;
-                        }
-                        case 36:
-                        {
-                            scriptEng.operands[i] = objectEntityList[num1].value[4];
-                            break;
-                        }
-                        case 37:
+                    }
+                    break;
+                }
+                case 2:
+                {
+                    switch (scriptEng.operands[1])
+                    {
+                        case 0:
                         {
-                            scriptEng.operands[i] = objectEntityList[num1].value[5];
+                            Scene3D_MatrixMultiply(matTemp, matWorld);
                             break;
                         }
-                        case 38:
+                        case 1:
                         {
-                            scriptEng.operands[i] = objectEntityList[num1].value[6];
+                            Scene3D_MatrixMultiply(matTemp, matView);
                             break;
                         }
-                        case 39:
+                        case 2:
                         {
-                            scriptEng.operands[i] = objectEntityList[num1].value[7];
+                            Scene3D_MatrixMultiply(matTemp, matTemp);
                             break;
                         }
-                        case 40:
-                        {
-                            scriptEng.sRegister = objectEntityList[objectLoop].xPos >> 16;
-                            if (scriptEng.sRegister <= xScrollOffset - OBJECT_BORDER_X1 || scriptEng.sRegister >= xScrollOffset + OBJECT_BORDER_X2)
-                            {
-                                scriptEng.operands[i] = 1;
-                                break;
-                            }
-                            else
-                            {
-                                scriptEng.sRegister = objectEntityList[objectLoop].yPos >> 16;
-                                if (scriptEng.sRegister <= yScrollOffset - 0x100 || scriptEng.sRegister >= yScrollOffset + 0x1f0)
-                                {
-                                    scriptEng.operands[i] = 1;
-                                    break;
-                                }
-                                else
-                                {
-                                    scriptEng.operands[i] = 0;
-                                    break;
-                                }
-                            }
-                        }
-                        case 41:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->state;
-                            break;
-                        }
-                        case 42:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].controlMode;
-                            break;
-                        }
-                        case 43:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].controlLock;
-                            break;
-                        }
-                        case 44:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].collisionMode;
-                            break;
-                        }
-                        case 45:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].collisionPlane;
-                            break;
-                        }
-                        case 46:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].xPos;
-                            break;
-                        }
-                        case 47:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].yPos;
-                            break;
-                        }
-                        case 48:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].xPos >> 16;
-                            break;
-                        }
-                        case 49:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].yPos >> 16;
-                            break;
-                        }
-                        case 50:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].screenXPos;
-                            break;
-                        }
-                        case 51:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].screenYPos;
-                            break;
-                        }
-                        case 52:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].speed;
-                            break;
-                        }
-                        case 53:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].xVelocity;
-                            break;
-                        }
-                        case 54:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].yVelocity;
-                            break;
-                        }
-                        case 55:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].gravity;
-                            break;
-                        }
-                        case 56:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].angle;
-                            break;
-                        }
-                        case 57:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].skidding;
-                            break;
-                        }
-                        case 58:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].pushing;
-                            break;
-                        }
-                        case 59:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].trackScroll;
-                            break;
-                        }
-                        case 60:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].up;
-                            break;
-                        }
-                        case 61:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].down;
-                            break;
-                        }
-                        case 62:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].left;
-                            break;
-                        }
-                        case 63:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].right;
-                            break;
-                        }
-                        case 64:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].jumpPress;
-                            break;
-                        }
-                        case 65:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].jumpHold;
-                            break;
-                        }
-                        case 66:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].followPlayer1;
-                            break;
-                        }
-                        case 67:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].lookPos;
-                            break;
-                        }
-                        case 68:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].water;
-                            break;
-                        }
-                        case 69:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.topSpeed;
-                            break;
-                        }
-                        case 70:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.acceleration;
-                            break;
-                        }
-                        case 71:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.deceleration;
-                            break;
-                        }
-                        case 72:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.airAcceleration;
-                            break;
-                        }
-                        case 73:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.airDeceleration;
-                            break;
-                        }
-                        case 74:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.gravity;
-                            break;
-                        }
-                        case 75:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.jumpStrength;
-                            break;
-                        }
-                        case 76:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.jumpCap;
-                            break;
-                        }
-                        case 77:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.rollingAcceleration;
-                            break;
-                        }
-                        case 78:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].movementStats.rollingDeceleration;
-                            break;
-                        }
-                        case 79:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectNum;
-                            break;
-                        }
-                        case 80:
-                        {
-                            scriptEng.operands[i] = collisionBoxList[playerList[playerNum].animationFile->cbListOffset + animationFrames[animationList[playerList[playerNum].animationFile->aniListOffset + playerList[playerNum].objectPtr->animation].frameListOffset + playerList[playerNum].objectPtr->frame].collisionBox].left[0];
-                            break;
-                        }
-                        case 81:
-                        {
-                            scriptEng.operands[i] = collisionBoxList[playerList[playerNum].animationFile->cbListOffset + animationFrames[animationList[playerList[playerNum].animationFile->aniListOffset + playerList[playerNum].objectPtr->animation].frameListOffset + playerList[playerNum].objectPtr->frame].collisionBox].top[0];
-                            break;
-                        }
-                        case 82:
-                        {
-                            scriptEng.operands[i] = collisionBoxList[playerList[playerNum].animationFile->cbListOffset + animationFrames[animationList[playerList[playerNum].animationFile->aniListOffset + playerList[playerNum].objectPtr->animation].frameListOffset + playerList[playerNum].objectPtr->frame].collisionBox].right[0];
-                            break;
-                        }
-                        case 83:
-                        {
-                            scriptEng.operands[i] = collisionBoxList[playerList[playerNum].animationFile->cbListOffset + animationFrames[animationList[playerList[playerNum].animationFile->aniListOffset + playerList[playerNum].objectPtr->animation].frameListOffset + playerList[playerNum].objectPtr->frame].collisionBox].bottom[0];
-                            break;
-                        }
-                        case 84:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].flailing[num1];
-                            break;
-                        }
-                        case 85:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].timer;
-                            break;
-                        }
-                        case 86:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].tileCollisions;
-                            break;
-                        }
-                        case 87:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectInteraction;
-                            break;
-                        }
-                        case 88:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].visible;
-                            break;
-                        }
-                        case 89:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->rotation;
-                            break;
-                        }
-                        case 90:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->scale;
-                            break;
-                        }
-                        case 91:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->priority;
-                            break;
-                        }
-                        case 92:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->drawOrder;
-                            break;
-                        }
-                        case 93:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->direction;
-                            break;
-                        }
-                        case 94:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->inkEffect;
-                            break;
-                        }
-                        case 95:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->alpha;
-                            break;
-                        }
-                        case 96:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->frame;
-                            break;
-                        }
-                        case 97:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->animation;
-                            break;
-                        }
-                        case 98:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->prevAnimation;
-                            break;
-                        }
-                        case 99:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->animationSpeed;
-                            break;
-                        }
-                        case 100:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->animationTimer;
-                            break;
-                        }
-                        case 101:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[0];
-                            break;
-                        }
-                        case 102:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[1];
-                            break;
-                        }
-                        case 103:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[2];
-                            break;
-                        }
-                        case 104:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[3];
-                            break;
-                        }
-                        case 105:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[4];
-                            break;
-                        }
-                        case 106:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[5];
-                            break;
-                        }
-                        case 107:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[6];
-                            break;
-                        }
-                        case 108:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].objectPtr->value[7];
-                            break;
-                        }
-                        case 109:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[0];
-                            break;
-                        }
-                        case 110:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[1];
-                            break;
-                        }
-                        case 111:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[2];
-                            break;
-                        }
-                        case 112:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[3];
-                            break;
-                        }
-                        case 113:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[4];
-                            break;
-                        }
-                        case 114:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[5];
-                            break;
-                        }
-                        case 115:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[6];
-                            break;
-                        }
-                        case 116:
-                        {
-                            scriptEng.operands[i] = playerList[playerNum].value[7];
-                            break;
-                        }
-                        case 117:
-                        {
-                            scriptEng.sRegister = playerList[playerNum].objectPtr->xPos >> 16;
-                            if (scriptEng.sRegister <= xScrollOffset - OBJECT_BORDER_X1 || scriptEng.sRegister >= xScrollOffset + OBJECT_BORDER_X2)
-                            {
-                                scriptEng.operands[i] = 1;
-                                break;
-                            }
-                            else
-                            {
-                                scriptEng.sRegister = playerList[playerNum].objectPtr->yPos >> 16;
-                                if (scriptEng.sRegister <= yScrollOffset - 0x100 || scriptEng.sRegister >= yScrollOffset + 0x1f0)
-                                {
-                                    scriptEng.operands[i] = 1;
-                                    break;
-                                }
-                                else
-                                {
-                                    scriptEng.operands[i] = 0;
-                                    break;
-                                }
-                            }
-                        }
-                        case 118:
-                        {
-                            scriptEng.operands[i] = stageMode;
-                            break;
-                        }
-                        case 119:
-                        {
-                            scriptEng.operands[i] = activeStageList;
-                            break;
-                        }
-                        case 120:
-                        {
-                            scriptEng.operands[i] = stageListPosition;
-                            break;
-                        }
-                        case 121:
-                        {
-                            scriptEng.operands[i] = timeEnabled;
-                            break;
-                        }
-                        case 122:
-                        {
-                            scriptEng.operands[i] = milliSeconds;
-                            break;
-                        }
-                        case 123:
-                        {
-                            scriptEng.operands[i] = seconds;
-                            break;
-                        }
-                        case 124:
-                        {
-                            scriptEng.operands[i] = minutes;
-                            break;
-                        }
-                        case 125:
-                        {
-                            scriptEng.operands[i] = actNumber;
-                            break;
-                        }
-                        case 126:
-                        {
-                            scriptEng.operands[i] = pauseEnabled;
-                            break;
-                        }
-                        case 127:
-                        {
-                            switch (activeStageList)
-                            {
-                                case 0:
-                                {
-                                    scriptEng.operands[i] = noPresentationStages;
-                                    break;
-                                }
-                                case 1:
-                                {
-                                    scriptEng.operands[i] = noZoneStages;
-                                    break;
-                                }
-                                case 2:
-                                {
-                                    scriptEng.operands[i] = noBonusStages;
-                                    break;
-                                }
-                                case 3:
-                                {
-                                    scriptEng.operands[i] = noSpecialStages;
-                                    break;
-                                }
-                            }
-                            break;
-                        }
-                        case 128:
-                        {
-                            scriptEng.operands[i] = newXBoundary1;
-                            break;
-                        }
-                        case 129:
-                        {
-                            scriptEng.operands[i] = newXBoundary2;
-                            break;
-                        }
-                        case 130:
-                        {
-                            scriptEng.operands[i] = newYBoundary1;
-                            break;
-                        }
-                        case 131:
-                        {
-                            scriptEng.operands[i] = newYBoundary2;
-                            break;
-                        }
-                        case 132:
-                        {
-                            scriptEng.operands[i] = xBoundary1;
-                            break;
-                        }
-                        case 133:
-                        {
-                            scriptEng.operands[i] = xBoundary2;
-                            break;
-                        }
-                        case 134:
-                        {
-                            scriptEng.operands[i] = yBoundary1;
-                            break;
-                        }
-                        case 135:
-                        {
-                            scriptEng.operands[i] = yBoundary2;
-                            break;
-                        }
-                        case 136:
-                        {
-                            scriptEng.operands[i] = bgDeformationData0[num1];
-                            break;
-                        }
-                        case 137:
-                        {
-                            scriptEng.operands[i] = bgDeformationData1[num1];
-                            break;
-                        }
-                        case 138:
-                        {
-                            scriptEng.operands[i] = bgDeformationData2[num1];
-                            break;
-                        }
-                        case 139:
-                        {
-                            scriptEng.operands[i] = bgDeformationData3[num1];
-                            break;
-                        }
-                        case 140:
-                        {
-                            scriptEng.operands[i] = waterLevel;
-                            break;
-                        }
-                        case 141:
-                        {
-                            scriptEng.operands[i] = activeTileLayers[num1];
-                            break;
-                        }
-                        case 142:
-                        {
-                            scriptEng.operands[i] = tLayerMidPoint;
-                            break;
-                        }
-                        case 143:
-                        {
-                            scriptEng.operands[i] = playerMenuNum;
-                            break;
-                        }
-                        case 144:
-                        {
-                            scriptEng.operands[i] = playerNum;
-                            break;
-                        }
-                        case 145:
-                        {
-                            scriptEng.operands[i] = cameraEnabled;
-                            break;
-                        }
-                        case 146:
-                        {
-                            scriptEng.operands[i] = cameraTarget;
-                            break;
-                        }
-                        case 147:
-                        {
-                            scriptEng.operands[i] = cameraStyle;
-                            break;
-                        }
-                        case 148:
-                        {
-                            scriptEng.operands[i] = objectDrawOrderList[num1].listSize;
-                            break;
-                        }
-                        case 149:
-                        {
-                            scriptEng.operands[i] = SCREEN_CENTER;
-                            break;
-                        }
-                        case 150:
-                        {
-                            scriptEng.operands[i] = 120;
-                            break;
-                        }
-                        case 151:
-                        {
-                            scriptEng.operands[i] = SCREEN_XSIZE;
-                            break;
-                        }
-                        case 152:
-                        {
-                            scriptEng.operands[i] = 240;
-                            break;
-                        }
-                        case 153:
-                        {
-                            scriptEng.operands[i] = xScrollOffset;
-                            break;
-                        }
-                        case 154:
-                        {
-                            scriptEng.operands[i] = yScrollOffset;
-                            break;
-                        }
-                        case 155:
-                        {
-                            scriptEng.operands[i] = screenShakeX;
-                            break;
-                        }
-                        case 156:
-                        {
-                            scriptEng.operands[i] = screenShakeY;
-                            break;
-                        }
-                        case 157:
-                        {
-                            scriptEng.operands[i] = cameraAdjustY;
-                            break;
-                        }
-                        case 158:
-                        {
-                            scriptEng.operands[i] = gKeyDown.touchDown[num1];
-                            break;
-                        }
-                        case 159:
-                        {
-                            scriptEng.operands[i] = gKeyDown.touchX[num1];
-                            break;
-                        }
-                        case 160:
-                        {
-                            scriptEng.operands[i] = gKeyDown.touchY[num1];
-                            break;
-                        }
-                        case 161:
-                        {
-                            scriptEng.operands[i] = musicVolume;
-                            break;
-                        }
-                        case 162:
-                        {
-                            scriptEng.operands[i] = currentMusicTrack;
-                            break;
-                        }
-                        case 163:
-                        {
-                            scriptEng.operands[i] = gKeyDown.up;
-                            break;
-                        }
-                        case 164:
-                        {
-                            scriptEng.operands[i] = gKeyDown.down;
-                            break;
-                        }
-                        case 165:
-                        {
-                            scriptEng.operands[i] = gKeyDown.left;
-                            break;
-                        }
-                        case 166:
-                        {
-                            scriptEng.operands[i] = gKeyDown.right;
-                            break;
-                        }
-                        case 167:
-                        {
-                            scriptEng.operands[i] = gKeyDown.buttonA;
-                            break;
-                        }
-                        case 168:
-                        {
-                            scriptEng.operands[i] = gKeyDown.buttonB;
-                            break;
-                        }
-                        case 169:
-                        {
-                            scriptEng.operands[i] = gKeyDown.buttonC;
-                            break;
-                        }
-                        case 170:
-                        {
-                            scriptEng.operands[i] = gKeyDown.start;
-                            break;
-                        }
-                        case 171:
-                        {
-                            scriptEng.operands[i] = gKeyPress.up;
-                            break;
-                        }
-                        case 172:
-                        {
-                            scriptEng.operands[i] = gKeyPress.down;
-                            break;
-                        }
-                        case 173:
-                        {
-                            scriptEng.operands[i] = gKeyPress.left;
-                            break;
-                        }
-                        case 174:
-                        {
-                            scriptEng.operands[i] = gKeyPress.right;
-                            break;
-                        }
-                        case 175:
-                        {
-                            scriptEng.operands[i] = gKeyPress.buttonA;
-                            break;
-                        }
-                        case 176:
-                        {
-                            scriptEng.operands[i] = gKeyPress.buttonB;
-                            break;
-                        }
-                        case 177:
-                        {
-                            scriptEng.operands[i] = gKeyPress.buttonC;
-                            break;
-                        }
-                        case 178:
-                        {
-                            scriptEng.operands[i] = gKeyPress.start;
-                            break;
-                        }
-                        case 179:
-                        {
-                            scriptEng.operands[i] = gameMenu[0].selection1;
-                            break;
-                        }
-                        case 180:
-                        {
-                            scriptEng.operands[i] = gameMenu[1].selection1;
-                            break;
-                        }
-                        case 181:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].xSize;
-                            break;
-                        }
-                        case 182:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].ySize;
-                            break;
-                        }
-                        case 183:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].type;
-                            break;
-                        }
-                        case 184:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].angle;
-                            break;
-                        }
-                        case 185:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].xPos;
-                            break;
-                        }
-                        case 186:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].yPos;
-                            break;
-                        }
-                        case 187:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].zPos;
-                            break;
-                        }
-                        case 188:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].parallaxFactor;
-                            break;
-                        }
-                        case 189:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].scrollSpeed;
-                            break;
-                        }
-                        case 190:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].scrollPosition;
-                            break;
-                        }
-                        case 191:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].deformationPos;
-                            break;
-                        }
-                        case 192:
-                        {
-                            scriptEng.operands[i] = stageLayouts[num1].deformationPosW;
-                            break;
-                        }
-                        case 193:
-                        {
-                            scriptEng.operands[i] = hParallax.parallaxFactor[num1];
-                            break;
-                        }
-                        case 194:
-                        {
-                            scriptEng.operands[i] = hParallax.scrollSpeed[num1];
-                            break;
-                        }
-                        case 195:
-                        {
-                            scriptEng.operands[i] = hParallax.scrollPosition[num1];
-                            break;
-                        }
-                        case 196:
-                        {
-                            scriptEng.operands[i] = vParallax.parallaxFactor[num1];
-                            break;
-                        }
-                        case 197:
-                        {
-                            scriptEng.operands[i] = vParallax.scrollSpeed[num1];
-                            break;
-                        }
-                        case 198:
-                        {
-                            scriptEng.operands[i] = vParallax.scrollPosition[num1];
-                            break;
-                        }
-                        case 199:
-                        {
-                            scriptEng.operands[i] = numVertices;
-                            break;
-                        }
-                        case 200:
-                        {
-                            scriptEng.operands[i] = numFaces;
-                            break;
-                        }
-                        case 201:
-                        {
-                            scriptEng.operands[i] = vertexBuffer[num1].x;
-                            break;
-                        }
-                        case 202:
-                        {
-                            scriptEng.operands[i] = vertexBuffer[num1].y;
-                            break;
-                        }
-                        case 203:
-                        {
-                            scriptEng.operands[i] = vertexBuffer[num1].z;
-                            break;
-                        }
-                        case 204:
-                        {
-                            scriptEng.operands[i] = vertexBuffer[num1].u;
-                            break;
-                        }
-                        case 205:
-                        {
-                            scriptEng.operands[i] = vertexBuffer[num1].v;
-                            break;
-                        }
-                        case 206:
-                        {
-                            scriptEng.operands[i] = indexBuffer[num1].a;
-                            break;
-                        }
-                        case 207:
-                        {
-                            scriptEng.operands[i] = indexBuffer[num1].b;
-                            break;
-                        }
-                        case 208:
-                        {
-                            scriptEng.operands[i] = indexBuffer[num1].c;
-                            break;
-                        }
-                        case 209:
-                        {
-                            scriptEng.operands[i] = indexBuffer[num1].d;
-                            break;
-                        }
-                        case 210:
-                        {
-                            scriptEng.operands[i] = indexBuffer[num1].flag;
-                            break;
-                        }
-                        case 211:
-                        {
-                            scriptEng.operands[i] = indexBuffer[num1].color;
-                            break;
-                        }
-                        case 212:
-                        {
-                            scriptEng.operands[i] = projectionX;
-                            break;
-                        }
-                        case 213:
-                        {
-                            scriptEng.operands[i] = projectionY;
-                            break;
-                        }
-                        case 214:
-                        {
-                            scriptEng.operands[i] = gameMode;
-                            break;
-                        }
-                        case 215:
-                        {
-                            scriptEng.operands[i] = debugMode;
-                            break;
-                        }
-                        case 216:
-                        {
-                            scriptEng.operands[i] = gameMessage;
-                            break;
-                        }
-                        case 217:
-                        {
-                            scriptEng.operands[i] = saveRAM[num1];
-                            break;
-                        }
-                        case 218:
-                        {
-                            scriptEng.operands[i] = gameLanguage;
-                            break;
-                        }
-                        case 219:
-                        {
-                            scriptEng.operands[i] = objectScriptList[objectEntityList[objectLoop].type].surfaceNum;
-                            break;
-                        }
-                        case 220:
-                        {
-                            scriptEng.operands[i] = gameOnlineActive;
-                            break;
-                        }
-                        case 221:
-                        {
-                            scriptEng.operands[i] = frameSkipTimer;
-                            break;
-                        }
-                        case 222:
-                        {
-                            scriptEng.operands[i] = frameSkipSetting;
-                            break;
-                        }
-                        case 223:
-                        {
-                            scriptEng.operands[i] = gameSFXVolume;
-                            break;
-                        }
-                        case 224:
-                        {
-                            scriptEng.operands[i] = gameBGMVolume;
-                            break;
-                        }
-                        case 225:
-                        {
-                            scriptEng.operands[i] = gamePlatformID;
-                            break;
-                        }
-                        case 226:
-                        {
-                            scriptEng.operands[i] = gameTrialMode;
-                            break;
-                        }
-                        case 227:
-                        {
-                            scriptEng.operands[i] = gKeyPress.start;
-                            break;
-                        }
-                        case 228:
-                        {
-                            scriptEng.operands[i] = gameHapticsEnabled;
-                            break;
-                        }
-                    }
-                    scriptCodePtr++;
-                    num4++;
-                    break;
-                }
-                case 2:
-                {
-                    scriptCodePtr++;
-                    scriptEng.operands[i] = scriptData[scriptCodePtr];
-                    scriptCodePtr++;
-                    num4 = num4 + 2;
-                    break;
-                }
-                case 3:
-                {
-                    scriptCodePtr++;
-                    num4++;
-                    num = 0;
-                    num1 = 0;
-                    scriptEng.sRegister = scriptData[scriptCodePtr];
-                    scriptText[scriptEng.sRegister] = '\0';
-                    while (num < scriptEng.sRegister)
-                    {
-                        switch (num1)
-                        {
-                            case 0:
-                            {
-                                scriptCodePtr++;
-                                num4++;
-                                scriptText[num] = (char)(scriptData[scriptCodePtr] >> 24);
-                                num1++;
-                                break;
-                            }
-                            case 1:
-                            {
-                                scriptText[num] = (char)((scriptData[scriptCodePtr] & 0xffffff) >> 16);
-                                num1++;
-                                break;
-                            }
-                            case 2:
-                            {
-                                scriptText[num] = (char)((scriptData[scriptCodePtr] & 0xffff) >> 8);
-                                num1++;
-                                break;
-                            }
-                            case 3:
-                            {
-                                scriptText[num] = (char)(scriptData[scriptCodePtr] & 0xff);
-                                num1 = 0;
-                                break;
-                            }
-                        }
-                        num++;
-                    }
-                    if (num1 != 0)
-                    {
-                        scriptCodePtr++;
-                        num4++;
-                        break;
-                    }
-                    else
-                    {
-                        scriptCodePtr = scriptCodePtr + 2;
-                        num4 = num4 + 2;
-                        break;
-                    }
-                }
-            }
-        }
-        switch (num3)
-        {
-            case 0:
-            {
-                flag = true;
-                break;
-            }
-            case 1:
-            {
-                scriptEng.operands[0] = scriptEng.operands[1];
-                break;
-            }
-            case 2:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] + scriptEng.operands[1];
-                break;
-            }
-            case 3:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] - scriptEng.operands[1];
-                break;
-            }
-            case 4:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] + 1;
-                break;
-            }
-            case 5:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] - 1;
-                break;
-            }
-            case 6:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] * scriptEng.operands[1];
-                break;
-            }
-            case 7:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] / scriptEng.operands[1];
-                break;
-            }
-            case 8:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] >> (scriptEng.operands[1] & 31);
-                break;
-            }
-            case 9:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] << (scriptEng.operands[1] & 31);
-                break;
-            }
-            case 10:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] & scriptEng.operands[1];
-                break;
-            }
-            case 11:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] | scriptEng.operands[1];
-                break;
-            }
-            case 12:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] ^ scriptEng.operands[1];
-                break;
-            }
-            case 13:
-            {
-                scriptEng.operands[0] = scriptEng.operands[0] % scriptEng.operands[1];
-                break;
-            }
-            case 14:
-            {
-                scriptEng.operands[0] = -scriptEng.operands[0];
-                break;
-            }
-            case 15:
-            {
-                if (scriptEng.operands[0] != scriptEng.operands[1])
-                {
-                    scriptEng.checkResult = 0;
-                }
-                else
-                {
-                    scriptEng.checkResult = 1;
-                }
-                num5 = 0;
-                break;
-            }
-            case 16:
-            {
-                if (scriptEng.operands[0] <= scriptEng.operands[1])
-                {
-                    scriptEng.checkResult = 0;
-                }
-                else
-                {
-                    scriptEng.checkResult = 1;
-                }
-                num5 = 0;
-                break;
-            }
-            case 17:
-            {
-                if (scriptEng.operands[0] >= scriptEng.operands[1])
-                {
-                    scriptEng.checkResult = 0;
-                }
-                else
-                {
-                    scriptEng.checkResult = 1;
-                }
-                num5 = 0;
-                break;
-            }
-            case 18:
-            {
-                if (scriptEng.operands[0] == scriptEng.operands[1])
-                {
-                    scriptEng.checkResult = 0;
-                }
-                else
-                {
-                    scriptEng.checkResult = 1;
-                }
-                num5 = 0;
-                break;
-            }
-            case 19:
-            {
-                if (scriptEng.operands[1] != scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 20:
-            {
-                if (scriptEng.operands[1] <= scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 21:
-            {
-                if (scriptEng.operands[1] < scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 22:
-            {
-                if (scriptEng.operands[1] >= scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 23:
-            {
-                if (scriptEng.operands[1] > scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 24:
-            {
-                if (scriptEng.operands[1] == scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 25:
-            {
-                num5 = 0;
-                scriptCodePtr = num2;
-                scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + jumpTableStack[jumpTableStackPos] + 1];
-                jumpTableStackPos = jumpTableStackPos - 1;
-                break;
-            }
-            case 26:
-            {
-                num5 = 0;
-                jumpTableStackPos = jumpTableStackPos - 1;
-                break;
-            }
-            case 27:
-            {
-                if (scriptEng.operands[1] != scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 28:
-            {
-                if (scriptEng.operands[1] <= scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 29:
-            {
-                if (scriptEng.operands[1] < scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 30:
-            {
-                if (scriptEng.operands[1] >= scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 31:
-            {
-                if (scriptEng.operands[1] > scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 32:
-            {
-                if (scriptEng.operands[1] == scriptEng.operands[2])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
-                }
-                else
-                {
-                    jumpTableStackPos = jumpTableStackPos + 1;
-                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                }
-                num5 = 0;
-                break;
-            }
-            case 33:
-            {
-                num5 = 0;
-                scriptCodePtr = num2;
-                scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + jumpTableStack[jumpTableStackPos]];
-                jumpTableStackPos = jumpTableStackPos - 1;
-                break;
-            }
-            case 34:
-            {
-                jumpTableStackPos = jumpTableStackPos + 1;
-                jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
-                if (scriptEng.operands[1] < jumpTableData[jumpTablePtr + scriptEng.operands[0]] || scriptEng.operands[1] > jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1])
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 2];
-                }
-                else
-                {
-                    scriptCodePtr = num2;
-                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 4 + (scriptEng.operands[1] - jumpTableData[jumpTablePtr + scriptEng.operands[0]])];
-                }
-                num5 = 0;
-                break;
-            }
-            case 35:
-            {
-                num5 = 0;
-                scriptCodePtr = num2;
-                scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + jumpTableStack[jumpTableStackPos] + 3];
-                jumpTableStackPos = jumpTableStackPos - 1;
-                break;
-            }
-            case 36:
-            {
-                num5 = 0;
-                jumpTableStackPos = jumpTableStackPos - 1;
-                break;
-            }
-            case 37:
-            {
-                scriptEng.operands[0] = rand() % scriptEng.operands[1];
-                break;
-            }
-            case 38:
-            {
-                scriptEng.sRegister = scriptEng.operands[1];
-                if (scriptEng.sRegister < 0)
-                {
-                    scriptEng.sRegister = 0x200 - scriptEng.sRegister;
-                }
-                scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
-                scriptEng.operands[0] = SinValue512[scriptEng.sRegister];
-                break;
-            }
-            case 39:
-            {
-                scriptEng.sRegister = scriptEng.operands[1];
-                if (scriptEng.sRegister < 0)
-                {
-                    scriptEng.sRegister = 0x200 - scriptEng.sRegister;
-                }
-                scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
-                scriptEng.operands[0] = CosValue512[scriptEng.sRegister];
-                break;
-            }
-            case 40:
-            {
-                scriptEng.sRegister = scriptEng.operands[1];
-                if (scriptEng.sRegister < 0)
-                {
-                    scriptEng.sRegister = 0x100 - scriptEng.sRegister;
-                }
-                scriptEng.sRegister = scriptEng.sRegister & 0xff;
-                scriptEng.operands[0] = SinValue256[scriptEng.sRegister];
-                break;
-            }
-            case 41:
-            {
-                scriptEng.sRegister = scriptEng.operands[1];
-                if (scriptEng.sRegister < 0)
-                {
-                    scriptEng.sRegister = 0x100 - scriptEng.sRegister;
-                }
-                scriptEng.sRegister = scriptEng.sRegister & 0xff;
-                scriptEng.operands[0] = CosValue256[scriptEng.sRegister];
-                break;
-            }
-            case 42:
-            {
-                scriptEng.sRegister = scriptEng.operands[1];
-                if (scriptEng.sRegister < 0)
-                {
-                    scriptEng.sRegister = 0x200 - scriptEng.sRegister;
-                }
-                scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
-                scriptEng.operands[0] = (SinValue512[scriptEng.sRegister] >> (scriptEng.operands[2] & 31)) + scriptEng.operands[3] - scriptEng.operands[4];
-                break;
-            }
-            case 43:
-            {
-                scriptEng.sRegister = scriptEng.operands[1];
-                if (scriptEng.sRegister < 0)
-                {
-                    scriptEng.sRegister = 0x200 - scriptEng.sRegister;
-                }
-                scriptEng.sRegister = scriptEng.sRegister & 0x1ff;
-                scriptEng.operands[0] = (CosValue512[scriptEng.sRegister] >> (scriptEng.operands[2] & 31)) + scriptEng.operands[3] - scriptEng.operands[4];
-                break;
-            }
-            case 44:
-            {
-                scriptEng.operands[0] = GlobalAppDefinitions_ArcTanLookup(scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            }
-            case 45:
-            {
-                scriptEng.operands[0] = (scriptEng.operands[1] * scriptEng.operands[3] + scriptEng.operands[2] * (0x100 - scriptEng.operands[3])) >> 8;
-                break;
-            }
-            case 46:
-            {
-                scriptEng.operands[0] = (scriptEng.operands[2] * scriptEng.operands[6] >> 8) + (scriptEng.operands[3] * (0x100 - scriptEng.operands[6]) >> 8);
-                scriptEng.operands[1] = (scriptEng.operands[4] * scriptEng.operands[6] >> 8) + (scriptEng.operands[5] * (0x100 - scriptEng.operands[6]) >> 8);
-                break;
-            }
-            case 47:
-            {
-                num5 = 0;
-                objectScriptList[objectEntityList[objectLoop].type].surfaceNum = GraphicsSystem_AddGraphicsFile(scriptText);
-                break;
-            }
-            case 48:
-            {
-                num5 = 0;
-                GraphicsSystem_RemoveGraphicsFile(scriptText, -1);
-                break;
-            }
-            case 49:
-            {
-                num5 = 0;
-                GraphicsSystem_DrawSprite((objectEntityList[objectLoop].xPos >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (objectEntityList[objectLoop].yPos >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                break;
-            }
-            case 50:
-            {
-                num5 = 0;
-                GraphicsSystem_DrawSprite((scriptEng.operands[1] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[2] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                break;
-            }
-            case 51:
-            {
-                num5 = 0;
-                GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                break;
-            }
-            case 52:
-            {
-                num5 = 0;
-                GraphicsSystem_DrawTintRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                break;
-            }
-            case 53:
-            {
-                num5 = 0;
-                scriptEng.operands[7] = 10;
-                if (scriptEng.operands[6] != 0)
-                {
-                    while (scriptEng.operands[4] > 0)
-                    {
-                        scriptEng.sRegister = (scriptEng.operands[3] - scriptEng.operands[3] / scriptEng.operands[7] * scriptEng.operands[7]) / (scriptEng.operands[7] / 10);
-                        scriptEng.sRegister = scriptEng.sRegister + scriptEng.operands[0];
-                        GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        scriptEng.operands[1] = scriptEng.operands[1] - scriptEng.operands[5];
-                        scriptEng.operands[7] = scriptEng.operands[7] * 10;
-                        scriptEng.operands[4] = scriptEng.operands[4] - 1;
-                    }
-                    break;
-                }
-                else
-                {
-                    if (scriptEng.operands[3] != 0)
-                    {
-                        scriptEng.operands[8] = scriptEng.operands[3] * 10;
-                    }
-                    else
-                    {
-                        scriptEng.operands[8] = 10;
-                    }
-                    while (scriptEng.operands[4] > 0)
-                    {
-                        if (scriptEng.operands[8] >= scriptEng.operands[7])
-                        {
-                            scriptEng.sRegister = (scriptEng.operands[3] - scriptEng.operands[3] / scriptEng.operands[7] * scriptEng.operands[7]) / (scriptEng.operands[7] / 10);
-                            scriptEng.sRegister = scriptEng.sRegister + scriptEng.operands[0];
-                            GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.sRegister].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        }
-                        scriptEng.operands[1] = scriptEng.operands[1] - scriptEng.operands[5];
-                        scriptEng.operands[7] = scriptEng.operands[7] * 10;
-                        scriptEng.operands[4] = scriptEng.operands[4] - 1;
-                    }
-                    break;
-                }
-            }
-            case 54:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[3])
-                {
-                    case 1:
-                    {
-                        scriptEng.sRegister = 0;
-                        if (scriptEng.operands[4] == 1 && titleCardText[scriptEng.sRegister] != 0)
-                        {
-                            scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
-                            if (scriptEng.operands[7] == 32)
-                            {
-                                scriptEng.operands[7] = 0;
-                            }
-                            if (scriptEng.operands[7] == 45)
-                            {
-                                scriptEng.operands[7] = 0;
-                            }
-                            if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] - 22;
-                            }
-                            if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] - 65;
-                            }
-                            if (scriptEng.operands[7] <= -1)
-                            {
-                                scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
-                            }
-                            else
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
-                                GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
-                            }
-                            scriptEng.operands[0] = scriptEng.operands[0] + 26;
-                            scriptEng.sRegister = scriptEng.sRegister + 1;
-                        }
-                        while (titleCardText[scriptEng.sRegister] != 0)
-                        {
-                            if (titleCardText[scriptEng.sRegister] != '-')
-                            {
-                                scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
-                                if (scriptEng.operands[7] == 32)
-                                {
-                                    scriptEng.operands[7] = 0;
-                                }
-                                if (scriptEng.operands[7] == 45)
-                                {
-                                    scriptEng.operands[7] = 0;
-                                }
-                                if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
-                                {
-                                    scriptEng.operands[7] = scriptEng.operands[7] - 22;
-                                }
-                                if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
-                                {
-                                    scriptEng.operands[7] = scriptEng.operands[7] - 65;
-                                }
-                                if (scriptEng.operands[7] <= -1)
-                                {
-                                    scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
-                                }
-                                else
-                                {
-                                    scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
-                                    GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                    scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
-                                }
-                                scriptEng.sRegister = scriptEng.sRegister + 1;
-                            }
-                        }
-                        break;
-                    }
-                    case 2:
-                    {
-                        scriptEng.sRegister = titleCardWord2;
-                        if (scriptEng.operands[4] == 1 && titleCardText[scriptEng.sRegister] != 0)
-                        {
-                            scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
-                            if (scriptEng.operands[7] == 32)
-                            {
-                                scriptEng.operands[7] = 0;
-                            }
-                            if (scriptEng.operands[7] == 45)
-                            {
-                                scriptEng.operands[7] = 0;
-                            }
-                            if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] - 22;
-                            }
-                            if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] - 65;
-                            }
-                            if (scriptEng.operands[7] <= -1)
-                            {
-                                scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
-                            }
-                            else
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
-                                GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
-                            }
-                            scriptEng.operands[0] = scriptEng.operands[0] + 26;
-                            scriptEng.sRegister = scriptEng.sRegister + 1;
-                        }
-                        while (titleCardText[scriptEng.sRegister] != 0)
-                        {
-                            scriptEng.operands[7] = titleCardText[scriptEng.sRegister];
-                            if (scriptEng.operands[7] == 32)
-                            {
-                                scriptEng.operands[7] = 0;
-                            }
-                            if (scriptEng.operands[7] == 45)
-                            {
-                                scriptEng.operands[7] = 0;
-                            }
-                            if (scriptEng.operands[7] > 47 && scriptEng.operands[7] < 58)
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] - 22;
-                            }
-                            if (scriptEng.operands[7] > 57 && scriptEng.operands[7] < 102)
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] - 65;
-                            }
-                            if (scriptEng.operands[7] <= -1)
-                            {
-                                scriptEng.operands[1] = scriptEng.operands[1] + scriptEng.operands[5] + scriptEng.operands[6];
-                            }
-                            else
-                            {
-                                scriptEng.operands[7] = scriptEng.operands[7] + scriptEng.operands[0];
-                                GraphicsSystem_DrawSprite(scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xPivot, scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                scriptEng.operands[1] = scriptEng.operands[1] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[7]].xSize + scriptEng.operands[6];
-                            }
-                            scriptEng.sRegister = scriptEng.sRegister + 1;
-                        }
-                        break;
-                    }
-                }
-                break;
-            }
-            case 55:
-            {
-                num5 = 0;
-                textMenuSurfaceNo = objectScriptList[objectEntityList[objectLoop].type].surfaceNum;
-                TextSystem_DrawTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            }
-            case 56:
-            {
-                num5 = 0;
-                if (scriptSub != 3 || scriptFramesNo >= 0x1000)
-                {
-                    break;
-                }
-                scriptFrames[scriptFramesNo].xPivot = scriptEng.operands[0];
-                scriptFrames[scriptFramesNo].yPivot = scriptEng.operands[1];
-                scriptFrames[scriptFramesNo].xSize = scriptEng.operands[2];
-                scriptFrames[scriptFramesNo].ySize = scriptEng.operands[3];
-                scriptFrames[scriptFramesNo].left = scriptEng.operands[4];
-                scriptFrames[scriptFramesNo].top = scriptEng.operands[5];
-                scriptFramesNo = scriptFramesNo + 1;
-                break;
-            }
-            case 57:
-            {
-                num5 = 0;
-                break;
-            }
-            case 58:
-            {
-                num5 = 0;
-                GraphicsSystem_LoadPalette(scriptText, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4]);
-                break;
-            }
-            case 59:
-            {
-                num5 = 0;
-                GraphicsSystem_RotatePalette((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1], (uint8_t)scriptEng.operands[2]);
-                break;
-            }
-            case 60:
-            {
-                num5 = 0;
-                GraphicsSystem_SetFade((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1], (uint8_t)scriptEng.operands[2], (uint16_t)scriptEng.operands[3]);
-                break;
-            }
-            case 61:
-            {
-                num5 = 0;
-                GraphicsSystem_SetActivePalette((uint8_t)scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            }
-            case 62:
-            {
-                GraphicsSystem_SetLimitedFade((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1], (uint8_t)scriptEng.operands[2], (uint8_t)scriptEng.operands[3], (uint16_t)scriptEng.operands[4], scriptEng.operands[5], scriptEng.operands[6]);
-                break;
-            }
-            case 63:
-            {
-                num5 = 0;
-                GraphicsSystem_CopyPalette((uint8_t)scriptEng.operands[0], (uint8_t)scriptEng.operands[1]);
-                break;
-            }
-            case 64:
-            {
-                num5 = 0;
-                GraphicsSystem_ClearScreen((uint8_t)scriptEng.operands[0]);
-                break;
-            }
-            case 65:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[1])
-                {
-                    case 0:
-                    {
-                        GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        break;
-                    }
-                    case 1:
-                    {
-                        GraphicsSystem_DrawRotatedSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        break;
-                    }
-                    case 2:
-                    {
-                        GraphicsSystem_DrawRotoZoomSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, objectEntityList[objectLoop].scale, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        break;
-                    }
-                    case 3:
-                    {
-                        switch (objectEntityList[objectLoop].inkEffect)
-                        {
-                            case 0:
-                            {
-                                GraphicsSystem_DrawSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 1:
-                            {
-                                GraphicsSystem_DrawBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 2:
-                            {
-                                GraphicsSystem_DrawAlphaBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 3:
-                            {
-                                GraphicsSystem_DrawAdditiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 4:
-                            {
-                                GraphicsSystem_DrawSubtractiveBlendedSprite((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                    case 4:
-                    {
-                        if (objectEntityList[objectLoop].inkEffect == 2)
-                        {
-                            GraphicsSystem_DrawScaledTintMask(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        }
-                        else
-                        {
-                            GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, (scriptEng.operands[2] >> 16) - xScrollOffset, (scriptEng.operands[3] >> 16) - yScrollOffset, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        }
-                        break;
-                    }
-                    case 5:
-                    {
-                        switch (objectEntityList[objectLoop].direction)
-                        {
-                            case 0:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 1:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 2:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 3:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped((scriptEng.operands[2] >> 16) - xScrollOffset - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, (scriptEng.operands[3] >> 16) - yScrollOffset - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                }
-                break;
-            }
-            case 66:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[1])
-                {
-                    case 0:
-                    {
-                        GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        break;
-                    }
-                    case 1:
-                    {
-                        GraphicsSystem_DrawRotatedSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        break;
-                    }
-                    case 2:
-                    {
-                        GraphicsSystem_DrawRotoZoomSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, objectEntityList[objectLoop].rotation, objectEntityList[objectLoop].scale, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        break;
-                    }
-                    case 3:
-                    {
-                        switch (objectEntityList[objectLoop].inkEffect)
-                        {
-                            case 0:
-                            {
-                                GraphicsSystem_DrawSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 1:
-                            {
-                                GraphicsSystem_DrawBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 2:
-                            {
-                                GraphicsSystem_DrawAlphaBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 3:
-                            {
-                                GraphicsSystem_DrawAdditiveBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 4:
-                            {
-                                GraphicsSystem_DrawSubtractiveBlendedSprite(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].alpha, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                    case 4:
-                    {
-                        if (objectEntityList[objectLoop].inkEffect == 2)
-                        {
-                            GraphicsSystem_DrawScaledTintMask(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        }
-                        else
-                        {
-                            GraphicsSystem_DrawScaledSprite(objectEntityList[objectLoop].direction, scriptEng.operands[2], scriptEng.operands[3], -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, -scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, objectEntityList[objectLoop].scale, objectEntityList[objectLoop].scale, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                        }
-                        break;
-                    }
-                    case 5:
-                    {
-                        switch (objectEntityList[objectLoop].direction)
-                        {
-                            case 0:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 1:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped(scriptEng.operands[2] - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 2:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped(scriptEng.operands[2] + scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                            case 3:
-                            {
-                                GraphicsSystem_DrawSpriteFlipped(scriptEng.operands[2] - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xPivot, scriptEng.operands[3] - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize - scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].yPivot, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].xSize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].ySize, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].left, scriptFrames[objectScriptList[objectEntityList[objectLoop].type].frameListOffset + scriptEng.operands[0]].top, (int)objectEntityList[objectLoop].direction, (int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                }
-                break;
-            }
-            case 67:
-            {
-                num5 = 0;
-                objectScriptList[objectEntityList[objectLoop].type].animationFile = AnimationSystem_AddAnimationFile(scriptText);
-                break;
-            }
-            case 68:
-            {
-                num5 = 0;
-                TextSystem_SetupTextMenu(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1]);
-                gameMenu[scriptEng.operands[0]].numSelections = (uint8_t)scriptEng.operands[2];
-                gameMenu[scriptEng.operands[0]].alignment = (uint8_t)scriptEng.operands[3];
-                break;
-            }
-            case 69:
-            {
-                num5 = 0;
-                gameMenu[scriptEng.operands[0]].entryHighlight[gameMenu[scriptEng.operands[0]].numRows] = (uint8_t)scriptEng.operands[2];
-                TextSystem_AddTextMenuEntry(&gameMenu[scriptEng.operands[0]], scriptText);
-                break;
-            }
-            case 70:
-            {
-                num5 = 0;
-                TextSystem_EditTextMenuEntry(&gameMenu[scriptEng.operands[0]], scriptText, scriptEng.operands[2]);
-                gameMenu[scriptEng.operands[0]].entryHighlight[scriptEng.operands[2]] = (uint8_t)scriptEng.operands[3];
-                break;
-            }
-            case 71:
-            {
-                num5 = 0;
-                stageMode = 0;
-                break;
-            }
-            case 72:
-            {
-                num5 = 0;
-                GraphicsSystem_DrawRectangle(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4], scriptEng.operands[5], scriptEng.operands[6], scriptEng.operands[7]);
-                break;
-            }
-            case 73:
-            {
-                num5 = 0;
-                objectEntityList[scriptEng.operands[0]].type = (uint8_t)scriptEng.operands[1];
-                objectEntityList[scriptEng.operands[0]].propertyValue = (uint8_t)scriptEng.operands[2];
-                objectEntityList[scriptEng.operands[0]].xPos = scriptEng.operands[3];
-                objectEntityList[scriptEng.operands[0]].yPos = scriptEng.operands[4];
-                objectEntityList[scriptEng.operands[0]].direction = 0;
-                objectEntityList[scriptEng.operands[0]].frame = 0;
-                objectEntityList[scriptEng.operands[0]].priority = 0;
-                objectEntityList[scriptEng.operands[0]].rotation = 0;
-                objectEntityList[scriptEng.operands[0]].state = 0;
-                objectEntityList[scriptEng.operands[0]].drawOrder = 3;
-                objectEntityList[scriptEng.operands[0]].scale = 0x200;
-                objectEntityList[scriptEng.operands[0]].inkEffect = 0;
-                objectEntityList[scriptEng.operands[0]].value[0] = 0;
-                objectEntityList[scriptEng.operands[0]].value[1] = 0;
-                objectEntityList[scriptEng.operands[0]].value[2] = 0;
-                objectEntityList[scriptEng.operands[0]].value[3] = 0;
-                objectEntityList[scriptEng.operands[0]].value[4] = 0;
-                objectEntityList[scriptEng.operands[0]].value[5] = 0;
-                objectEntityList[scriptEng.operands[0]].value[6] = 0;
-                objectEntityList[scriptEng.operands[0]].value[7] = 0;
-                break;
-            }
-            case 74:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        scriptEng.operands[5] = objectEntityList[objectLoop].xPos >> 16;
-                        scriptEng.operands[6] = objectEntityList[objectLoop].yPos >> 16;
-                        ObjectSystem_BasicCollision(scriptEng.operands[1] + scriptEng.operands[5], scriptEng.operands[2] + scriptEng.operands[6], scriptEng.operands[3] + scriptEng.operands[5], scriptEng.operands[4] + scriptEng.operands[6]);
-                        break;
-                    }
-                    case 1:
-                    case 2:
-                    {
-                        ObjectSystem_BoxCollision((scriptEng.operands[1] << 16) + objectEntityList[objectLoop].xPos, (scriptEng.operands[2] << 16) + objectEntityList[objectLoop].yPos, (scriptEng.operands[3] << 16) + objectEntityList[objectLoop].xPos, (scriptEng.operands[4] << 16) + objectEntityList[objectLoop].yPos);
-                        break;
-                    }
-                    case 3:
-                    {
-                        ObjectSystem_PlatformCollision((scriptEng.operands[1] << 16) + objectEntityList[objectLoop].xPos, (scriptEng.operands[2] << 16) + objectEntityList[objectLoop].yPos, (scriptEng.operands[3] << 16) + objectEntityList[objectLoop].xPos, (scriptEng.operands[4] << 16) + objectEntityList[objectLoop].yPos);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 75:
-            {
-                num5 = 0;
-                if (objectEntityList[scriptEng.arrayPosition[2]].type > 0)
-                {
-                    scriptEng.arrayPosition[2] = scriptEng.arrayPosition[2] + 1;
-                    if (scriptEng.arrayPosition[2] == 0x4a0)
-                    {
-                        scriptEng.arrayPosition[2] = 0x420;
-                    }
-                }
-                objectEntityList[scriptEng.arrayPosition[2]].type = (uint8_t)scriptEng.operands[0];
-                objectEntityList[scriptEng.arrayPosition[2]].propertyValue = (uint8_t)scriptEng.operands[1];
-                objectEntityList[scriptEng.arrayPosition[2]].xPos = scriptEng.operands[2];
-                objectEntityList[scriptEng.arrayPosition[2]].yPos = scriptEng.operands[3];
-                objectEntityList[scriptEng.arrayPosition[2]].direction = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].frame = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].priority = 1;
-                objectEntityList[scriptEng.arrayPosition[2]].rotation = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].state = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].drawOrder = 3;
-                objectEntityList[scriptEng.arrayPosition[2]].scale = 0x200;
-                objectEntityList[scriptEng.arrayPosition[2]].inkEffect = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].alpha = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].animation = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].prevAnimation = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].animationSpeed = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].animationTimer = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[0] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[1] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[2] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[3] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[4] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[5] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[6] = 0;
-                objectEntityList[scriptEng.arrayPosition[2]].value[7] = 0;
-                break;
-            }
-            case 76:
-            {
-                num5 = 0;
-                playerList[scriptEng.operands[0]].animationFile = objectScriptList[objectEntityList[scriptEng.operands[1]].type].animationFile;
-                playerList[scriptEng.operands[0]].objectPtr = &objectEntityList[scriptEng.operands[1]];
-                playerList[scriptEng.operands[0]].objectNum = scriptEng.operands[1];
-                break;
-            }
-            case 77:
-            {
-                num5 = 0;
-                if (playerList[playerNum].tileCollisions != 1)
-                {
-                    struct PlayerObject* playerObject = &playerList[playerNum];
-                    playerObject->xPos = playerObject->xPos + playerList[playerNum].xVelocity;
-                    struct PlayerObject* playerObject1 = &playerList[playerNum];
-                    playerObject1->yPos = playerObject1->yPos + playerList[playerNum].yVelocity;
-                    break;
-                }
-                else
-                {
-                    PlayerSystem_ProcessPlayerTileCollisions(&playerList[playerNum]);
-                    break;
-                }
-            }
-            case 78:
-            {
-                num5 = 0;
-                PlayerSystem_ProcessPlayerControl(&playerList[playerNum]);
-                break;
-            }
-            case 79:
-            {
-                AnimationSystem_ProcessObjectAnimation(&animationList[objectScriptList[objectEntityList[objectLoop].type].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop]);
-                num5 = 0;
-                break;
-            }
-            case 80:
-            {
-                num5 = 0;
-                AnimationSystem_DrawObjectAnimation(&animationList[objectScriptList[objectEntityList[objectLoop].type].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop], (objectEntityList[objectLoop].xPos >> 16) - xScrollOffset, (objectEntityList[objectLoop].yPos >> 16) - yScrollOffset);
-                break;
-            }
-            case 81:
-            {
-                num5 = 0;
-                if (playerList[playerNum].visible != 1)
-                {
-                    break;
-                }
-                if (cameraEnabled != playerNum)
-                {
-                    AnimationSystem_DrawObjectAnimation(&animationList[objectScriptList[objectEntityList[objectLoop].type].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop], (playerList[playerNum].xPos >> 16) - xScrollOffset, (playerList[playerNum].yPos >> 16) - yScrollOffset);
-                    break;
-                }
-                else
-                {
-                    AnimationSystem_DrawObjectAnimation(&animationList[objectScriptList[objectEntityList[objectLoop].type].animationFile->aniListOffset + objectEntityList[objectLoop].animation], &objectEntityList[objectLoop], playerList[playerNum].screenXPos, playerList[playerNum].screenYPos);
-                    break;
-                }
-            }
-            case 82:
-            {
-                num5 = 0;
-                if (scriptEng.operands[2] <= 1)
-                {
-                    AudioPlayback_SetMusicTrack(scriptText, scriptEng.operands[1], (uint8_t)scriptEng.operands[2], 0);
-                    break;
-                }
-                else
-                {
-                    AudioPlayback_SetMusicTrack(scriptText, scriptEng.operands[1], 1, (uint32_t)scriptEng.operands[2]);
-                    break;
-                }
-            }
-            case 83:
-            {
-                num5 = 0;
-                AudioPlayback_PlayMusic(scriptEng.operands[0]);
-                break;
-            }
-            case 84:
-            {
-                num5 = 0;
-                AudioPlayback_StopMusic();
-                break;
-            }
-            case 85:
-            {
-                num5 = 0;
-                AudioPlayback_PlaySfx(scriptEng.operands[0], (uint8_t)scriptEng.operands[1]);
-                break;
-            }
-            case 86:
-            {
-                num5 = 0;
-                AudioPlayback_StopSfx(scriptEng.operands[0]);
-                break;
-            }
-            case 87:
-            {
-                num5 = 0;
-                AudioPlayback_SetSfxAttributes(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2]);
-                break;
-            }
-            case 88:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        ObjectSystem_ObjectFloorCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        ObjectSystem_ObjectLWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        ObjectSystem_ObjectRWallCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 3:
-                    {
-                        ObjectSystem_ObjectRoofCollision(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 89:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        ObjectSystem_ObjectFloorGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        ObjectSystem_ObjectLWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        ObjectSystem_ObjectRWallGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 3:
-                    {
-                        ObjectSystem_ObjectRoofGrip(scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 90:
-            {
-                num5 = 0;
-                AudioPlayback_PauseSound();
-                EngineCallbacks_PlayVideoFile(scriptText);
-                AudioPlayback_ResumeSound();
-                break;
-            }
-            case 91:
-            {
-                num5 = 0;
-                break;
-            }
-            case 92:
-            {
-                num5 = 0;
-                AudioPlayback_PlaySfx(scriptEng.operands[0] + numGlobalSFX, (uint8_t)scriptEng.operands[1]);
-                break;
-            }
-            case 93:
-            {
-                num5 = 0;
-                AudioPlayback_StopSfx(scriptEng.operands[0] + numGlobalSFX);
-                break;
-            }
-            case 94:
-            {
-                scriptEng.operands[0] = ~scriptEng.operands[0];
-                break;
-            }
-            case 95:
-            {
-                num5 = 0;
-                Scene3D_TransformVertexBuffer();
-                Scene3D_Sort3DDrawList();
-                Scene3D_Draw3DScene((int)objectScriptList[objectEntityList[objectLoop].type].surfaceNum);
-                break;
-            }
-            case 96:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_SetIdentityMatrix(matWorld);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_SetIdentityMatrix(matView);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_SetIdentityMatrix(matTemp);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 97:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        switch (scriptEng.operands[1])
-                        {
-                            case 0:
-                            {
-                                Scene3D_MatrixMultiply(matWorld, matWorld);
-                                break;
-                            }
-                            case 1:
-                            {
-                                Scene3D_MatrixMultiply(matWorld, matView);
-                                break;
-                            }
-                            case 2:
-                            {
-                                Scene3D_MatrixMultiply(matWorld, matTemp);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                    case 1:
-                    {
-                        switch (scriptEng.operands[1])
-                        {
-                            case 0:
-                            {
-                                Scene3D_MatrixMultiply(matView, matWorld);
-                                break;
-                            }
-                            case 1:
-                            {
-                                Scene3D_MatrixMultiply(matView, matView);
-                                break;
-                            }
-                            case 2:
-                            {
-                                Scene3D_MatrixMultiply(matView, matTemp);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                    case 2:
-                    {
-                        switch (scriptEng.operands[1])
-                        {
-                            case 0:
-                            {
-                                Scene3D_MatrixMultiply(matTemp, matWorld);
-                                break;
-                            }
-                            case 1:
-                            {
-                                Scene3D_MatrixMultiply(matTemp, matView);
-                                break;
-                            }
-                            case 2:
-                            {
-                                Scene3D_MatrixMultiply(matTemp, matTemp);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                }
-                break;
-            }
-            case 98:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_MatrixTranslateXYZ(matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_MatrixTranslateXYZ(matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_MatrixTranslateXYZ(matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 99:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_MatrixScaleXYZ(matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_MatrixScaleXYZ(matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_MatrixScaleXYZ(matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 100:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_MatrixRotateX(matWorld, scriptEng.operands[1]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_MatrixRotateX(matView, scriptEng.operands[1]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_MatrixRotateX(matTemp, scriptEng.operands[1]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 101:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_MatrixRotateY(matWorld, scriptEng.operands[1]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_MatrixRotateY(matView, scriptEng.operands[1]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_MatrixRotateY(matTemp, scriptEng.operands[1]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 102:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_MatrixRotateZ(matWorld, scriptEng.operands[1]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_MatrixRotateZ(matView, scriptEng.operands[1]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_MatrixRotateZ(matTemp, scriptEng.operands[1]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 103:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_MatrixRotateXYZ(matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_MatrixRotateXYZ(matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_MatrixRotateXYZ(matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 104:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        Scene3D_TransformVertices(matWorld, scriptEng.operands[1], scriptEng.operands[2]);
-                        break;
-                    }
-                    case 1:
-                    {
-                        Scene3D_TransformVertices(matView, scriptEng.operands[1], scriptEng.operands[2]);
-                        break;
-                    }
-                    case 2:
-                    {
-                        Scene3D_TransformVertices(matTemp, scriptEng.operands[1], scriptEng.operands[2]);
-                        break;
-                    }
-                }
-                break;
-            }
-            case 105:
-            {
-                num5 = 0;
-                functionStack[functionStackPos] = scriptCodePtr;
-                functionStackPos = functionStackPos + 1;
-                functionStack[functionStackPos] = jumpTablePtr;
-                functionStackPos = functionStackPos + 1;
-                functionStack[functionStackPos] = num2;
-                functionStackPos = functionStackPos + 1;
-                scriptCodePtr = functionScriptList[scriptEng.operands[0]].mainScript;
-                num2 = scriptCodePtr;
-                jumpTablePtr = functionScriptList[scriptEng.operands[0]].mainJumpTable;
-                break;
-            }
-            case 106:
-            {
-                num5 = 0;
-                functionStackPos = functionStackPos - 1;
-                num2 = functionStack[functionStackPos];
-                functionStackPos = functionStackPos - 1;
-                jumpTablePtr = functionStack[functionStackPos];
-                functionStackPos = functionStackPos - 1;
-                scriptCodePtr = functionStack[functionStackPos];
-                break;
-            }
-            case 107:
-            {
-                num5 = 0;
-                StageSystem_SetLayerDeformation(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4], scriptEng.operands[5]);
-                break;
-            }
-            case 108:
-            {
-                num5 = 0;
-                scriptEng.checkResult = -1;
-                while (num5 < gKeyDown.touches)
-                {
-                    if (gKeyDown.touchDown[num5] == 1 && gKeyDown.touchX[num5] > scriptEng.operands[0] && gKeyDown.touchX[num5] < scriptEng.operands[2] && gKeyDown.touchY[num5] > scriptEng.operands[1] && gKeyDown.touchY[num5] < scriptEng.operands[3])
-                    {
-                        scriptEng.checkResult = num5;
-                    }
-                    num5 = (signed char)(num5 + 1);
-                }
-                num5 = 0;
-                break;
-            }
-            case 109:
-            {
-                if (scriptEng.operands[2] <= -1 || scriptEng.operands[3] <= -1)
-                {
-                    scriptEng.operands[0] = 0;
-                    break;
-                }
-                else
-                {
-                    scriptEng.operands[0] = stageLayouts[scriptEng.operands[1]].tileMap[scriptEng.operands[2] + (scriptEng.operands[3] << 8)];
-                    break;
-                }
-            }
-            case 110:
-            {
-                if (scriptEng.operands[2] <= -1 || scriptEng.operands[3] <= -1)
-                {
-                    break;
-                }
-                stageLayouts[scriptEng.operands[1]].tileMap[scriptEng.operands[2] + (scriptEng.operands[3] << 8)] = (uint16_t)scriptEng.operands[0];
-                break;
-            }
-            case 111:
-            {
-                scriptEng.operands[0] = (scriptEng.operands[1] & 1 << (scriptEng.operands[2] & 31)) >> (scriptEng.operands[2] & 31);
-                break;
-            }
-            case 112:
-            {
-                if (scriptEng.operands[2] <= 0)
-                {
-                    scriptEng.operands[0] = scriptEng.operands[0] & ~(1 << (scriptEng.operands[1] & 31));
-                    break;
-                }
-                else
-                {
-                    scriptEng.operands[0] = scriptEng.operands[0] | 1 << (scriptEng.operands[1] & 31);
-                    break;
-                }
-            }
-            case 113:
-            {
-                num5 = 0;
-                AudioPlayback_PauseSound();
-                break;
-            }
-            case 114:
-            {
-                num5 = 0;
-                AudioPlayback_ResumeSound();
-                break;
-            }
-            case 115:
-            {
-                num5 = 0;
-                objectDrawOrderList[scriptEng.operands[0]].listSize = 0;
-                break;
-            }
-            case 116:
-            {
-                num5 = 0;
-                objectDrawOrderList[scriptEng.operands[0]].entityRef[objectDrawOrderList[scriptEng.operands[0]].listSize] = scriptEng.operands[1];
-                struct ObjectDrawList* objectDrawList = &objectDrawOrderList[scriptEng.operands[0]];
-                objectDrawList->listSize = objectDrawList->listSize + 1;
-                break;
-            }
-            case 117:
-            {
-                scriptEng.operands[0] = objectDrawOrderList[scriptEng.operands[1]].entityRef[scriptEng.operands[2]];
-                break;
-            }
-            case 118:
-            {
-                num5 = 0;
-                objectDrawOrderList[scriptEng.operands[1]].entityRef[scriptEng.operands[2]] = scriptEng.operands[0];
-                break;
-            }
-            case 119:
-            {
-                scriptEng.operands[4] = scriptEng.operands[1] >> 7;
-                scriptEng.operands[5] = scriptEng.operands[2] >> 7;
-                if (scriptEng.operands[4] <= -1 || scriptEng.operands[5] <= -1)
-                {
-                    scriptEng.operands[6] = 0;
-                }
-                else
-                {
-                    scriptEng.operands[6] = stageLayouts[0].tileMap[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
-                }
-                scriptEng.operands[6] = scriptEng.operands[6] + ((scriptEng.operands[1] & 127) >> 4) + ((scriptEng.operands[2] & 127) >> 4 << 3);
-                switch (scriptEng.operands[3])
-                {
-                    case 0:
-                    {
-                        scriptEng.operands[0] = tile128x128.tile16x16[scriptEng.operands[6]];
-                        break;
-                    }
-                    case 1:
-                    {
-                        scriptEng.operands[0] = tile128x128.direction[scriptEng.operands[6]];
-                        break;
-                    }
-                    case 2:
-                    {
-                        scriptEng.operands[0] = tile128x128.visualPlane[scriptEng.operands[6]];
-                        break;
-                    }
-                    case 3:
-                    {
-                        scriptEng.operands[0] = tile128x128.collisionFlag[0][scriptEng.operands[6]];
-                        break;
-                    }
-                    case 4:
-                    {
-                        scriptEng.operands[0] = tile128x128.collisionFlag[1][scriptEng.operands[6]];
-                        break;
-                    }
-                    case 5:
-                    {
-                        scriptEng.operands[0] = tileCollisions[0].flags[tile128x128.tile16x16[scriptEng.operands[6]]];
-                        break;
-                    }
-                    case 6:
-                    {
-                        scriptEng.operands[0] = (int)tileCollisions[0].angle[tile128x128.tile16x16[scriptEng.operands[6]]];
-                        break;
-                    }
-                    case 7:
-                    {
-                        scriptEng.operands[0] = tileCollisions[1].flags[tile128x128.tile16x16[scriptEng.operands[6]]];
-                        break;
-                    }
-                    case 8:
-                    {
-                        scriptEng.operands[0] = (int)tileCollisions[1].angle[tile128x128.tile16x16[scriptEng.operands[6]]];
-                        break;
-                    }
-                }
-                break;
-            }
-            case 120:
-            {
-                num5 = 0;
-                GraphicsSystem_Copy16x16Tile(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            }
-            case 121:
-            {
-                scriptEng.operands[4] = scriptEng.operands[1] >> 7;
-                scriptEng.operands[5] = scriptEng.operands[2] >> 7;
-                if (scriptEng.operands[4] <= -1 || scriptEng.operands[5] <= -1)
-                {
-                    scriptEng.operands[6] = 0;
-                }
-                else
-                {
-                    scriptEng.operands[6] = stageLayouts[0].tileMap[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
-                }
-                scriptEng.operands[6] = scriptEng.operands[6] + ((scriptEng.operands[1] & 127) >> 4) + ((scriptEng.operands[2] & 127) >> 4 << 3);
-                switch (scriptEng.operands[3])
-                {
-                    case 0:
-                    {
-                        tile128x128.tile16x16[scriptEng.operands[6]] = (uint16_t)scriptEng.operands[0];
-                        tile128x128.gfxDataPos[scriptEng.operands[6]] = tile128x128.tile16x16[scriptEng.operands[6]] << 2;
-                        break;
-                    }
-                    case 1:
-                    {
-                        tile128x128.direction[scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
-                        break;
-                    }
-                    case 2:
-                    {
-                        tile128x128.visualPlane[scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
-                        break;
-                    }
-                    case 3:
-                    {
-                        tile128x128.collisionFlag[0][scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
-                        break;
-                    }
-                    case 4:
-                    {
-                        tile128x128.collisionFlag[1][scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
-                        break;
-                    }
-                    case 5:
-                    {
-                        tileCollisions[0].flags[tile128x128.tile16x16[scriptEng.operands[6]]] = (uint8_t)scriptEng.operands[0];
-                        break;
-                    }
-                    case 6:
-                    {
-                        tileCollisions[0].angle[tile128x128.tile16x16[scriptEng.operands[6]]] = (uint8_t)scriptEng.operands[0];
-                        break;
-                    }
-                }
-                break;
-            }
-            case 122:
-            {
-                scriptEng.operands[0] = -1;
-                scriptEng.sRegister = 0;
-                while (scriptEng.operands[0] == -1)
-                {
-                    if (!FileIO_StringComp(scriptText, animationList[playerList[playerNum].animationFile->aniListOffset + scriptEng.sRegister].name))
-                    {
-                        scriptEng.sRegister = scriptEng.sRegister + 1;
-                        if (scriptEng.sRegister != playerList[playerNum].animationFile->numAnimations)
-                        {
-                            continue;
-                        }
-                        scriptEng.operands[0] = 0;
-                    }
-                    else
-                    {
-                        scriptEng.operands[0] = scriptEng.sRegister;
-                    }
-                }
-                break;
-            }
-            case 123:
-            {
-                num5 = 0;
-                scriptEng.checkResult = FileIO_ReadSaveRAMData();
-                break;
-            }
-            case 124:
-            {
-                num5 = 0;
-                scriptEng.checkResult = FileIO_WriteSaveRAMData();
-                break;
-            }
-            case 125:
-            {
-                num5 = 0;
-                TextSystem_LoadFontFile(scriptText);
-                break;
-            }
-            case 126:
-            {
-                num5 = 0;
-                if (scriptEng.operands[2] != 0)
-                {
-                    TextSystem_LoadTextFile(&gameMenu[scriptEng.operands[0]], scriptText, 1);
-                    break;
-                }
-                else
-                {
-                    TextSystem_LoadTextFile(&gameMenu[scriptEng.operands[0]], scriptText, 0);
-                    break;
-                }
-            }
-            case 127:
-            {
-                num5 = 0;
-                textMenuSurfaceNo = objectScriptList[objectEntityList[objectLoop].type].surfaceNum;
-                TextSystem_DrawBitmapText(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4], scriptEng.operands[5], scriptEng.operands[6]);
-                break;
-            }
-            case 128:
-            {
-                switch (scriptEng.operands[2])
-                {
-                    case 0:
-                    {
-                        scriptEng.operands[0] = gameMenu[scriptEng.operands[1]].textData[gameMenu[scriptEng.operands[1]].entryStart[scriptEng.operands[3]] + scriptEng.operands[4]];
-                        break;
-                    }
-                    case 1:
-                    {
-                        scriptEng.operands[0] = gameMenu[scriptEng.operands[1]].entrySize[scriptEng.operands[3]];
-                        break;
-                    }
-                    case 2:
-                    {
-                        scriptEng.operands[0] = gameMenu[scriptEng.operands[1]].numRows;
-                        break;
-                    }
-                }
-                break;
-            }
-            case 129:
-            {
-                num5 = 0;
-                gameMenu[scriptEng.operands[0]].entryHighlight[gameMenu[scriptEng.operands[0]].numRows] = (uint8_t)scriptEng.operands[1];
-                TextSystem_AddTextMenuEntry(&gameMenu[scriptEng.operands[0]], gameVersion);
-                break;
-            }
-            case 130:
-            {
-                num5 = 0;
-                EngineCallbacks_OnlineSetAchievement(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            }
-            case 131:
-            {
-                num5 = 0;
-                EngineCallbacks_OnlineSetLeaderboard(scriptEng.operands[0], scriptEng.operands[1]);
-                break;
-            }
-            case 132:
-            {
-                num5 = 0;
-                switch (scriptEng.operands[0])
-                {
-                    case 0:
-                    {
-                        EngineCallbacks_OnlineLoadAchievementsMenu();
-                        break;
-                    }
-                    case 1:
-                    {
-                        EngineCallbacks_OnlineLoadLeaderboardsMenu();
-                        break;
-                    }
-                }
-                break;
-            }
-            case 133:
-            {
-                num5 = 0;
-                EngineCallbacks_RetroEngineCallback(scriptEng.operands[0]);
-                break;
-            }
-            case 134:
-            {
-                num5 = 0;
-                break;
-            }
-        }
-        if (num5 > 0)
-        {
-            scriptCodePtr = scriptCodePtr - num4;
-        }
-        for (i = 0; i < num5; i++)
-        {
-            switch (scriptData[scriptCodePtr])
-            {
-                case 1:
-                {
-                    scriptCodePtr++;
-                    switch (scriptData[scriptCodePtr])
-                    {
-                        case 0:
-                        {
-                            num1 = objectLoop;
-                            break;
-                        }
-                        case 1:
-                        {
-                            scriptCodePtr++;
-                            if (scriptData[scriptCodePtr] != 1)
-                            {
-                                scriptCodePtr++;
-                                num1 = scriptData[scriptCodePtr];
-                                break;
-                            }
-                            else
-                            {
-                                scriptCodePtr++;
-                                num1 = scriptEng.arrayPosition[scriptData[scriptCodePtr]];
-                                break;
-                            }
-                        }
-                        case 2:
-                        {
-                            scriptCodePtr++;
-                            if (scriptData[scriptCodePtr] != 1)
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop + scriptData[scriptCodePtr];
-                                break;
-                            }
-                            else
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop + scriptEng.arrayPosition[scriptData[scriptCodePtr]];
-                                break;
-                            }
-                        }
-                        case 3:
-                        {
-                            scriptCodePtr++;
-                            if (scriptData[scriptCodePtr] != 1)
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop - scriptData[scriptCodePtr];
-                                break;
-                            }
-                            else
-                            {
-                                scriptCodePtr++;
-                                num1 = objectLoop - scriptEng.arrayPosition[scriptData[scriptCodePtr]];
-                                break;
-                            }
-                        }
-                    }
-                    scriptCodePtr++;
-                    switch (scriptData[scriptCodePtr])
-                    {
-                        case 0:
-                        {
-                            scriptEng.tempValue[0] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 1:
-                        {
-                            scriptEng.tempValue[1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 2:
-                        {
-                            scriptEng.tempValue[2] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 3:
-                        {
-                            scriptEng.tempValue[3] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 4:
-                        {
-                            scriptEng.tempValue[4] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 5:
-                        {
-                            scriptEng.tempValue[5] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 6:
-                        {
-                            scriptEng.tempValue[6] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 7:
-                        {
-                            scriptEng.tempValue[7] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 8:
-                        {
-                            scriptEng.checkResult = scriptEng.operands[i];
-                            break;
-                        }
-                        case 9:
-                        {
-                            scriptEng.arrayPosition[0] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 10:
-                        {
-                            scriptEng.arrayPosition[1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 11:
-                        {
-                            globalVariables[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 13:
-                        {
-                            objectEntityList[num1].type = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 14:
-                        {
-                            objectEntityList[num1].propertyValue = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 15:
-                        {
-                            objectEntityList[num1].xPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 16:
-                        {
-                            objectEntityList[num1].yPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 17:
-                        {
-                            objectEntityList[num1].xPos = scriptEng.operands[i] << 16;
-                            break;
-                        }
-                        case 18:
-                        {
-                            objectEntityList[num1].yPos = scriptEng.operands[i] << 16;
-                            break;
-                        }
-                        case 19:
-                        {
-                            objectEntityList[num1].state = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 20:
-                        {
-                            objectEntityList[num1].rotation = scriptEng.operands[i];
-                            break;
-                        }
-                        case 21:
-                        {
-                            objectEntityList[num1].scale = scriptEng.operands[i];
-                            break;
-                        }
-                        case 22:
-                        {
-                            objectEntityList[num1].priority = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 23:
-                        {
-                            objectEntityList[num1].drawOrder = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 24:
-                        {
-                            objectEntityList[num1].direction = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 25:
-                        {
-                            objectEntityList[num1].inkEffect = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 26:
-                        {
-                            objectEntityList[num1].alpha = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 27:
-                        {
-                            objectEntityList[num1].frame = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 28:
-                        {
-                            objectEntityList[num1].animation = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 29:
-                        {
-                            objectEntityList[num1].prevAnimation = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 30:
-                        {
-                            objectEntityList[num1].animationSpeed = scriptEng.operands[i];
-                            break;
-                        }
-                        case 31:
-                        {
-                            objectEntityList[num1].animationTimer = scriptEng.operands[i];
-                            break;
-                        }
-                        case 32:
-                        {
-                            objectEntityList[num1].value[0] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 33:
-                        {
-                            objectEntityList[num1].value[1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 34:
-                        {
-                            objectEntityList[num1].value[2] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 35:
-                        {
-                            objectEntityList[num1].value[3] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 36:
-                        {
-                            objectEntityList[num1].value[4] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 37:
-                        {
-                            objectEntityList[num1].value[5] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 38:
-                        {
-                            objectEntityList[num1].value[6] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 39:
-                        {
-                            objectEntityList[num1].value[7] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 41:
-                        {
-                            playerList[playerNum].objectPtr->state = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 42:
-                        {
-                            playerList[playerNum].controlMode = (signed char)scriptEng.operands[i];
-                            break;
-                        }
-                        case 43:
-                        {
-                            playerList[playerNum].controlLock = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 44:
-                        {
-                            playerList[playerNum].collisionMode = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 45:
-                        {
-                            playerList[playerNum].collisionPlane = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 46:
-                        {
-                            playerList[playerNum].xPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 47:
-                        {
-                            playerList[playerNum].yPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 48:
-                        {
-                            playerList[playerNum].xPos = scriptEng.operands[i] << 16;
-                            break;
-                        }
-                        case 49:
-                        {
-                            playerList[playerNum].yPos = scriptEng.operands[i] << 16;
-                            break;
-                        }
-                        case 50:
-                        {
-                            playerList[playerNum].screenXPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 51:
-                        {
-                            playerList[playerNum].screenYPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 52:
-                        {
-                            playerList[playerNum].speed = scriptEng.operands[i];
-                            break;
-                        }
-                        case 53:
-                        {
-                            playerList[playerNum].xVelocity = scriptEng.operands[i];
-                            break;
-                        }
-                        case 54:
-                        {
-                            playerList[playerNum].yVelocity = scriptEng.operands[i];
-                            break;
-                        }
-                        case 55:
-                        {
-                            playerList[playerNum].gravity = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 56:
-                        {
-                            playerList[playerNum].angle = scriptEng.operands[i];
-                            break;
-                        }
-                        case 57:
-                        {
-                            playerList[playerNum].skidding = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 58:
-                        {
-                            playerList[playerNum].pushing = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 59:
-                        {
-                            playerList[playerNum].trackScroll = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 60:
-                        {
-                            playerList[playerNum].up = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 61:
-                        {
-                            playerList[playerNum].down = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 62:
-                        {
-                            playerList[playerNum].left = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 63:
-                        {
-                            playerList[playerNum].right = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 64:
-                        {
-                            playerList[playerNum].jumpPress = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 65:
-                        {
-                            playerList[playerNum].jumpHold = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 66:
-                        {
-                            playerList[playerNum].followPlayer1 = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 67:
-                        {
-                            playerList[playerNum].lookPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 68:
-                        {
-                            playerList[playerNum].water = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 69:
-                        {
-                            playerList[playerNum].movementStats.topSpeed = scriptEng.operands[i];
-                            break;
-                        }
-                        case 70:
-                        {
-                            playerList[playerNum].movementStats.acceleration = scriptEng.operands[i];
-                            break;
-                        }
-                        case 71:
-                        {
-                            playerList[playerNum].movementStats.deceleration = scriptEng.operands[i];
-                            break;
-                        }
-                        case 72:
-                        {
-                            playerList[playerNum].movementStats.airAcceleration = scriptEng.operands[i];
-                            break;
-                        }
-                        case 73:
-                        {
-                            playerList[playerNum].movementStats.airDeceleration = scriptEng.operands[i];
-                            break;
-                        }
-                        case 74:
-                        {
-                            playerList[playerNum].movementStats.gravity = scriptEng.operands[i];
-                            break;
-                        }
-                        case 75:
-                        {
-                            playerList[playerNum].movementStats.jumpStrength = scriptEng.operands[i];
-                            break;
-                        }
-                        case 76:
-                        {
-                            playerList[playerNum].movementStats.jumpCap = scriptEng.operands[i];
-                            break;
-                        }
-                        case 77:
-                        {
-                            playerList[playerNum].movementStats.rollingAcceleration = scriptEng.operands[i];
-                            break;
-                        }
-                        case 78:
-                        {
-                            playerList[playerNum].movementStats.rollingDeceleration = scriptEng.operands[i];
-                            break;
-                        }
-                        case 84:
-                        {
-                            playerList[playerNum].flailing[num1] = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 85:
-                        {
-                            playerList[playerNum].timer = scriptEng.operands[i];
-                            break;
-                        }
-                        case 86:
-                        {
-                            playerList[playerNum].tileCollisions = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 87:
-                        {
-                            playerList[playerNum].objectInteraction = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 88:
-                        {
-                            playerList[playerNum].visible = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 89:
-                        {
-                            playerList[playerNum].objectPtr->rotation = scriptEng.operands[i];
-                            break;
-                        }
-                        case 90:
-                        {
-                            playerList[playerNum].objectPtr->scale = scriptEng.operands[i];
-                            break;
-                        }
-                        case 91:
-                        {
-                            playerList[playerNum].objectPtr->priority = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 92:
-                        {
-                            playerList[playerNum].objectPtr->drawOrder = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 93:
-                        {
-                            playerList[playerNum].objectPtr->direction = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 94:
-                        {
-                            playerList[playerNum].objectPtr->inkEffect = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 95:
-                        {
-                            playerList[playerNum].objectPtr->alpha = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 96:
-                        {
-                            playerList[playerNum].objectPtr->frame = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 97:
-                        {
-                            playerList[playerNum].objectPtr->animation = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 98:
-                        {
-                            playerList[playerNum].objectPtr->prevAnimation = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 99:
-                        {
-                            playerList[playerNum].objectPtr->animationSpeed = scriptEng.operands[i];
-                            break;
-                        }
-                        case 100:
-                        {
-                            playerList[playerNum].objectPtr->animationTimer = scriptEng.operands[i];
-                            break;
-                        }
-                        case 101:
-                        {
-                            playerList[playerNum].objectPtr->value[0] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 102:
-                        {
-                            playerList[playerNum].objectPtr->value[1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 103:
-                        {
-                            playerList[playerNum].objectPtr->value[2] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 104:
-                        {
-                            playerList[playerNum].objectPtr->value[3] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 105:
-                        {
-                            playerList[playerNum].objectPtr->value[4] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 106:
-                        {
-                            playerList[playerNum].objectPtr->value[5] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 107:
-                        {
-                            playerList[playerNum].objectPtr->value[6] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 108:
-                        {
-                            playerList[playerNum].objectPtr->value[7] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 109:
-                        {
-                            playerList[playerNum].value[0] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 110:
-                        {
-                            playerList[playerNum].value[1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 111:
-                        {
-                            playerList[playerNum].value[2] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 112:
-                        {
-                            playerList[playerNum].value[3] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 113:
-                        {
-                            playerList[playerNum].value[4] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 114:
-                        {
-                            playerList[playerNum].value[5] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 115:
-                        {
-                            playerList[playerNum].value[6] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 116:
-                        {
-                            playerList[playerNum].value[7] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 118:
-                        {
-                            stageMode = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 119:
-                        {
-                            activeStageList = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 120:
-                        {
-                            stageListPosition = scriptEng.operands[i];
-                            break;
-                        }
-                        case 121:
-                        {
-                            timeEnabled = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 122:
-                        {
-                            milliSeconds = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 123:
-                        {
-                            seconds = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 124:
-                        {
-                            minutes = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 125:
-                        {
-                            actNumber = scriptEng.operands[i];
-                            break;
-                        }
-                        case 126:
-                        {
-                            pauseEnabled = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 128:
-                        {
-                            newXBoundary1 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 129:
-                        {
-                            newXBoundary2 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 130:
-                        {
-                            newYBoundary1 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 131:
-                        {
-                            newYBoundary2 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 132:
-                        {
-                            if (xBoundary1 == scriptEng.operands[i])
-                            {
-                                break;
-                            }
-                            xBoundary1 = scriptEng.operands[i];
-                            newXBoundary1 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 133:
-                        {
-                            if (xBoundary2 == scriptEng.operands[i])
-                            {
-                                break;
-                            }
-                            xBoundary2 = scriptEng.operands[i];
-                            newXBoundary2 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 134:
-                        {
-                            if (yBoundary1 == scriptEng.operands[i])
-                            {
-                                break;
-                            }
-                            yBoundary1 = scriptEng.operands[i];
-                            newYBoundary1 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 135:
-                        {
-                            if (yBoundary2 == scriptEng.operands[i])
-                            {
-                                break;
-                            }
-                            yBoundary2 = scriptEng.operands[i];
-                            newYBoundary2 = scriptEng.operands[i];
-                            break;
-                        }
-                        case 136:
-                        {
-                            bgDeformationData0[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 137:
-                        {
-                            bgDeformationData1[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 138:
-                        {
-                            bgDeformationData2[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 139:
-                        {
-                            bgDeformationData3[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 140:
-                        {
-                            waterLevel = scriptEng.operands[i];
-                            break;
-                        }
-                        case 141:
-                        {
-                            activeTileLayers[num1] = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 142:
-                        {
-                            tLayerMidPoint = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 143:
-                        {
-                            playerMenuNum = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 144:
-                        {
-                            playerNum = scriptEng.operands[i];
-                            break;
-                        }
-                        case 145:
-                        {
-                            cameraEnabled = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 146:
-                        {
-                            cameraTarget = (signed char)scriptEng.operands[i];
-                            break;
-                        }
-                        case 147:
-                        {
-                            cameraStyle = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 148:
-                        {
-                            objectDrawOrderList[num1].listSize = scriptEng.operands[i];
-                            break;
-                        }
-                        case 153:
-                        {
-                            xScrollOffset = scriptEng.operands[i];
-                            xScrollA = xScrollOffset;
-                            xScrollB = xScrollOffset + SCREEN_XSIZE;
-                            break;
-                        }
-                        case 154:
-                        {
-                            yScrollOffset = scriptEng.operands[i];
-                            yScrollA = yScrollOffset;
-                            yScrollB = yScrollOffset + 240;
-                            break;
-                        }
-                        case 155:
-                        {
-                            screenShakeX = scriptEng.operands[i];
-                            break;
-                        }
-                        case 156:
-                        {
-                            screenShakeY = scriptEng.operands[i];
-                            break;
-                        }
-                        case 157:
-                        {
-                            cameraAdjustY = scriptEng.operands[i];
-                            break;
-                        }
-                        case 161:
-                        {
-                            AudioPlayback_SetMusicVolume(scriptEng.operands[i]);
-                            break;
-                        }
-                        case 163:
-                        {
-                            gKeyDown.up = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 164:
-                        {
-                            gKeyDown.down = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 165:
-                        {
-                            gKeyDown.left = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 166:
-                        {
-                            gKeyDown.right = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 167:
-                        {
-                            gKeyDown.buttonA = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 168:
-                        {
-                            gKeyDown.buttonB = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 169:
-                        {
-                            gKeyDown.buttonC = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 170:
-                        {
-                            gKeyDown.start = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 171:
-                        {
-                            gKeyPress.up = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 172:
-                        {
-                            gKeyPress.down = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 173:
-                        {
-                            gKeyPress.left = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 174:
+                    }
+                    break;
+                }
+            }
+            break;
+        }
+        case 98:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_MatrixTranslateXYZ(matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_MatrixTranslateXYZ(matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_MatrixTranslateXYZ(matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 99:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_MatrixScaleXYZ(matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_MatrixScaleXYZ(matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_MatrixScaleXYZ(matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 100:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_MatrixRotateX(matWorld, scriptEng.operands[1]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_MatrixRotateX(matView, scriptEng.operands[1]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_MatrixRotateX(matTemp, scriptEng.operands[1]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 101:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_MatrixRotateY(matWorld, scriptEng.operands[1]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_MatrixRotateY(matView, scriptEng.operands[1]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_MatrixRotateY(matTemp, scriptEng.operands[1]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 102:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_MatrixRotateZ(matWorld, scriptEng.operands[1]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_MatrixRotateZ(matView, scriptEng.operands[1]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_MatrixRotateZ(matTemp, scriptEng.operands[1]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 103:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_MatrixRotateXYZ(matWorld, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_MatrixRotateXYZ(matView, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_MatrixRotateXYZ(matTemp, scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 104:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    Scene3D_TransformVertices(matWorld, scriptEng.operands[1], scriptEng.operands[2]);
+                    break;
+                }
+                case 1:
+                {
+                    Scene3D_TransformVertices(matView, scriptEng.operands[1], scriptEng.operands[2]);
+                    break;
+                }
+                case 2:
+                {
+                    Scene3D_TransformVertices(matTemp, scriptEng.operands[1], scriptEng.operands[2]);
+                    break;
+                }
+            }
+            break;
+        }
+        case 107:
+        {
+            num5 = 0;
+            StageSystem_SetLayerDeformation(scriptEng.operands[0], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4], scriptEng.operands[5]);
+            break;
+        }
+        case 108:
+        {
+            num5 = 0;
+            scriptEng.checkResult = -1;
+            while (num5 < gKeyDown.touches)
+            {
+                if (gKeyDown.touchDown[num5] == 1 && gKeyDown.touchX[num5] > scriptEng.operands[0] && gKeyDown.touchX[num5] < scriptEng.operands[2] && gKeyDown.touchY[num5] > scriptEng.operands[1] && gKeyDown.touchY[num5] < scriptEng.operands[3])
+                {
+                    scriptEng.checkResult = num5;
+                }
+                num5 = (signed char)(num5 + 1);
+            }
+            num5 = 0;
+            break;
+        }
+        case 109:
+        {
+            if (scriptEng.operands[2] <= -1 || scriptEng.operands[3] <= -1)
+            {
+                scriptEng.operands[0] = 0;
+                break;
+            }
+            else
+            {
+                scriptEng.operands[0] = stageLayouts[scriptEng.operands[1]].tileMap[scriptEng.operands[2] + (scriptEng.operands[3] << 8)];
+                break;
+            }
+        }
+        case 110:
+        {
+            if (scriptEng.operands[2] <= -1 || scriptEng.operands[3] <= -1)
+            {
+                break;
+            }
+            //Draw scripts run while -paralleldraw builds the layers from these tiles
+            StageSystem_FinishTileLayerJobs();
+            stageLayouts[scriptEng.operands[1]].tileMap[scriptEng.operands[2] + (scriptEng.operands[3] << 8)] = (uint16_t)scriptEng.operands[0];
+            if (scriptEng.operands[1] == 0)
+            {
+                StageSystem_UpdateCollisionMapChunk(scriptEng.operands[2], scriptEng.operands[3]);
+            }
+            break;
+        }
+        case 111:
+        {
+            scriptEng.operands[0] = (scriptEng.operands[1] & 1 << (scriptEng.operands[2] & 31)) >> (scriptEng.operands[2] & 31);
+            break;
+        }
+        case 112:
+        {
+            if (scriptEng.operands[2] <= 0)
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] & ~(1 << (scriptEng.operands[1] & 31));
+                break;
+            }
+            else
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] | 1 << (scriptEng.operands[1] & 31);
+                break;
+            }
+        }
+        case 113:
+        {
+            num5 = 0;
+            AudioPlayback_PauseSound();
+            break;
+        }
+        case 114:
+        {
+            num5 = 0;
+            AudioPlayback_ResumeSound();
+            break;
+        }
+        case 115:
+        {
+            num5 = 0;
+            objectDrawOrderList[scriptEng.operands[0]].listSize = 0;
+            break;
+        }
+        case 116:
+        {
+            num5 = 0;
+            objectDrawOrderList[scriptEng.operands[0]].entityRef[objectDrawOrderList[scriptEng.operands[0]].listSize] = scriptEng.operands[1];
+            struct ObjectDrawList* objectDrawList = &objectDrawOrderList[scriptEng.operands[0]];
+            objectDrawList->listSize = objectDrawList->listSize + 1;
+            break;
+        }
+        case 117:
+        {
+            scriptEng.operands[0] = objectDrawOrderList[scriptEng.operands[1]].entityRef[scriptEng.operands[2]];
+            break;
+        }
+        case 118:
+        {
+            num5 = 0;
+            objectDrawOrderList[scriptEng.operands[1]].entityRef[scriptEng.operands[2]] = scriptEng.operands[0];
+            break;
+        }
+        case 119:
+        {
+            scriptEng.operands[4] = scriptEng.operands[1] >> 7;
+            scriptEng.operands[5] = scriptEng.operands[2] >> 7;
+            if (scriptEng.operands[4] <= -1 || scriptEng.operands[5] <= -1)
+            {
+                scriptEng.operands[6] = 0;
+            }
+            else
+            {
+                scriptEng.operands[6] = stageLayouts[0].tileMap[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
+            }
+            scriptEng.operands[6] = scriptEng.operands[6] + ((scriptEng.operands[1] & 127) >> 4) + ((scriptEng.operands[2] & 127) >> 4 << 3);
+            switch (scriptEng.operands[3])
+            {
+                case 0:
+                {
+                    scriptEng.operands[0] = tile128x128.tile16x16[scriptEng.operands[6]];
+                    break;
+                }
+                case 1:
+                {
+                    scriptEng.operands[0] = tile128x128.direction[scriptEng.operands[6]];
+                    break;
+                }
+                case 2:
+                {
+                    scriptEng.operands[0] = tile128x128.visualPlane[scriptEng.operands[6]];
+                    break;
+                }
+                case 3:
+                {
+                    scriptEng.operands[0] = tile128x128.collisionFlag[0][scriptEng.operands[6]];
+                    break;
+                }
+                case 4:
+                {
+                    scriptEng.operands[0] = tile128x128.collisionFlag[1][scriptEng.operands[6]];
+                    break;
+                }
+                case 5:
+                {
+                    scriptEng.operands[0] = collisionMasks[0].flags[tile128x128.tile16x16[scriptEng.operands[6]]];
+                    break;
+                }
+                case 6:
+                {
+                    scriptEng.operands[0] = (int)collisionMasks[0].angle[tile128x128.tile16x16[scriptEng.operands[6]]];
+                    break;
+                }
+                case 7:
+                {
+                    scriptEng.operands[0] = collisionMasks[1].flags[tile128x128.tile16x16[scriptEng.operands[6]]];
+                    break;
+                }
+                case 8:
+                {
+                    scriptEng.operands[0] = (int)collisionMasks[1].angle[tile128x128.tile16x16[scriptEng.operands[6]]];
+                    break;
+                }
+            }
+            break;
+        }
+        case 120:
+        {
+            num5 = 0;
+            GraphicsSystem_Copy16x16Tile(scriptEng.operands[0], scriptEng.operands[1]);
+            break;
+        }
+        case 121:
+        {
+            StageSystem_FinishTileLayerJobs();
+            scriptEng.operands[4] = scriptEng.operands[1] >> 7;
+            scriptEng.operands[5] = scriptEng.operands[2] >> 7;
+            if (scriptEng.operands[4] <= -1 || scriptEng.operands[5] <= -1)
+            {
+                scriptEng.operands[6] = 0;
+            }
+            else
+            {
+                scriptEng.operands[6] = stageLayouts[0].tileMap[scriptEng.operands[4] + (scriptEng.operands[5] << 8)] << 6;
+            }
+            scriptEng.operands[6] = scriptEng.operands[6] + ((scriptEng.operands[1] & 127) >> 4) + ((scriptEng.operands[2] & 127) >> 4 << 3);
+            switch (scriptEng.operands[3])
+            {
+                case 0:
+                {
+                    tile128x128.tile16x16[scriptEng.operands[6]] = (uint16_t)scriptEng.operands[0];
+                    tile128x128.gfxDataPos[scriptEng.operands[6]] = tile128x128.tile16x16[scriptEng.operands[6]] << 2;
+                    StageSystem_UpdateCollisionMapTile(scriptEng.operands[6]);
+                    break;
+                }
+                case 1:
+                {
+                    tile128x128.direction[scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
+                    StageSystem_UpdateCollisionMapTile(scriptEng.operands[6]);
+                    break;
+                }
+                case 2:
+                {
+                    tile128x128.visualPlane[scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
+                    break;
+                }
+                case 3:
+                {
+                    tile128x128.collisionFlag[0][scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
+                    StageSystem_UpdateCollisionMapTile(scriptEng.operands[6]);
+                    break;
+                }
+                case 4:
+                {
+                    tile128x128.collisionFlag[1][scriptEng.operands[6]] = (uint8_t)scriptEng.operands[0];
+                    StageSystem_UpdateCollisionMapTile(scriptEng.operands[6]);
+                    break;
+                }
+                case 5:
+                {
+                    collisionMasks[0].flags[tile128x128.tile16x16[scriptEng.operands[6]]] = (uint8_t)scriptEng.operands[0];
+                    break;
+                }
+                case 6:
+                {
+                    collisionMasks[0].angle[tile128x128.tile16x16[scriptEng.operands[6]]] = (uint8_t)scriptEng.operands[0];
+                    StageSystem_BakeCollisionMasks(tile128x128.tile16x16[scriptEng.operands[6]] & 0x3FF);
+                    break;
+                }
+            }
+            break;
+        }
+        case 122:
+        {
+            scriptEng.operands[0] = -1;
+            scriptEng.sRegister = 0;
+            while (scriptEng.operands[0] == -1)
+            {
+                if (!FileIO_StringComp(scriptText, animationList[playerList[playerNum].animationFile->aniListOffset + scriptEng.sRegister].name))
+                {
+                    scriptEng.sRegister = scriptEng.sRegister + 1;
+                    if (scriptEng.sRegister != playerList[playerNum].animationFile->numAnimations)
+                    {
+                        continue;
+                    }
+                    scriptEng.operands[0] = 0;
+                }
+                else
+                {
+                    scriptEng.operands[0] = scriptEng.sRegister;
+                }
+            }
+            break;
+        }
+        case 123:
+        {
+            num5 = 0;
+            scriptEng.checkResult = FileIO_ReadSaveRAMData();
+            break;
+        }
+        case 124:
+        {
+            num5 = 0;
+            scriptEng.checkResult = FileIO_WriteSaveRAMData();
+            break;
+        }
+        case 125:
+        {
+            num5 = 0;
+            TextSystem_LoadFontFile(scriptText);
+            break;
+        }
+        case 126:
+        {
+            num5 = 0;
+            if (scriptEng.operands[2] != 0)
+            {
+                TextSystem_LoadTextFile(&gameMenu[scriptEng.operands[0]], scriptText, 1);
+                break;
+            }
+            else
+            {
+                TextSystem_LoadTextFile(&gameMenu[scriptEng.operands[0]], scriptText, 0);
+                break;
+            }
+        }
+        case 127:
+        {
+            num5 = 0;
+            textMenuSurfaceNo = objectScriptList[objectEntityType[objectLoop]].surfaceNum;
+            TextSystem_DrawBitmapText(&gameMenu[scriptEng.operands[0]], scriptEng.operands[1], scriptEng.operands[2], scriptEng.operands[3], scriptEng.operands[4], scriptEng.operands[5], scriptEng.operands[6]);
+            break;
+        }
+        case 128:
+        {
+            switch (scriptEng.operands[2])
+            {
+                case 0:
+                {
+                    scriptEng.operands[0] = gameMenu[scriptEng.operands[1]].textData[gameMenu[scriptEng.operands[1]].entryStart[scriptEng.operands[3]] + scriptEng.operands[4]];
+                    break;
+                }
+                case 1:
+                {
+                    scriptEng.operands[0] = gameMenu[scriptEng.operands[1]].entrySize[scriptEng.operands[3]];
+                    break;
+                }
+                case 2:
+                {
+                    scriptEng.operands[0] = gameMenu[scriptEng.operands[1]].numRows;
+                    break;
+                }
+            }
+            break;
+        }
+        case 129:
+        {
+            num5 = 0;
+            gameMenu[scriptEng.operands[0]].entryHighlight[gameMenu[scriptEng.operands[0]].numRows] = (uint8_t)scriptEng.operands[1];
+            TextSystem_AddTextMenuEntry(&gameMenu[scriptEng.operands[0]], gameVersion);
+            break;
+        }
+        case 130:
+        {
+            num5 = 0;
+            EngineCallbacks_OnlineSetAchievement(scriptEng.operands[0], scriptEng.operands[1]);
+            break;
+        }
+        case 131:
+        {
+            num5 = 0;
+            EngineCallbacks_OnlineSetLeaderboard(scriptEng.operands[0], scriptEng.operands[1]);
+            break;
+        }
+        case 132:
+        {
+            num5 = 0;
+            switch (scriptEng.operands[0])
+            {
+                case 0:
+                {
+                    EngineCallbacks_OnlineLoadAchievementsMenu();
+                    break;
+                }
+                case 1:
+                {
+                    EngineCallbacks_OnlineLoadLeaderboardsMenu();
+                    break;
+                }
+            }
+            break;
+        }
+        case 133:
+        {
+            num5 = 0;
+            EngineCallbacks_RetroEngineCallback(scriptEng.operands[0]);
+            break;
+        }
+        case 134:
+        {
+            num5 = 0;
+            break;
+        }
+    }
+    return num5;
+}
+
+CompiledScript ObjectSystem_FindCompiledScript(int scriptCodePtr, int jumpTablePtr)
+{
+    int i;
+    if (compiledScriptModule == NULL)
+    {
+        return NULL;
+    }
+    i = (int)(((uint32_t)scriptCodePtr * 0x9e3779b1u) >> 20);
+    while (compiledScriptTable[i] != NULL)
+    {
+        if (compiledScriptTable[i]->scriptCodePtr == scriptCodePtr && compiledScriptTable[i]->jumpTablePtr == jumpTablePtr)
+        {
+            return compiledScriptTable[i]->function;
+        }
+        i = (i + 1) & (COMPILED_SCRIPT_TABLE_SIZE - 1);
+    }
+    return NULL;
+}
+
+int ObjectSystem_FindFreeTempObject(int slot)
+{
+    //Walks the free map a word at a time from slot, wrapping once. Bits that turn out to be stale are dropped.
+    const uint8_t bitIndex[32] = { 0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9 };
+    int numWords = (tempObjectPoolSize + 31) >> 5;
+    int word = slot >> 5;
+    uint32_t bits = tempObjectFreeMap[word] & (0xFFFFFFFFu << (slot & 31));
+    for (int i = 0; i <= numWords; i++)
+    {
+        while (bits != 0)
+        {
+            int num = (word << 5) + bitIndex[((bits & (0u - bits)) * 0x077CB531u) >> 27];
+            bits &= bits - 1;
+            if (objectEntityType[TEMP_OBJECT_START + num] == 0)
+            {
+                return num;
+            }
+            tempObjectFreeMap[word] &= ~(1u << (num & 31));
+            tempObjectFreeCount--;
+        }
+        word = word + 1 == numWords ? 0 : word + 1;
+        bits = tempObjectFreeMap[word];
+    }
+    return -1;
+}
+
+void ObjectSystem_FuseScript(int scriptCodePtr)
+{
+    //Walk to the end sub/function first, so nothing is patched in a script that doesn't decode cleanly
+    int num = scriptCodePtr;
+    int depth = 0;
+    int opcode;
+    while (true)
+    {
+        opcode = ObjectSystem_GetOpcode(num);
+        num = ObjectSystem_SkipInstruction(num);
+        if (num < 0)
+        {
+            return;
+        }
+        if ((opcode >= 19 && opcode <= 24) || (opcode >= 27 && opcode <= 32) || opcode == 34)
+        {
+            depth++;
+        }
+        else if (opcode == 26 || opcode == 33 || opcode == 36)
+        {
+            depth--;
+        }
+        else if ((opcode == 0 || opcode == 106) && depth <= 0)
+        {
+            break;
+        }
+    }
+    int scriptEnd = num;
+    for (num = scriptCodePtr; num < scriptEnd; num = ObjectSystem_SkipInstruction(num))
+    {
+        if (scriptData[num] >= SUPERINSTRUCTION_OPCODE || numSuperInstructionSites == SUPERINSTRUCTION_SITES)
+        {
+            continue;
+        }
+        for (int i = 0; i < numSuperInstructions; i++)
+        {
+            if (ObjectSystem_MatchSuperInstruction(i, num, scriptEnd))
+            {
+                superInstructionSites[numSuperInstructionSites] = num;
+                superInstructionSiteOpcodes[numSuperInstructionSites] = (uint8_t)scriptData[num];
+                numSuperInstructionSites++;
+                scriptData[num] = SUPERINSTRUCTION_OPCODE + i;
+                break;
+            }
+        }
+    }
+}
+
+void ObjectSystem_FuseSuperInstructions()
+{
+    //Put back what the last pass patched first, the table may have changed since
+    int i;
+    for (i = 0; i < numSuperInstructionSites; i++)
+    {
+        scriptData[superInstructionSites[i]] = superInstructionSiteOpcodes[i];
+    }
+    numSuperInstructionSites = 0;
+    if (numSuperInstructions == 0)
+    {
+        return;
+    }
+    for (i = 0; i < 0x100; i++)
+    {
+        if (scriptData[objectScriptList[i].mainScript] > 0)
+        {
+            ObjectSystem_FuseScript(objectScriptList[i].mainScript);
+        }
+        if (scriptData[objectScriptList[i].playerScript] > 0)
+        {
+            ObjectSystem_FuseScript(objectScriptList[i].playerScript);
+        }
+        if (scriptData[objectScriptList[i].drawScript] > 0)
+        {
+            ObjectSystem_FuseScript(objectScriptList[i].drawScript);
+        }
+        if (scriptData[objectScriptList[i].startupScript] > 0)
+        {
+            ObjectSystem_FuseScript(objectScriptList[i].startupScript);
+        }
+    }
+    for (i = 0; i < 0x200; i++)
+    {
+        if (scriptData[functionScriptList[i].mainScript] > 0)
+        {
+            ObjectSystem_FuseScript(functionScriptList[i].mainScript);
+        }
+    }
+}
+
+int ObjectSystem_GetOpcode(int scriptCodePtr)
+{
+    int opcode = scriptData[scriptCodePtr];
+    if (opcode >= SUPERINSTRUCTION_OPCODE && opcode < SUPERINSTRUCTION_OPCODE + numSuperInstructions)
+    {
+        return superInstructions[opcode - SUPERINSTRUCTION_OPCODE].opcodes[0];
+    }
+    return opcode;
+}
+
+void ObjectSystem_InferInteractionBounds(int scriptNum)
+{
+    //A player script that starts with a constant PlayerObjectCollision check and skips to the end when
+    //it misses does nothing for a player outside that box, so the broadphase may skip running it.
+    struct ObjectScript* objectScript = &objectScriptList[scriptNum];
+    int scriptCodePtr = objectScript->playerScript;
+    objectScript->interactionBounds = 0;
+    if (scriptCodePtr < 0 || scriptCodePtr + 19 >= SCRIPT_DATA_SIZE || scriptData[scriptCodePtr] != 74)
+    {
+        return;
+    }
+    for (int i = 0; i < 5; i++)
+    {
+        if (scriptData[scriptCodePtr + 1 + (i << 1)] != 2)
+        {
+            return;
+        }
+    }
+    int cType = scriptData[scriptCodePtr + 2];
+    int num = scriptCodePtr + 11;
+    if (cType < 0 || cType > 3 || scriptData[num] != 19 || scriptData[num + 1] != 2)
+    {
+        return;
+    }
+    //IfEqual(CheckResult, true) or IfEqual(true, CheckResult)
+    if (!(scriptData[num + 3] == 1 && scriptData[num + 4] == 0 && scriptData[num + 5] == 8 && scriptData[num + 6] == 2 && scriptData[num + 7] != 0)
+        && !(scriptData[num + 3] == 2 && scriptData[num + 4] != 0 && scriptData[num + 5] == 1 && scriptData[num + 6] == 0 && scriptData[num + 7] == 8))
+    {
+        return;
+    }
+    int jumpPos = objectScript->playerJumpTable + scriptData[num + 2];
+    if (jumpPos < 0 || jumpPos >= JUMP_TABLE_SIZE)
+    {
+        return;
+    }
+    num = scriptCodePtr + jumpTableData[jumpPos];
+    if (num < 0 || num + 1 >= SCRIPT_DATA_SIZE)
+    {
+        return;
+    }
+    if (scriptData[num] == 0 || (scriptData[num] == 26 && scriptData[num + 1] == 0))
+    {
+        ObjectSystem_SetInteractionBounds(scriptNum, cType, scriptData[scriptCodePtr + 4], scriptData[scriptCodePtr + 6], scriptData[scriptCodePtr + 8], scriptData[scriptCodePtr + 10]);
+    }
+}
+
+void ObjectSystem_LoadByteCodeFile(int fileType, int scriptNum)
+{
+    int num;
+    int num1;
+    int i;
+    uint8_t num2;
+    struct FileData fileDatum;
+    char charArray[] = "Data/Scripts/ByteCode/";
+    char chrArray[] = ".bin";
+    FileIO_StrCopy(scriptText, sizeof(scriptText), charArray, sizeof(charArray));
+    switch (fileType)
+    {
+        case PRESENTATION_STAGE:
+        {
+            if(useOldSdkLayout){
+                sprintf(scriptText,"%sPS%03d.bin",scriptText,stageListPosition);
+            }
+            else{
+                FileIO_StrAdd(scriptText, sizeof(scriptText), pStageList[stageListPosition].stageFolderName, sizeof(pStageList[stageListPosition].stageFolderName));
+                FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            }
+            break;
+        }
+        case ZONE_STAGE:
+        {
+            if(useOldSdkLayout){
+                sprintf(scriptText,"%sRS%03d.bin",scriptText,stageListPosition);
+            }
+            else{
+                FileIO_StrAdd(scriptText, sizeof(scriptText), zStageList[stageListPosition].stageFolderName, sizeof(zStageList[stageListPosition].stageFolderName));
+                FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            }
+            break;
+        }
+        case BONUS_STAGE:
+        {
+            FileIO_StrAdd(scriptText, sizeof(scriptText), bStageList[stageListPosition].stageFolderName, sizeof(bStageList[stageListPosition].stageFolderName));
+            FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            break;
+        }
+        case SPECIAL_STAGE:
+        {
+            if(useOldSdkLayout){
+                sprintf(scriptText,"%sSS%03d.bin",scriptText,stageListPosition);
+            }
+            else{
+                FileIO_StrAdd(scriptText, sizeof(scriptText), sStageList[stageListPosition].stageFolderName, sizeof(sStageList[stageListPosition].stageFolderName));
+                FileIO_StrAdd(scriptText, sizeof(scriptText), chrArray, sizeof(chrArray));
+            }
+            break;
+        }
+        case 4:
+        {
+            if(useOldSdkLayout){
+                sprintf(scriptText,"%sGS000.bin", scriptText);
+            }
+            else{
+                sprintf(scriptText,"%sGlobalCode.bin", scriptText);
+            }
+            break;
+        }
+    }
+    if (FileIO_LoadFile(scriptText, &fileDatum))
+    {
+        int num3 = scriptDataPos;
+        uint8_t num4 = FileIO_ReadByte();
+        int num5 = num4;
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 8);
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 16);
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 24);
+        while (num5 > 0)
+        {
+            num4 = FileIO_ReadByte();
+            num2 = (uint8_t)(num4 & 127);
+            if (num4 >= 128)
+            {
+                while (num2 > 0)
+                {
+                    num4 = FileIO_ReadByte();
+                    num = num4;
+                    num4 = FileIO_ReadByte();
+                    num = num + (num4 << 8);
+                    num4 = FileIO_ReadByte();
+                    num = num + (num4 << 16);
+                    num4 = FileIO_ReadByte();
+                    num = num + (num4 << 24);
+                    scriptData[num3] = num;
+                    num3++;
+                    scriptDataPos = scriptDataPos + 1;
+                    num5--;
+                    num2 = (uint8_t)(num2 - 1);
+                }
+            }
+            else
+            {
+                while (num2 > 0)
+                {
+                    num4 = FileIO_ReadByte();
+                    scriptData[num3] = num4;
+                    num3++;
+                    scriptDataPos = scriptDataPos + 1;
+                    num5--;
+                    num2 = (uint8_t)(num2 - 1);
+                }
+            }
+        }
+        num3 = jumpTableDataPos;
+        num4 = FileIO_ReadByte();
+        num5 = num4;
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 8);
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 16);
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 24);
+        while (num5 > 0)
+        {
+            num4 = FileIO_ReadByte();
+            num2 = (uint8_t)(num4 & 127);
+            if (num4 >= 128)
+            {
+                while (num2 > 0)
+                {
+                    num4 = FileIO_ReadByte();
+                    num = num4;
+                    num4 = FileIO_ReadByte();
+                    num = num + (num4 << 8);
+                    num4 = FileIO_ReadByte();
+                    num = num + (num4 << 16);
+                    num4 = FileIO_ReadByte();
+                    num = num + (num4 << 24);
+                    jumpTableData[num3] = num;
+                    num3++;
+                    jumpTableDataPos = jumpTableDataPos + 1;
+                    num5--;
+                    num2 = (uint8_t)(num2 - 1);
+                }
+            }
+            else
+            {
+                while (num2 > 0)
+                {
+                    num4 = FileIO_ReadByte();
+                    jumpTableData[num3] = num4;
+                    num3++;
+                    jumpTableDataPos = jumpTableDataPos + 1;
+                    num5--;
+                    num2 = (uint8_t)(num2 - 1);
+                }
+            }
+        }
+        num4 = FileIO_ReadByte();
+        num5 = num4;
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 8);
+        num = scriptNum;
+        for (i = num5; i > 0; i--)
+        {
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].mainScript = num1;
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].playerScript = num1;
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].drawScript = num1;
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].startupScript = num1;
+            num++;
+        }
+        num = scriptNum;
+        for (i = num5; i > 0; i--)
+        {
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].mainJumpTable = num1;
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].playerJumpTable = num1;
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].drawJumpTable = num1;
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            objectScriptList[num].startupJumpTable = num1;
+            ObjectSystem_InferInteractionBounds(num);
+            num++;
+        }
+        num4 = FileIO_ReadByte();
+        num5 = num4;
+        num4 = FileIO_ReadByte();
+        num5 = num5 + (num4 << 8);
+        num = 0;
+        for (i = num5; i > 0; i--)
+        {
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            functionScriptList[num].mainScript = num1;
+            num++;
+        }
+        num = 0;
+        for (i = num5; i > 0; i--)
+        {
+            num4 = FileIO_ReadByte();
+            num1 = num4;
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 8);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 16);
+            num4 = FileIO_ReadByte();
+            num1 = num1 + (num4 << 24);
+            functionScriptList[num].mainJumpTable = num1;
+            num++;
+        }
+        FileIO_CloseFile();
+    }
+}
+
+bool ObjectSystem_LoadSuperInstructions(const char* filePath)
+{
+    //Reads the fuse lines of a report written by ObjectSystem_WriteScriptProfile
+    char line[256];
+    int opcodes[SUPERINSTRUCTION_LENGTH + 1];
+    struct ScriptSuperInstruction* superInstruction;
+    FILE* file = fopen(filePath, "r");
+    if (file == NULL)
+    {
+        return false;
+    }
+    numSuperInstructions = 0;
+    while (fgets(line, sizeof(line), file) != NULL && numSuperInstructions < SUPERINSTRUCTION_COUNT)
+    {
+        int length = sscanf(line, "fuse %d %d %d %d", &opcodes[0], &opcodes[1], &opcodes[2], &opcodes[3]);
+        if (length < 2 || length > SUPERINSTRUCTION_LENGTH)
+        {
+            continue;
+        }
+        superInstruction = &superInstructions[numSuperInstructions];
+        superInstruction->length = (uint8_t)length;
+        for (int i = 0; i < length; i++)
+        {
+            superInstruction->opcodes[i] = (uint8_t)(opcodes[i] >= 0 && opcodes[i] < (int)sizeof(scriptOpcodeSizes) ? opcodes[i] : 0);
+        }
+        if (ObjectSystem_SuperInstructionAllowed(superInstruction->opcodes, length))
+        {
+            numSuperInstructions++;
+        }
+    }
+    fclose(file);
+    ObjectSystem_FuseSuperInstructions();
+    return true;
+}
+
+void ObjectSystem_MarkTempObject(int objectNum)
+{
+    int num = objectNum - TEMP_OBJECT_START;
+    uint32_t bit;
+    if (num < 0 || num >= tempObjectPoolSize)
+    {
+        return;
+    }
+    bit = 1u << (num & 31);
+    if (objectEntityType[objectNum] == 0)
+    {
+        if ((tempObjectFreeMap[num >> 5] & bit) == 0)
+        {
+            tempObjectFreeMap[num >> 5] |= bit;
+            tempObjectFreeCount++;
+        }
+    }
+    else if ((tempObjectFreeMap[num >> 5] & bit) != 0)
+    {
+        tempObjectFreeMap[num >> 5] &= ~bit;
+        tempObjectFreeCount--;
+    }
+}
+
+bool ObjectSystem_MatchSuperInstruction(int superNum, int scriptCodePtr, int scriptEnd)
+{
+    //Every operand has to be a constant or a variable of the running object, which is all the
+    //superinstruction handler knows how to read
+    struct ScriptSuperInstruction* superInstruction = &superInstructions[superNum];
+    for (int i = 0; i < superInstruction->length; i++)
+    {
+        int opcode = superInstruction->opcodes[i];
+        bool branch = (opcode >= 19 && opcode <= 24) || (opcode >= 27 && opcode <= 32);
+        if (scriptCodePtr >= scriptEnd || ObjectSystem_GetOpcode(scriptCodePtr) != opcode)
+        {
+            return false;
+        }
+        scriptCodePtr++;
+        for (int j = 0; j < scriptOpcodeSizes[opcode]; j++)
+        {
+            if (scriptData[scriptCodePtr] == 2)
+            {
+                scriptCodePtr = scriptCodePtr + 2;
+            }
+            else if (scriptData[scriptCodePtr] == 1 && scriptData[scriptCodePtr + 1] == 0 && (j > 0 || !branch))
+            {
+                scriptCodePtr = scriptCodePtr + 3;
+            }
+            else
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void ObjectSystem_ObjectFloorCollision(int xOffset, int yOffset, int cPlane)
+{
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
+    {
+        int num5 = num2 >> 7;
+        int num6 = (num2 & 127) >> 4;
+        struct CollisionProbe probe;
+        probe.xPos = num1;
+        probe.yPos = num2;
+        StageSystem_ProbeCollision(&probe, 1, cPlane, COLLISION_FLOOR);
+        if (probe.cFlag != 2 && probe.cFlag != 3)
+        {
+            if ((num2 & 15) > probe.mask)
+            {
+                num2 = probe.mask + (num5 << 7) + (num6 << 4);
+                scriptEng.checkResult = 1;
+            }
+        }
+        if (scriptEng.checkResult == 1)
+        {
+            objectEntityYPos[objectLoop] = (num2 - yOffset) << 16;
+        }
+    }
+}
+
+void ObjectSystem_ObjectFloorGrip(int xOffset, int yOffset, int cPlane)
+{
+    struct CollisionProbe probes[3];
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    int num3 = num2;
+    num2 = num2 - 16;
+    for (int i = 0; i < 3; i++)
+    {
+        probes[i].xPos = num1;
+        probes[i].yPos = num2 + (i << 4);
+    }
+    StageSystem_ProbeCollision(probes, 3, cPlane, COLLISION_FLOOR);
+    for (int i = 0; i < 3; i++)
+    {
+        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        {
+            int num6 = num2 >> 7;
+            int num7 = (num2 & 127) >> 4;
+            if (probes[i].cFlag != 2 && probes[i].cFlag != 3)
+            {
+                if (probes[i].mask < 64)
+                {
+                    objectEntityYPos[objectLoop] = probes[i].mask + (num6 << 7) + (num7 << 4);
+                    scriptEng.checkResult = 1;
+                }
+            }
+        }
+        num2 = num2 + 16;
+    }
+    if (scriptEng.checkResult == 1)
+    {
+        if (abs(objectEntityYPos[objectLoop] - num3) < 16)
+        {
+            objectEntityYPos[objectLoop] = (objectEntityYPos[objectLoop] - yOffset) << 16;
+            return;
+        }
+        objectEntityYPos[objectLoop] = (num3 - yOffset) << 16;
+        scriptEng.checkResult = 0;
+    }
+}
+
+void ObjectSystem_ObjectLWallCollision(int xOffset, int yOffset, int cPlane)
+{
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
+    {
+        int num3 = num1 >> 7;
+        int num4 = (num1 & 127) >> 4;
+        struct CollisionProbe probe;
+        probe.xPos = num1;
+        probe.yPos = num2;
+        StageSystem_ProbeCollision(&probe, 1, cPlane, COLLISION_LWALL);
+        if (probe.cFlag != 1 && probe.cFlag < 3)
+        {
+            if ((num1 & 15) > probe.mask)
+            {
+                num1 = probe.mask + (num3 << 7) + (num4 << 4);
+                scriptEng.checkResult = 1;
+            }
+        }
+        if (scriptEng.checkResult == 1)
+        {
+            objectEntityXPos[objectLoop] = (num1 - xOffset) << 16;
+        }
+    }
+}
+
+void ObjectSystem_ObjectLWallGrip(int xOffset, int yOffset, int cPlane)
+{
+    struct CollisionProbe probes[3];
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    int num3 = num1;
+    num1 = num1 - 16;
+    for (int i = 0; i < 3; i++)
+    {
+        probes[i].xPos = num1 + (i << 4);
+        probes[i].yPos = num2;
+    }
+    StageSystem_ProbeCollision(probes, 3, cPlane, COLLISION_LWALL);
+    for (int i = 0; i < 3; i++)
+    {
+        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        {
+            int num4 = num1 >> 7;
+            int num5 = (num1 & 127) >> 4;
+            if (probes[i].cFlag < 3)
+            {
+                if (probes[i].mask < 64)
+                {
+                    objectEntityXPos[objectLoop] = probes[i].mask + (num4 << 7) + (num5 << 4);
+                    scriptEng.checkResult = 1;
+                }
+            }
+        }
+        num1 = num1 + 16;
+    }
+    if (scriptEng.checkResult == 1)
+    {
+        if (abs(objectEntityXPos[objectLoop] - num3) < 16)
+        {
+            objectEntityXPos[objectLoop] = (objectEntityXPos[objectLoop] - xOffset) << 16;
+            return;
+        }
+        objectEntityXPos[objectLoop] = (num3 - xOffset) << 16;
+        scriptEng.checkResult = 0;
+    }
+}
+
+void ObjectSystem_ObjectRoofCollision(int xOffset, int yOffset, int cPlane)
+{
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
+    {
+        int num5 = num2 >> 7;
+        int num6 = (num2 & 127) >> 4;
+        struct CollisionProbe probe;
+        probe.xPos = num1;
+        probe.yPos = num2;
+        StageSystem_ProbeCollision(&probe, 1, cPlane, COLLISION_ROOF);
+        if (probe.cFlag != 1 && probe.cFlag < 3)
+        {
+            if ((num2 & 15) < probe.mask)
+            {
+                num2 = probe.mask + (num5 << 7) + (num6 << 4);
+                scriptEng.checkResult = 1;
+            }
+        }
+        if (scriptEng.checkResult == 1)
+        {
+            objectEntityYPos[objectLoop] = (num2 - yOffset) << 16;
+        }
+    }
+}
+
+void ObjectSystem_ObjectRoofGrip(int xOffset, int yOffset, int cPlane)
+{
+    struct CollisionProbe probes[3];
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    int num3 = num2;
+    num2 = num2 + 16;
+    for (int i = 0; i < 3; i++)
+    {
+        probes[i].xPos = num1;
+        probes[i].yPos = num2 - (i << 4);
+    }
+    StageSystem_ProbeCollision(probes, 3, cPlane, COLLISION_ROOF);
+    for (int i = 0; i < 3; i++)
+    {
+        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        {
+            int num6 = num2 >> 7;
+            int num7 = (num2 & 127) >> 4;
+            if (probes[i].cFlag < 3)
+            {
+                if (probes[i].mask > -64)
+                {
+                    objectEntityYPos[objectLoop] = probes[i].mask + (num6 << 7) + (num7 << 4);
+                    scriptEng.checkResult = 1;
+                }
+            }
+        }
+        num2 = num2 - 16;
+    }
+    if (scriptEng.checkResult == 1)
+    {
+        if (abs(objectEntityYPos[objectLoop] - num3) < 16)
+        {
+            objectEntityYPos[objectLoop] = (objectEntityYPos[objectLoop] - yOffset) << 16;
+            return;
+        }
+        objectEntityYPos[objectLoop] = (num3 - yOffset) << 16;
+        scriptEng.checkResult = 0;
+    }
+}
+
+void ObjectSystem_ObjectRWallCollision(int xOffset, int yOffset, int cPlane)
+{
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7)
+    {
+        int num3 = num1 >> 7;
+        int num4 = (num1 & 127) >> 4;
+        struct CollisionProbe probe;
+        probe.xPos = num1;
+        probe.yPos = num2;
+        StageSystem_ProbeCollision(&probe, 1, cPlane, COLLISION_RWALL);
+        if (probe.cFlag != 1 && probe.cFlag < 3)
+        {
+            if ((num1 & 15) < probe.mask)
+            {
+                num1 = probe.mask + (num3 << 7) + (num4 << 4);
+                scriptEng.checkResult = 1;
+            }
+        }
+        if (scriptEng.checkResult == 1)
+        {
+            objectEntityXPos[objectLoop] = (num1 - xOffset) << 16;
+        }
+    }
+}
+
+void ObjectSystem_ObjectRWallGrip(int xOffset, int yOffset, int cPlane)
+{
+    struct CollisionProbe probes[3];
+    scriptEng.checkResult = 0;
+    int num1 = (objectEntityXPos[objectLoop] >> 16) + xOffset;
+    int num2 = (objectEntityYPos[objectLoop] >> 16) + yOffset;
+    int num3 = num1;
+    num1 = num1 + 16;
+    for (int i = 0; i < 3; i++)
+    {
+        probes[i].xPos = num1 - (i << 4);
+        probes[i].yPos = num2;
+    }
+    StageSystem_ProbeCollision(probes, 3, cPlane, COLLISION_RWALL);
+    for (int i = 0; i < 3; i++)
+    {
+        if (num1 > 0 && num1 < stageLayouts[0].xSize << 7 && num2 > 0 && num2 < stageLayouts[0].ySize << 7 && scriptEng.checkResult == 0)
+        {
+            int num4 = num1 >> 7;
+            int num5 = (num1 & 127) >> 4;
+            if (probes[i].cFlag < 3)
+            {
+                if (probes[i].mask > -64)
+                {
+                    objectEntityXPos[objectLoop] = probes[i].mask + (num4 << 7) + (num5 << 4);
+                    scriptEng.checkResult = 1;
+                }
+            }
+        }
+        num1 = num1 - 16;
+    }
+    if (scriptEng.checkResult == 1)
+    {
+        if (abs(objectEntityXPos[objectLoop] - num3) < 16)
+        {
+            objectEntityXPos[objectLoop] = (objectEntityXPos[objectLoop] - xOffset) << 16;
+            return;
+        }
+        objectEntityXPos[objectLoop] = (num3 - xOffset) << 16;
+        scriptEng.checkResult = 0;
+    }
+}
+
+void ObjectSystem_PlatformCollision(int cLeft, int cTop, int cRight, int cBottom)
+{
+    struct PlayerObject* playerObject = &playerList[playerNum];
+    struct CollisionBox* collisionBox = PlayerSystem_GetCollisionBox(playerObject);
+    collisionLeft = collisionBox->left[0];
+    collisionTop = collisionBox->top[0];
+    collisionRight = collisionBox->right[0];
+    collisionBottom = collisionBox->bottom[0];
+    object_cSensor[0].collided = 0;
+    object_cSensor[1].collided = 0;
+    object_cSensor[2].collided = 0;
+    object_cSensor[0].xPos = playerObject->xPos + ((collisionLeft + 1) << 16);
+    object_cSensor[1].xPos = playerObject->xPos;
+    object_cSensor[2].xPos = playerObject->xPos + (collisionRight << 16);
+    object_cSensor[0].yPos = playerObject->yPos + (collisionBottom << 16);
+    object_cSensor[1].yPos = object_cSensor[0].yPos;
+    object_cSensor[2].yPos = object_cSensor[0].yPos;
+    scriptEng.checkResult = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        if (object_cSensor[i].xPos > cLeft && object_cSensor[i].xPos < cRight && object_cSensor[i].yPos > cTop - 2 && object_cSensor[i].yPos < cBottom && playerObject->yVelocity >= 0)
+        {
+            object_cSensor[i].collided = 1;
+            playerObject->flailing[i] = 1;
+        }
+    }
+    if (object_cSensor[0].collided == 1 || object_cSensor[1].collided == 1 || object_cSensor[2].collided == 1)
+    {
+        if (playerObject->gravity == 0 && (playerObject->collisionMode == 1 || playerObject->collisionMode == 3))
+        {
+            playerObject->xVelocity = 0;
+            playerObject->speed = 0;
+        }
+        playerObject->yPos = cTop - (collisionBottom << 16);
+        playerObject->gravity = 0;
+        playerObject->yVelocity = 0;
+        playerObject->angle = 0;
+        playerObject->objectPtr->rotation = 0;
+        playerObject->controlLock = 0;
+        scriptEng.checkResult = 1;
+    }
+}
+
+bool ObjectSystem_PlayerInInteractionBounds(struct ObjectScript* objectScript, struct PlayerObject* playerO)
+{
+    if (objectScript->interactionBounds == 0)
+    {
+        return true;
+    }
+    struct CollisionBox* collisionBox = PlayerSystem_GetCollisionBox(playerO);
+    int xPos = objectEntityXPos[objectLoop] >> 16;
+    int yPos = objectEntityYPos[objectLoop] >> 16;
+    int cLeft = xPos + objectScript->interactionLeft;
+    int cTop = yPos + objectScript->interactionTop;
+    int cRight = xPos + objectScript->interactionRight;
+    int cBottom = yPos + objectScript->interactionBottom;
+    int pLeft = (playerO->xPos >> 16) + collisionBox->left[0];
+    int pTop = (playerO->yPos >> 16) + collisionBox->top[0];
+    int pRight = (playerO->xPos >> 16) + collisionBox->right[0];
+    int pBottom = (playerO->yPos >> 16) + collisionBox->bottom[0];
+    if (objectScript->interactionType == 0)
+    {
+        //Same test as ObjectSystem_BasicCollision
+        return pRight > cLeft && pLeft < cRight && pBottom > cTop && pTop < cBottom;
+    }
+    //Box and platform checks look at sensors a few pixels around the hitbox and where the player was last frame
+    int num = (abs(playerO->xVelocity) >> 16) + 4;
+    int num1 = (abs(playerO->yVelocity) >> 16) + 4;
+    pLeft = (pLeft < (playerO->xPos >> 16) ? pLeft : (playerO->xPos >> 16)) - num;
+    pRight = (pRight > (playerO->xPos >> 16) ? pRight : (playerO->xPos >> 16)) + num;
+    pTop = (pTop < (playerO->yPos >> 16) - 2 ? pTop : (playerO->yPos >> 16) - 2) - num1;
+    pBottom = (pBottom > (playerO->yPos >> 16) + 8 ? pBottom : (playerO->yPos >> 16) + 8) + num1;
+    if (cLeft > cRight)
+    {
+        num = cLeft;
+        cLeft = cRight;
+        cRight = num;
+    }
+    if (cTop > cBottom)
+    {
+        num = cTop;
+        cTop = cBottom;
+        cBottom = num;
+    }
+    return cRight >= pLeft && cLeft <= pRight && cBottom >= pTop && cTop <= pBottom;
+}
+
+void ObjectSystem_ProcessObjects()
+{
+    int num;
+    int num1;
+    bool flag = false;
+    objectDrawOrderList[0].listSize = 0;
+    objectDrawOrderList[1].listSize = 0;
+    objectDrawOrderList[2].listSize = 0;
+    objectDrawOrderList[3].listSize = 0;
+    objectDrawOrderList[4].listSize = 0;
+    objectDrawOrderList[5].listSize = 0;
+    objectDrawOrderList[6].listSize = 0;
+    objectLoop = 0;
+    while (objectLoop < 0x4a0)
+    {
+        switch (objectEntityPriority[objectLoop])
+        {
+            case 0:
+            {
+                num = objectEntityXPos[objectLoop] >> 16;
+                num1 = objectEntityYPos[objectLoop] >> 16;
+                if (num <= xScrollOffset - OBJECT_BORDER_X1 || num >= xScrollOffset + OBJECT_BORDER_X2 || num1 <= yScrollOffset - 0x100 || num1 >= yScrollOffset + 0x1f0)
+                {
+                    flag = false;
+                    break;
+                }
+                else
+                {
+                    flag = true;
+                    break;
+                }
+            }
+            case 1:
+            {
+                flag = true;
+                break;
+            }
+            case 2:
+            {
+                flag = true;
+                break;
+            }
+            case 3:
+            {
+                num = objectEntityXPos[objectLoop] >> 16;
+                if (num <= xScrollOffset - OBJECT_BORDER_X1 || num >= xScrollOffset + OBJECT_BORDER_X2)
+                {
+                    flag = false;
+                    break;
+                }
+                else
+                {
+                    flag = true;
+                    break;
+                }
+            }
+            case 4:
+            {
+                num = objectEntityXPos[objectLoop] >> 16;
+                num1 = objectEntityYPos[objectLoop] >> 16;
+                if (num <= xScrollOffset - OBJECT_BORDER_X1 || num >= xScrollOffset + OBJECT_BORDER_X2 || num1 <= yScrollOffset - 0x100 || num1 >= yScrollOffset + 0x1f0)
+                {
+                    flag = false;
+                    objectEntityType[objectLoop] = 0;
+                    ObjectSystem_MarkTempObject(objectLoop);
+                    break;
+                }
+                else
+                {
+                    flag = true;
+                    break;
+                }
+            }
+            case 5:
+            {
+                flag = false;
+                break;
+            }
+        }
+        if (flag && objectEntityType[objectLoop] > 0)
+        {
+            int num2 = objectEntityType[objectLoop];
+            playerNum = 0;
+            if (scriptData[objectScriptList[num2].mainScript] > 0)
+            {
+                ObjectSystem_ProcessScript(objectScriptList[num2].mainScript, objectScriptList[num2].mainJumpTable, 0);
+            }
+            if (scriptData[objectScriptList[num2].playerScript] > 0)
+            {
+                while (playerNum < numActivePlayers)
+                {
+                    if (playerList[playerNum].objectInteraction == 1)
+                    {
+                        if (objectBroadphase && !ObjectSystem_PlayerInInteractionBounds(&objectScriptList[num2], &playerList[playerNum]))
                         {
-                            gKeyPress.right = (uint8_t)scriptEng.operands[i];
-                            break;
+                            //The script would only have missed its collision check
+                            scriptEng.checkResult = 0;
+                            playerScriptSkips++;
                         }
-                        case 175:
+                        else
                         {
-                            gKeyPress.buttonA = (uint8_t)scriptEng.operands[i];
-                            break;
+                            ObjectSystem_ProcessScript(objectScriptList[num2].playerScript, objectScriptList[num2].playerJumpTable, 1);
+                            playerScriptCalls++;
                         }
-                        case 176:
+                    }
+                    playerNum = playerNum + 1;
+                }
+            }
+            num2 = objectEntityDrawOrder[objectLoop];
+            if (num2 < 7)
+            {
+                objectDrawOrderList[num2].entityRef[objectDrawOrderList[num2].listSize] = objectLoop;
+                struct ObjectDrawList* objectDrawList = &objectDrawOrderList[num2];
+                objectDrawList->listSize = objectDrawList->listSize + 1;
+            }
+        }
+        objectLoop = objectLoop + 1;
+    }
+}
+
+void ObjectSystem_ProcessPausedObjects()
+{
+    objectDrawOrderList[0].listSize = 0;
+    objectDrawOrderList[1].listSize = 0;
+    objectDrawOrderList[2].listSize = 0;
+    objectDrawOrderList[3].listSize = 0;
+    objectDrawOrderList[4].listSize = 0;
+    objectDrawOrderList[5].listSize = 0;
+    objectDrawOrderList[6].listSize = 0;
+    objectLoop = 0;
+    while (objectLoop < 0x4a0)
+    {
+        if (objectEntityPriority[objectLoop] == 2 && objectEntityType[objectLoop] > 0)
+        {
+            int num = objectEntityType[objectLoop];
+            playerNum = 0;
+            if (scriptData[objectScriptList[num].mainScript] > 0)
+            {
+                ObjectSystem_ProcessScript(objectScriptList[num].mainScript, objectScriptList[num].mainJumpTable, 0);
+            }
+            if (scriptData[objectScriptList[num].playerScript] > 0)
+            {
+                while (playerNum < numActivePlayers)
+                {
+                    if (playerList[playerNum].objectInteraction == 1)
+                    {
+                        if (objectBroadphase && !ObjectSystem_PlayerInInteractionBounds(&objectScriptList[num], &playerList[playerNum]))
                         {
-                            gKeyPress.buttonB = (uint8_t)scriptEng.operands[i];
-                            break;
+                            //The script would only have missed its collision check
+                            scriptEng.checkResult = 0;
+                            playerScriptSkips++;
                         }
-                        case 177:
+                        else
                         {
-                            gKeyPress.buttonC = (uint8_t)scriptEng.operands[i];
-                            break;
+                            ObjectSystem_ProcessScript(objectScriptList[num].playerScript, objectScriptList[num].playerJumpTable, 1);
+                            playerScriptCalls++;
                         }
-                        case 178:
+                    }
+                    playerNum = playerNum + 1;
+                }
+            }
+            num = objectEntityDrawOrder[objectLoop];
+            if (num < 7)
+            {
+                objectDrawOrderList[num].entityRef[objectDrawOrderList[num].listSize] = objectLoop;
+                struct ObjectDrawList* objectDrawList = &objectDrawOrderList[num];
+                objectDrawList->listSize = objectDrawList->listSize + 1;
+            }
+        }
+        objectLoop = objectLoop + 1;
+    }
+}
+
+void ObjectSystem_ProcessScript(int scriptCodePtr, int jumpTablePtr, int scriptSub)
+{
+    CompiledScript compiledScript = ObjectSystem_FindCompiledScript(scriptCodePtr, jumpTablePtr);
+    jumpTableStackPos = 0;
+    functionStackPos = 0;
+    if (compiledScript != NULL)
+    {
+        compiledScript(scriptSub);
+    }
+    else
+    {
+        ObjectSystem_RunScript(scriptCodePtr, jumpTablePtr, scriptCodePtr, scriptSub);
+    }
+}
+
+void ObjectSystem_ProcessStartupScripts()
+{
+    objectEntityType[0x421] = objectEntityType[0];
+    scriptFramesNo = 0;
+    playerNum = 0;
+    scriptEng.arrayPosition[2] = 0x420;
+    for (int i = 0; i < 0x100; i++)
+    {
+        objectLoop = 0x420;
+        objectEntityType[0x420] = (uint8_t)i;
+        objectScriptList[i].numFrames = 0;
+        objectScriptList[i].surfaceNum = 0;
+        objectScriptList[i].frameListOffset = scriptFramesNo;
+        objectScriptList[i].numFrames = scriptFramesNo;
+        if (scriptData[objectScriptList[i].startupScript] > 0)
+        {
+            ObjectSystem_ProcessScript(objectScriptList[i].startupScript, objectScriptList[i].startupJumpTable, 3);
+        }
+        objectScriptList[i].numFrames = scriptFramesNo - objectScriptList[i].numFrames;
+    }
+    objectEntityType[0x420] = objectEntityType[0x421];
+    objectEntityType[0x420] = 0;
+    ObjectSystem_ResetTempObjects();
+}
+
+void ObjectSystem_ProfileInstruction(int opcode, int scriptCodePtr)
+{
+    //Sequences only count while the instructions follow each other in the bytecode, as only those can be fused
+    if (scriptCodePtr != scriptProfileNext)
+    {
+        scriptProfileHistoryLength = 0;
+    }
+    scriptInstructionCount++;
+    if (scriptProfileHistoryLength > 0)
+    {
+        ObjectSystem_CountNGram((2u << 24) | ((uint32_t)scriptProfileHistory[1] << 16) | ((uint32_t)opcode << 8));
+    }
+    if (scriptProfileHistoryLength > 1)
+    {
+        ObjectSystem_CountNGram((3u << 24) | ((uint32_t)scriptProfileHistory[0] << 16) | ((uint32_t)scriptProfileHistory[1] << 8) | (uint32_t)opcode);
+    }
+    scriptProfileHistory[0] = scriptProfileHistory[1];
+    scriptProfileHistory[1] = opcode;
+    scriptProfileHistoryLength++;
+    scriptProfileNext = ObjectSystem_SkipInstruction(scriptCodePtr);
+}
+
+int ObjectSystem_Random()
+{
+    //xorshift32, so a given seed plays out the same on every platform
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return (int)(randomState >> 1);
+}
+
+void ObjectSystem_ReadScriptVariable(int variableNum, int objectNum, int operandNum)
+{
+    switch (variableNum)
+    {
+        case 0:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[0];
+            break;
+        }
+        case 1:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[1];
+            break;
+        }
+        case 2:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[2];
+            break;
+        }
+        case 3:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[3];
+            break;
+        }
+        case 4:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[4];
+            break;
+        }
+        case 5:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[5];
+            break;
+        }
+        case 6:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[6];
+            break;
+        }
+        case 7:
+        {
+            scriptEng.operands[operandNum] = scriptEng.tempValue[7];
+            break;
+        }
+        case 8:
+        {
+            scriptEng.operands[operandNum] = scriptEng.checkResult;
+            break;
+        }
+        case 9:
+        {
+            scriptEng.operands[operandNum] = scriptEng.arrayPosition[0];
+            break;
+        }
+        case 10:
+        {
+            scriptEng.operands[operandNum] = scriptEng.arrayPosition[1];
+            break;
+        }
+        case 11:
+        {
+            scriptEng.operands[operandNum] = globalVariables[objectNum];
+            break;
+        }
+        case 12:
+        {
+            scriptEng.operands[operandNum] = objectNum;
+            break;
+        }
+        case 13:
+        {
+            scriptEng.operands[operandNum] = objectEntityType[objectNum];
+            break;
+        }
+        case 14:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].propertyValue;
+            break;
+        }
+        case 15:
+        {
+            scriptEng.operands[operandNum] = objectEntityXPos[objectNum];
+            break;
+        }
+        case 16:
+        {
+            scriptEng.operands[operandNum] = objectEntityYPos[objectNum];
+            break;
+        }
+        case 17:
+        {
+            scriptEng.operands[operandNum] = objectEntityXPos[objectNum] >> 16;
+            break;
+        }
+        case 18:
+        {
+            scriptEng.operands[operandNum] = objectEntityYPos[objectNum] >> 16;
+            break;
+        }
+        case 19:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].state;
+            break;
+        }
+        case 20:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].rotation;
+            break;
+        }
+        case 21:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].scale;
+            break;
+        }
+        case 22:
+        {
+            scriptEng.operands[operandNum] = objectEntityPriority[objectNum];
+            break;
+        }
+        case 23:
+        {
+            scriptEng.operands[operandNum] = objectEntityDrawOrder[objectNum];
+            break;
+        }
+        case 24:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].direction;
+            break;
+        }
+        case 25:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].inkEffect;
+            break;
+        }
+        case 26:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].alpha;
+            break;
+        }
+        case 27:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].frame;
+            break;
+        }
+        case 28:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].animation;
+            break;
+        }
+        case 29:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].prevAnimation;
+            break;
+        }
+        case 30:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].animationSpeed;
+            break;
+        }
+        case 31:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].animationTimer;
+            break;
+        }
+        case 32:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[0];
+            break;
+        }
+        case 33:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[1];
+            break;
+        }
+        case 34:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[2];
+            break;
+        }
+        case 35:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[3];
+            break;
+        }
+        case 36:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[4];
+            break;
+        }
+        case 37:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[5];
+            break;
+        }
+        case 38:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[6];
+            break;
+        }
+        case 39:
+        {
+            scriptEng.operands[operandNum] = objectEntityList[objectNum].value[7];
+            break;
+        }
+        case 40:
+        {
+            scriptEng.sRegister = objectEntityXPos[objectLoop] >> 16;
+            if (scriptEng.sRegister <= xScrollOffset - OBJECT_BORDER_X1 || scriptEng.sRegister >= xScrollOffset + OBJECT_BORDER_X2)
+            {
+                scriptEng.operands[operandNum] = 1;
+                break;
+            }
+            else
+            {
+                scriptEng.sRegister = objectEntityYPos[objectLoop] >> 16;
+                if (scriptEng.sRegister <= yScrollOffset - 0x100 || scriptEng.sRegister >= yScrollOffset + 0x1f0)
+                {
+                    scriptEng.operands[operandNum] = 1;
+                    break;
+                }
+                else
+                {
+                    scriptEng.operands[operandNum] = 0;
+                    break;
+                }
+            }
+        }
+        case 41:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->state;
+            break;
+        }
+        case 42:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].controlMode;
+            break;
+        }
+        case 43:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].controlLock;
+            break;
+        }
+        case 44:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].collisionMode;
+            break;
+        }
+        case 45:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].collisionPlane;
+            break;
+        }
+        case 46:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].xPos;
+            break;
+        }
+        case 47:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].yPos;
+            break;
+        }
+        case 48:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].xPos >> 16;
+            break;
+        }
+        case 49:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].yPos >> 16;
+            break;
+        }
+        case 50:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].screenXPos;
+            break;
+        }
+        case 51:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].screenYPos;
+            break;
+        }
+        case 52:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].speed;
+            break;
+        }
+        case 53:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].xVelocity;
+            break;
+        }
+        case 54:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].yVelocity;
+            break;
+        }
+        case 55:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].gravity;
+            break;
+        }
+        case 56:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].angle;
+            break;
+        }
+        case 57:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].skidding;
+            break;
+        }
+        case 58:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].pushing;
+            break;
+        }
+        case 59:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].trackScroll;
+            break;
+        }
+        case 60:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].up;
+            break;
+        }
+        case 61:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].down;
+            break;
+        }
+        case 62:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].left;
+            break;
+        }
+        case 63:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].right;
+            break;
+        }
+        case 64:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].jumpPress;
+            break;
+        }
+        case 65:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].jumpHold;
+            break;
+        }
+        case 66:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].followPlayer1;
+            break;
+        }
+        case 67:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].lookPos;
+            break;
+        }
+        case 68:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].water;
+            break;
+        }
+        case 69:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.topSpeed;
+            break;
+        }
+        case 70:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.acceleration;
+            break;
+        }
+        case 71:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.deceleration;
+            break;
+        }
+        case 72:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.airAcceleration;
+            break;
+        }
+        case 73:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.airDeceleration;
+            break;
+        }
+        case 74:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.gravity;
+            break;
+        }
+        case 75:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.jumpStrength;
+            break;
+        }
+        case 76:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.jumpCap;
+            break;
+        }
+        case 77:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.rollingAcceleration;
+            break;
+        }
+        case 78:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].movementStats.rollingDeceleration;
+            break;
+        }
+        case 79:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectNum;
+            break;
+        }
+        case 80:
+        {
+            scriptEng.operands[operandNum] = PlayerSystem_GetCollisionBox(&playerList[playerNum])->left[0];
+            break;
+        }
+        case 81:
+        {
+            scriptEng.operands[operandNum] = PlayerSystem_GetCollisionBox(&playerList[playerNum])->top[0];
+            break;
+        }
+        case 82:
+        {
+            scriptEng.operands[operandNum] = PlayerSystem_GetCollisionBox(&playerList[playerNum])->right[0];
+            break;
+        }
+        case 83:
+        {
+            scriptEng.operands[operandNum] = PlayerSystem_GetCollisionBox(&playerList[playerNum])->bottom[0];
+            break;
+        }
+        case 84:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].flailing[objectNum];
+            break;
+        }
+        case 85:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].timer;
+            break;
+        }
+        case 86:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].tileCollisions;
+            break;
+        }
+        case 87:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectInteraction;
+            break;
+        }
+        case 88:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].visible;
+            break;
+        }
+        case 89:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->rotation;
+            break;
+        }
+        case 90:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->scale;
+            break;
+        }
+        case 91:
+        {
+            scriptEng.operands[operandNum] = objectEntityPriority[playerList[playerNum].objectPtr - objectEntityList];
+            break;
+        }
+        case 92:
+        {
+            scriptEng.operands[operandNum] = objectEntityDrawOrder[playerList[playerNum].objectPtr - objectEntityList];
+            break;
+        }
+        case 93:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->direction;
+            break;
+        }
+        case 94:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->inkEffect;
+            break;
+        }
+        case 95:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->alpha;
+            break;
+        }
+        case 96:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->frame;
+            break;
+        }
+        case 97:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->animation;
+            break;
+        }
+        case 98:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->prevAnimation;
+            break;
+        }
+        case 99:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->animationSpeed;
+            break;
+        }
+        case 100:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->animationTimer;
+            break;
+        }
+        case 101:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[0];
+            break;
+        }
+        case 102:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[1];
+            break;
+        }
+        case 103:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[2];
+            break;
+        }
+        case 104:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[3];
+            break;
+        }
+        case 105:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[4];
+            break;
+        }
+        case 106:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[5];
+            break;
+        }
+        case 107:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[6];
+            break;
+        }
+        case 108:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].objectPtr->value[7];
+            break;
+        }
+        case 109:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[0];
+            break;
+        }
+        case 110:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[1];
+            break;
+        }
+        case 111:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[2];
+            break;
+        }
+        case 112:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[3];
+            break;
+        }
+        case 113:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[4];
+            break;
+        }
+        case 114:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[5];
+            break;
+        }
+        case 115:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[6];
+            break;
+        }
+        case 116:
+        {
+            scriptEng.operands[operandNum] = playerList[playerNum].value[7];
+            break;
+        }
+        case 117:
+        {
+            scriptEng.sRegister = objectEntityXPos[playerList[playerNum].objectPtr - objectEntityList] >> 16;
+            if (scriptEng.sRegister <= xScrollOffset - OBJECT_BORDER_X1 || scriptEng.sRegister >= xScrollOffset + OBJECT_BORDER_X2)
+            {
+                scriptEng.operands[operandNum] = 1;
+                break;
+            }
+            else
+            {
+                scriptEng.sRegister = objectEntityYPos[playerList[playerNum].objectPtr - objectEntityList] >> 16;
+                if (scriptEng.sRegister <= yScrollOffset - 0x100 || scriptEng.sRegister >= yScrollOffset + 0x1f0)
+                {
+                    scriptEng.operands[operandNum] = 1;
+                    break;
+                }
+                else
+                {
+                    scriptEng.operands[operandNum] = 0;
+                    break;
+                }
+            }
+        }
+        case 118:
+        {
+            scriptEng.operands[operandNum] = stageMode;
+            break;
+        }
+        case 119:
+        {
+            scriptEng.operands[operandNum] = activeStageList;
+            break;
+        }
+        case 120:
+        {
+            scriptEng.operands[operandNum] = stageListPosition;
+            break;
+        }
+        case 121:
+        {
+            scriptEng.operands[operandNum] = timeEnabled;
+            break;
+        }
+        case 122:
+        {
+            scriptEng.operands[operandNum] = milliSeconds;
+            break;
+        }
+        case 123:
+        {
+            scriptEng.operands[operandNum] = seconds;
+            break;
+        }
+        case 124:
+        {
+            scriptEng.operands[operandNum] = minutes;
+            break;
+        }
+        case 125:
+        {
+            scriptEng.operands[operandNum] = actNumber;
+            break;
+        }
+        case 126:
+        {
+            scriptEng.operands[operandNum] = pauseEnabled;
+            break;
+        }
+        case 127:
+        {
+            switch (activeStageList)
+            {
+                case 0:
+                {
+                    scriptEng.operands[operandNum] = noPresentationStages;
+                    break;
+                }
+                case 1:
+                {
+                    scriptEng.operands[operandNum] = noZoneStages;
+                    break;
+                }
+                case 2:
+                {
+                    scriptEng.operands[operandNum] = noBonusStages;
+                    break;
+                }
+                case 3:
+                {
+                    scriptEng.operands[operandNum] = noSpecialStages;
+                    break;
+                }
+            }
+            break;
+        }
+        case 128:
+        {
+            scriptEng.operands[operandNum] = newXBoundary1;
+            break;
+        }
+        case 129:
+        {
+            scriptEng.operands[operandNum] = newXBoundary2;
+            break;
+        }
+        case 130:
+        {
+            scriptEng.operands[operandNum] = newYBoundary1;
+            break;
+        }
+        case 131:
+        {
+            scriptEng.operands[operandNum] = newYBoundary2;
+            break;
+        }
+        case 132:
+        {
+            scriptEng.operands[operandNum] = xBoundary1;
+            break;
+        }
+        case 133:
+        {
+            scriptEng.operands[operandNum] = xBoundary2;
+            break;
+        }
+        case 134:
+        {
+            scriptEng.operands[operandNum] = yBoundary1;
+            break;
+        }
+        case 135:
+        {
+            scriptEng.operands[operandNum] = yBoundary2;
+            break;
+        }
+        case 136:
+        {
+            scriptEng.operands[operandNum] = bgDeformationData0[objectNum];
+            break;
+        }
+        case 137:
+        {
+            scriptEng.operands[operandNum] = bgDeformationData1[objectNum];
+            break;
+        }
+        case 138:
+        {
+            scriptEng.operands[operandNum] = bgDeformationData2[objectNum];
+            break;
+        }
+        case 139:
+        {
+            scriptEng.operands[operandNum] = bgDeformationData3[objectNum];
+            break;
+        }
+        case 140:
+        {
+            scriptEng.operands[operandNum] = waterLevel;
+            break;
+        }
+        case 141:
+        {
+            scriptEng.operands[operandNum] = activeTileLayers[objectNum];
+            break;
+        }
+        case 142:
+        {
+            scriptEng.operands[operandNum] = tLayerMidPoint;
+            break;
+        }
+        case 143:
+        {
+            scriptEng.operands[operandNum] = playerMenuNum;
+            break;
+        }
+        case 144:
+        {
+            scriptEng.operands[operandNum] = playerNum;
+            break;
+        }
+        case 145:
+        {
+            scriptEng.operands[operandNum] = cameraEnabled;
+            break;
+        }
+        case 146:
+        {
+            scriptEng.operands[operandNum] = cameraTarget;
+            break;
+        }
+        case 147:
+        {
+            scriptEng.operands[operandNum] = cameraStyle;
+            break;
+        }
+        case 148:
+        {
+            scriptEng.operands[operandNum] = objectDrawOrderList[objectNum].listSize;
+            break;
+        }
+        case 149:
+        {
+            scriptEng.operands[operandNum] = SCREEN_CENTER;
+            break;
+        }
+        case 150:
+        {
+            scriptEng.operands[operandNum] = 120;
+            break;
+        }
+        case 151:
+        {
+            scriptEng.operands[operandNum] = SCREEN_XSIZE;
+            break;
+        }
+        case 152:
+        {
+            scriptEng.operands[operandNum] = 240;
+            break;
+        }
+        case 153:
+        {
+            scriptEng.operands[operandNum] = xScrollOffset;
+            break;
+        }
+        case 154:
+        {
+            scriptEng.operands[operandNum] = yScrollOffset;
+            break;
+        }
+        case 155:
+        {
+            scriptEng.operands[operandNum] = screenShakeX;
+            break;
+        }
+        case 156:
+        {
+            scriptEng.operands[operandNum] = screenShakeY;
+            break;
+        }
+        case 157:
+        {
+            scriptEng.operands[operandNum] = cameraAdjustY;
+            break;
+        }
+        case 158:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.touchDown[objectNum];
+            break;
+        }
+        case 159:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.touchX[objectNum];
+            break;
+        }
+        case 160:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.touchY[objectNum];
+            break;
+        }
+        case 161:
+        {
+            scriptEng.operands[operandNum] = musicVolume;
+            break;
+        }
+        case 162:
+        {
+            scriptEng.operands[operandNum] = currentMusicTrack;
+            break;
+        }
+        case 163:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.up;
+            break;
+        }
+        case 164:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.down;
+            break;
+        }
+        case 165:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.left;
+            break;
+        }
+        case 166:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.right;
+            break;
+        }
+        case 167:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.buttonA;
+            break;
+        }
+        case 168:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.buttonB;
+            break;
+        }
+        case 169:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.buttonC;
+            break;
+        }
+        case 170:
+        {
+            scriptEng.operands[operandNum] = gKeyDown.start;
+            break;
+        }
+        case 171:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.up;
+            break;
+        }
+        case 172:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.down;
+            break;
+        }
+        case 173:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.left;
+            break;
+        }
+        case 174:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.right;
+            break;
+        }
+        case 175:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.buttonA;
+            break;
+        }
+        case 176:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.buttonB;
+            break;
+        }
+        case 177:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.buttonC;
+            break;
+        }
+        case 178:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.start;
+            break;
+        }
+        case 179:
+        {
+            scriptEng.operands[operandNum] = gameMenu[0].selection1;
+            break;
+        }
+        case 180:
+        {
+            scriptEng.operands[operandNum] = gameMenu[1].selection1;
+            break;
+        }
+        case 181:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].xSize;
+            break;
+        }
+        case 182:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].ySize;
+            break;
+        }
+        case 183:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].type;
+            break;
+        }
+        case 184:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].angle;
+            break;
+        }
+        case 185:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].xPos;
+            break;
+        }
+        case 186:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].yPos;
+            break;
+        }
+        case 187:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].zPos;
+            break;
+        }
+        case 188:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].parallaxFactor;
+            break;
+        }
+        case 189:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].scrollSpeed;
+            break;
+        }
+        case 190:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].scrollPosition;
+            break;
+        }
+        case 191:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].deformationPos;
+            break;
+        }
+        case 192:
+        {
+            scriptEng.operands[operandNum] = stageLayouts[objectNum].deformationPosW;
+            break;
+        }
+        case 193:
+        {
+            scriptEng.operands[operandNum] = hParallax.parallaxFactor[objectNum];
+            break;
+        }
+        case 194:
+        {
+            scriptEng.operands[operandNum] = hParallax.scrollSpeed[objectNum];
+            break;
+        }
+        case 195:
+        {
+            scriptEng.operands[operandNum] = hParallax.scrollPosition[objectNum];
+            break;
+        }
+        case 196:
+        {
+            scriptEng.operands[operandNum] = vParallax.parallaxFactor[objectNum];
+            break;
+        }
+        case 197:
+        {
+            scriptEng.operands[operandNum] = vParallax.scrollSpeed[objectNum];
+            break;
+        }
+        case 198:
+        {
+            scriptEng.operands[operandNum] = vParallax.scrollPosition[objectNum];
+            break;
+        }
+        case 199:
+        {
+            scriptEng.operands[operandNum] = numVertices;
+            break;
+        }
+        case 200:
+        {
+            scriptEng.operands[operandNum] = numFaces;
+            break;
+        }
+        case 201:
+        {
+            scriptEng.operands[operandNum] = vertexBuffer[objectNum].x;
+            break;
+        }
+        case 202:
+        {
+            scriptEng.operands[operandNum] = vertexBuffer[objectNum].y;
+            break;
+        }
+        case 203:
+        {
+            scriptEng.operands[operandNum] = vertexBuffer[objectNum].z;
+            break;
+        }
+        case 204:
+        {
+            scriptEng.operands[operandNum] = vertexBuffer[objectNum].u;
+            break;
+        }
+        case 205:
+        {
+            scriptEng.operands[operandNum] = vertexBuffer[objectNum].v;
+            break;
+        }
+        case 206:
+        {
+            scriptEng.operands[operandNum] = indexBuffer[objectNum].a;
+            break;
+        }
+        case 207:
+        {
+            scriptEng.operands[operandNum] = indexBuffer[objectNum].b;
+            break;
+        }
+        case 208:
+        {
+            scriptEng.operands[operandNum] = indexBuffer[objectNum].c;
+            break;
+        }
+        case 209:
+        {
+            scriptEng.operands[operandNum] = indexBuffer[objectNum].d;
+            break;
+        }
+        case 210:
+        {
+            scriptEng.operands[operandNum] = indexBuffer[objectNum].flag;
+            break;
+        }
+        case 211:
+        {
+            scriptEng.operands[operandNum] = indexBuffer[objectNum].color;
+            break;
+        }
+        case 212:
+        {
+            scriptEng.operands[operandNum] = projectionX;
+            break;
+        }
+        case 213:
+        {
+            scriptEng.operands[operandNum] = projectionY;
+            break;
+        }
+        case 214:
+        {
+            scriptEng.operands[operandNum] = gameMode;
+            break;
+        }
+        case 215:
+        {
+            scriptEng.operands[operandNum] = debugMode;
+            break;
+        }
+        case 216:
+        {
+            scriptEng.operands[operandNum] = gameMessage;
+            break;
+        }
+        case 217:
+        {
+            scriptEng.operands[operandNum] = saveRAM[objectNum];
+            break;
+        }
+        case 218:
+        {
+            scriptEng.operands[operandNum] = gameLanguage;
+            break;
+        }
+        case 219:
+        {
+            scriptEng.operands[operandNum] = objectScriptList[objectEntityType[objectLoop]].surfaceNum;
+            break;
+        }
+        case 220:
+        {
+            scriptEng.operands[operandNum] = gameOnlineActive;
+            break;
+        }
+        case 221:
+        {
+            scriptEng.operands[operandNum] = frameSkipTimer;
+            break;
+        }
+        case 222:
+        {
+            scriptEng.operands[operandNum] = frameSkipSetting;
+            break;
+        }
+        case 223:
+        {
+            scriptEng.operands[operandNum] = gameSFXVolume;
+            break;
+        }
+        case 224:
+        {
+            scriptEng.operands[operandNum] = gameBGMVolume;
+            break;
+        }
+        case 225:
+        {
+            scriptEng.operands[operandNum] = gamePlatformID;
+            break;
+        }
+        case 226:
+        {
+            scriptEng.operands[operandNum] = gameTrialMode;
+            break;
+        }
+        case 227:
+        {
+            scriptEng.operands[operandNum] = gKeyPress.start;
+            break;
+        }
+        case 228:
+        {
+            scriptEng.operands[operandNum] = gameHapticsEnabled;
+            break;
+        }
+    }
+}
+
+void ObjectSystem_ResetTempObjects()
+{
+    memset(tempObjectFreeMap, 0, sizeof(tempObjectFreeMap));
+    tempObjectFreeCount = 0;
+    for (int i = 0; i < tempObjectPoolSize; i++)
+    {
+        if (objectEntityType[TEMP_OBJECT_START + i] == 0)
+        {
+            tempObjectFreeMap[i >> 5] |= 1u << (i & 31);
+            tempObjectFreeCount++;
+        }
+    }
+}
+
+int ObjectSystem_RunScript(int scriptCodePtr, int jumpTablePtr, int scriptStart, int scriptSub)
+{
+    int i;
+    int num;
+    bool flag = false;
+    int num1 = 0;
+    int num2 = scriptStart;
+    while (!flag)
+    {
+        int num3 = scriptData[scriptCodePtr];
+        if (scriptProfileEnabled)
+        {
+            scriptDispatchCount++;
+            if (num3 < SUPERINSTRUCTION_OPCODE)
+            {
+                ObjectSystem_ProfileInstruction(num3, scriptCodePtr);
+            }
+        }
+        if (num3 >= SUPERINSTRUCTION_OPCODE)
+        {
+            scriptCodePtr = ObjectSystem_RunSuperInstruction(num3 - SUPERINSTRUCTION_OPCODE, scriptCodePtr, jumpTablePtr, num2, scriptSub);
+            continue;
+        }
+        scriptCodePtr++;
+        int num4 = 0;
+        signed char num5 = scriptOpcodeSizes[num3];
+        for (i = 0; i < num5; i++)
+        {
+            switch (scriptData[scriptCodePtr])
+            {
+                case 1:
+                {
+                    scriptCodePtr++;
+                    num4++;
+                    switch (scriptData[scriptCodePtr])
+                    {
+                        case 0:
                         {
-                            gKeyPress.start = (uint8_t)scriptEng.operands[i];
+                            num1 = objectLoop;
                             break;
                         }
-                        case 179:
+                        case 1:
                         {
-                            gameMenu[0].selection1 = scriptEng.operands[i];
+                            scriptCodePtr++;
+                            if (scriptData[scriptCodePtr] != 1)
+                            {
+                                scriptCodePtr++;
+                                num1 = scriptData[scriptCodePtr];
+                            }
+                            else
+                            {
+                                scriptCodePtr++;
+                                num1 = scriptEng.arrayPosition[scriptData[scriptCodePtr]];
+                            }
+                            num4 = num4 + 2;
                             break;
                         }
-                        case 180:
+                        case 2:
                         {
-                            gameMenu[1].selection1 = scriptEng.operands[i];
+                            scriptCodePtr++;
+                            if (scriptData[scriptCodePtr] != 1)
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop + scriptData[scriptCodePtr];
+                            }
+                            else
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop + scriptEng.arrayPosition[scriptData[scriptCodePtr]];
+                            }
+                            num4 = num4 + 2;
                             break;
                         }
-                        case 181:
+                        case 3:
                         {
-                            stageLayouts[num1].xSize = (uint8_t)scriptEng.operands[i];
+                            scriptCodePtr++;
+                            if (scriptData[scriptCodePtr] != 1)
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop - scriptData[scriptCodePtr];
+                            }
+                            else
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop - scriptEng.arrayPosition[scriptData[scriptCodePtr]];
+                            }
+                            num4 = num4 + 2;
                             break;
                         }
-                        case 182:
+                    }
+                    scriptCodePtr++;
+                    num4++;
+                    ObjectSystem_ReadScriptVariable(scriptData[scriptCodePtr], num1, i);
+                    scriptCodePtr++;
+                    num4++;
+                    break;
+                }
+                case 2:
+                {
+                    scriptCodePtr++;
+                    scriptEng.operands[i] = scriptData[scriptCodePtr];
+                    scriptCodePtr++;
+                    num4 = num4 + 2;
+                    break;
+                }
+                case 3:
+                {
+                    scriptCodePtr++;
+                    num4++;
+                    num = 0;
+                    num1 = 0;
+                    scriptEng.sRegister = scriptData[scriptCodePtr];
+                    scriptText[scriptEng.sRegister] = '\0';
+                    while (num < scriptEng.sRegister)
+                    {
+                        switch (num1)
                         {
-                            stageLayouts[num1].ySize = (uint8_t)scriptEng.operands[i];
-                            break;
+                            case 0:
+                            {
+                                scriptCodePtr++;
+                                num4++;
+                                scriptText[num] = (char)(scriptData[scriptCodePtr] >> 24);
+                                num1++;
+                                break;
+                            }
+                            case 1:
+                            {
+                                scriptText[num] = (char)((scriptData[scriptCodePtr] & 0xffffff) >> 16);
+                                num1++;
+                                break;
+                            }
+                            case 2:
+                            {
+                                scriptText[num] = (char)((scriptData[scriptCodePtr] & 0xffff) >> 8);
+                                num1++;
+                                break;
+                            }
+                            case 3:
+                            {
+                                scriptText[num] = (char)(scriptData[scriptCodePtr] & 0xff);
+                                num1 = 0;
+                                break;
+                            }
                         }
-                        case 183:
+                        num++;
+                    }
+                    if (num1 != 0)
+                    {
+                        scriptCodePtr++;
+                        num4++;
+                        break;
+                    }
+                    else
+                    {
+                        scriptCodePtr = scriptCodePtr + 2;
+                        num4 = num4 + 2;
+                        break;
+                    }
+                }
+            }
+        }
+        switch (num3)
+        {
+            case 0:
+            {
+                flag = true;
+                break;
+            }
+            //The common arithmetic is kept here as well to save a call per instruction
+            case 1:
+            {
+                scriptEng.operands[0] = scriptEng.operands[1];
+                break;
+            }
+            case 2:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] + scriptEng.operands[1];
+                break;
+            }
+            case 3:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] - scriptEng.operands[1];
+                break;
+            }
+            case 4:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] + 1;
+                break;
+            }
+            case 5:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] - 1;
+                break;
+            }
+            case 6:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] * scriptEng.operands[1];
+                break;
+            }
+            case 8:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] >> (scriptEng.operands[1] & 31);
+                break;
+            }
+            case 9:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] << (scriptEng.operands[1] & 31);
+                break;
+            }
+            case 10:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] & scriptEng.operands[1];
+                break;
+            }
+            case 11:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] | scriptEng.operands[1];
+                break;
+            }
+            case 12:
+            {
+                scriptEng.operands[0] = scriptEng.operands[0] ^ scriptEng.operands[1];
+                break;
+            }
+            case 14:
+            {
+                scriptEng.operands[0] = -scriptEng.operands[0];
+                break;
+            }
+            case 19:
+            {
+                if (scriptEng.operands[1] != scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 20:
+            {
+                if (scriptEng.operands[1] <= scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 21:
+            {
+                if (scriptEng.operands[1] < scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 22:
+            {
+                if (scriptEng.operands[1] >= scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 23:
+            {
+                if (scriptEng.operands[1] > scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 24:
+            {
+                if (scriptEng.operands[1] == scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 25:
+            {
+                num5 = 0;
+                scriptCodePtr = num2;
+                scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + jumpTableStack[jumpTableStackPos] + 1];
+                jumpTableStackPos = jumpTableStackPos - 1;
+                break;
+            }
+            case 26:
+            {
+                num5 = 0;
+                jumpTableStackPos = jumpTableStackPos - 1;
+                break;
+            }
+            case 27:
+            {
+                if (scriptEng.operands[1] != scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 28:
+            {
+                if (scriptEng.operands[1] <= scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 29:
+            {
+                if (scriptEng.operands[1] < scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 30:
+            {
+                if (scriptEng.operands[1] >= scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 31:
+            {
+                if (scriptEng.operands[1] > scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 32:
+            {
+                if (scriptEng.operands[1] == scriptEng.operands[2])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+                }
+                else
+                {
+                    jumpTableStackPos = jumpTableStackPos + 1;
+                    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                }
+                num5 = 0;
+                break;
+            }
+            case 33:
+            {
+                num5 = 0;
+                scriptCodePtr = num2;
+                scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + jumpTableStack[jumpTableStackPos]];
+                jumpTableStackPos = jumpTableStackPos - 1;
+                break;
+            }
+            case 34:
+            {
+                jumpTableStackPos = jumpTableStackPos + 1;
+                jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+                if (scriptEng.operands[1] < jumpTableData[jumpTablePtr + scriptEng.operands[0]] || scriptEng.operands[1] > jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1])
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 2];
+                }
+                else
+                {
+                    scriptCodePtr = num2;
+                    scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 4 + (scriptEng.operands[1] - jumpTableData[jumpTablePtr + scriptEng.operands[0]])];
+                }
+                num5 = 0;
+                break;
+            }
+            case 35:
+            {
+                num5 = 0;
+                scriptCodePtr = num2;
+                scriptCodePtr = scriptCodePtr + jumpTableData[jumpTablePtr + jumpTableStack[jumpTableStackPos] + 3];
+                jumpTableStackPos = jumpTableStackPos - 1;
+                break;
+            }
+            case 36:
+            {
+                num5 = 0;
+                jumpTableStackPos = jumpTableStackPos - 1;
+                break;
+            }
+            case 105:
+            {
+                num5 = 0;
+                functionStack[functionStackPos] = scriptCodePtr;
+                functionStackPos = functionStackPos + 1;
+                functionStack[functionStackPos] = jumpTablePtr;
+                functionStackPos = functionStackPos + 1;
+                functionStack[functionStackPos] = num2;
+                functionStackPos = functionStackPos + 1;
+                scriptCodePtr = functionScriptList[scriptEng.operands[0]].mainScript;
+                num2 = scriptCodePtr;
+                jumpTablePtr = functionScriptList[scriptEng.operands[0]].mainJumpTable;
+                break;
+            }
+            case 106:
+            {
+                num5 = 0;
+                functionStackPos = functionStackPos - 1;
+                num2 = functionStack[functionStackPos];
+                functionStackPos = functionStackPos - 1;
+                jumpTablePtr = functionStack[functionStackPos];
+                functionStackPos = functionStackPos - 1;
+                scriptCodePtr = functionStack[functionStackPos];
+                break;
+            }
+            default:
+            {
+                num5 = (signed char)ObjectSystem_ExecuteOpcode(num3, scriptSub);
+                break;
+            }
+        }
+        if (num5 > 0)
+        {
+            scriptCodePtr = scriptCodePtr - num4;
+        }
+        for (i = 0; i < num5; i++)
+        {
+            switch (scriptData[scriptCodePtr])
+            {
+                case 1:
+                {
+                    scriptCodePtr++;
+                    switch (scriptData[scriptCodePtr])
+                    {
+                        case 0:
                         {
-                            stageLayouts[num1].type = (uint8_t)scriptEng.operands[i];
+                            num1 = objectLoop;
                             break;
                         }
-                        case 184:
+                        case 1:
                         {
-                            stageLayouts[num1].angle = scriptEng.operands[i];
-                            if (stageLayouts[num1].angle < 0)
+                            scriptCodePtr++;
+                            if (scriptData[scriptCodePtr] != 1)
                             {
-                                struct LayoutMap* layoutMap = &stageLayouts[num1];
-                                layoutMap->angle = layoutMap->angle + 0x200;
+                                scriptCodePtr++;
+                                num1 = scriptData[scriptCodePtr];
+                                break;
+                            }
+                            else
+                            {
+                                scriptCodePtr++;
+                                num1 = scriptEng.arrayPosition[scriptData[scriptCodePtr]];
+                                break;
                             }
-                            struct LayoutMap* layoutMap1 = &stageLayouts[num1];
-                            layoutMap1->angle = layoutMap1->angle & 0x1ff;
-                            break;
-                        }
-                        case 185:
-                        {
-                            stageLayouts[num1].xPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 186:
-                        {
-                            stageLayouts[num1].yPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 187:
-                        {
-                            stageLayouts[num1].zPos = scriptEng.operands[i];
-                            break;
-                        }
-                        case 188:
-                        {
-                            stageLayouts[num1].parallaxFactor = scriptEng.operands[i];
-                            break;
-                        }
-                        case 189:
-                        {
-                            stageLayouts[num1].scrollSpeed = scriptEng.operands[i];
-                            break;
-                        }
-                        case 190:
-                        {
-                            stageLayouts[num1].scrollPosition = scriptEng.operands[i];
-                            break;
-                        }
-                        case 191:
-                        {
-                            stageLayouts[num1].deformationPos = scriptEng.operands[i];
-                            struct LayoutMap* layoutMap2 = &stageLayouts[num1];
-                            layoutMap2->deformationPos = layoutMap2->deformationPos & 0xff;
-                            break;
-                        }
-                        case 192:
-                        {
-                            stageLayouts[num1].deformationPosW = scriptEng.operands[i];
-                            struct LayoutMap* layoutMap3 = &stageLayouts[num1];
-                            layoutMap3->deformationPosW = layoutMap3->deformationPosW & 0xff;
-                            break;
-                        }
-                        case 193:
-                        {
-                            hParallax.parallaxFactor[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 194:
-                        {
-                            hParallax.scrollSpeed[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 195:
-                        {
-                            hParallax.scrollPosition[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 196:
-                        {
-                            vParallax.parallaxFactor[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 197:
-                        {
-                            vParallax.scrollSpeed[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 198:
-                        {
-                            vParallax.scrollPosition[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 199:
-                        {
-                            numVertices = scriptEng.operands[i];
-                            break;
-                        }
-                        case 200:
-                        {
-                            numFaces = scriptEng.operands[i];
-                            break;
-                        }
-                        case 201:
-                        {
-                            vertexBuffer[num1].x = scriptEng.operands[i];
-                            break;
-                        }
-                        case 202:
-                        {
-                            vertexBuffer[num1].y = scriptEng.operands[i];
-                            break;
-                        }
-                        case 203:
-                        {
-                            vertexBuffer[num1].z = scriptEng.operands[i];
-                            break;
-                        }
-                        case 204:
-                        {
-                            vertexBuffer[num1].u = scriptEng.operands[i];
-                            break;
-                        }
-                        case 205:
-                        {
-                            vertexBuffer[num1].v = scriptEng.operands[i];
-                            break;
-                        }
-                        case 206:
-                        {
-                            indexBuffer[num1].a = scriptEng.operands[i];
-                            break;
-                        }
-                        case 207:
-                        {
-                            indexBuffer[num1].b = scriptEng.operands[i];
-                            break;
-                        }
-                        case 208:
-                        {
-                            indexBuffer[num1].c = scriptEng.operands[i];
-                            break;
-                        }
-                        case 209:
-                        {
-                            indexBuffer[num1].d = scriptEng.operands[i];
-                            break;
-                        }
-                        case 210:
-                        {
-                            indexBuffer[num1].flag = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 211:
-                        {
-                            indexBuffer[num1].color = scriptEng.operands[i];
-                            break;
-                        }
-                        case 212:
-                        {
-                            projectionX = scriptEng.operands[i];
-                            break;
-                        }
-                        case 213:
-                        {
-                            projectionY = scriptEng.operands[i];
-                            break;
-                        }
-                        case 214:
-                        {
-                            gameMode = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 215:
-                        {
-                            debugMode = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 217:
-                        {
-                            saveRAM[num1] = scriptEng.operands[i];
-                            break;
-                        }
-                        case 218:
-                        {
-                            gameLanguage = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 219:
-                        {
-                            objectScriptList[objectEntityList[objectLoop].type].surfaceNum = (uint8_t)scriptEng.operands[i];
-                            break;
-                        }
-                        case 221:
-                        {
-                            frameSkipTimer = scriptEng.operands[i];
-                            break;
-                        }
-                        case 222:
-                        {
-                            frameSkipSetting = scriptEng.operands[i];
-                            break;
-                        }
-                        case 223:
-                        {
-                            gameSFXVolume = scriptEng.operands[i];
-                            AudioPlayback_SetGameVolumes(gameBGMVolume, gameSFXVolume);
-                            break;
-                        }
-                        case 224:
-                        {
-                            gameBGMVolume = scriptEng.operands[i];
-                            AudioPlayback_SetGameVolumes(gameBGMVolume, gameSFXVolume);
-                            break;
-                        }
-                        case 227:
-                        {
-                            gKeyPress.start = (uint8_t)scriptEng.operands[i];
-                            break;
                         }
-                        case 228:
+                        case 2:
                         {
-                            gameHapticsEnabled = (uint8_t)scriptEng.operands[i];
-                            break;
+                            scriptCodePtr++;
+                            if (scriptData[scriptCodePtr] != 1)
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop + scriptData[scriptCodePtr];
+                                break;
+                            }
+                            else
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop + scriptEng.arrayPosition[scriptData[scriptCodePtr]];
+                                break;
+                            }
                         }
-                        case 12:
-                        case 40:
-                        case 79:
-                        case 80:
-                        case 81:
-                        case 82:
-                        case 83:
-                        case 117:
-                        case 127:
-                        case 149:
-                        case 150:
-                        case 151:
-                        case 152:
-                        case 158:
-                        case 159:
-                        case 160:
-                        case 162:
-                        case 216:
-                        case 220:
-                        case 225:
-                        case 226:
-                        default:
+                        case 3:
                         {
-                            break;
+                            scriptCodePtr++;
+                            if (scriptData[scriptCodePtr] != 1)
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop - scriptData[scriptCodePtr];
+                                break;
+                            }
+                            else
+                            {
+                                scriptCodePtr++;
+                                num1 = objectLoop - scriptEng.arrayPosition[scriptData[scriptCodePtr]];
+                                break;
+                            }
                         }
                     }
                     scriptCodePtr++;
+                    ObjectSystem_WriteScriptVariable(scriptData[scriptCodePtr], num1, i);
+                    scriptCodePtr++;
                     break;
                 }
                 case 2:
@@ -6004,55 +5201,1450 @@ void ObjectSystem_ProcessScript(int scriptCodePtr, int jumpTablePtr, int scriptS
                 }
             }
         }
-    }
-}
-
-void ObjectSystem_ProcessStartupScripts()
-{
-    objectEntityList[0x421].type = objectEntityList[0].type;
-    scriptFramesNo = 0;
-    playerNum = 0;
-    scriptEng.arrayPosition[2] = 0x420;
-    for (int i = 0; i < 0x100; i++)
-    {
-        objectLoop = 0x420;
-        objectEntityList[0x420].type = (uint8_t)i;
-        objectScriptList[i].numFrames = 0;
-        objectScriptList[i].surfaceNum = 0;
-        objectScriptList[i].frameListOffset = scriptFramesNo;
-        objectScriptList[i].numFrames = scriptFramesNo;
-        if (scriptData[objectScriptList[i].startupScript] > 0)
+    }
+    return 1;
+}
+
+int ObjectSystem_RunSuperInstruction(int superNum, int scriptCodePtr, int jumpTablePtr, int scriptStart, int scriptSub)
+{
+    //Runs each part the way ObjectSystem_RunScript would, but reads operands straight from the
+    //layout ObjectSystem_MatchSuperInstruction checked. Returns where to carry on.
+    struct ScriptSuperInstruction* superInstruction = &superInstructions[superNum];
+    int opcode;
+    int operandPtr;
+    int i;
+    int j;
+    bool jump;
+    for (i = 0; i < superInstruction->length; i++)
+    {
+        opcode = superInstruction->opcodes[i];
+        if (scriptProfileEnabled)
+        {
+            ObjectSystem_ProfileInstruction(opcode, scriptCodePtr);
+        }
+        scriptCodePtr++;
+        operandPtr = scriptCodePtr;
+        for (j = 0; j < scriptOpcodeSizes[opcode]; j++)
+        {
+            if (scriptData[scriptCodePtr] == 2)
+            {
+                scriptEng.operands[j] = scriptData[scriptCodePtr + 1];
+                scriptCodePtr = scriptCodePtr + 2;
+            }
+            else
+            {
+                ObjectSystem_ReadScriptVariable(scriptData[scriptCodePtr + 2], objectLoop, j);
+                scriptCodePtr = scriptCodePtr + 3;
+            }
+        }
+        if ((opcode >= 19 && opcode <= 24) || (opcode >= 27 && opcode <= 32))
+        {
+            //A branch can only come last
+            switch ((opcode - 19) & 7)
+            {
+                case 0:
+                {
+                    jump = scriptEng.operands[1] != scriptEng.operands[2];
+                    break;
+                }
+                case 1:
+                {
+                    jump = scriptEng.operands[1] <= scriptEng.operands[2];
+                    break;
+                }
+                case 2:
+                {
+                    jump = scriptEng.operands[1] < scriptEng.operands[2];
+                    break;
+                }
+                case 3:
+                {
+                    jump = scriptEng.operands[1] >= scriptEng.operands[2];
+                    break;
+                }
+                case 4:
+                {
+                    jump = scriptEng.operands[1] > scriptEng.operands[2];
+                    break;
+                }
+                default:
+                {
+                    jump = scriptEng.operands[1] == scriptEng.operands[2];
+                    break;
+                }
+            }
+            if (opcode >= 27 && jump)
+            {
+                return scriptStart + jumpTableData[jumpTablePtr + scriptEng.operands[0] + 1];
+            }
+            jumpTableStackPos = jumpTableStackPos + 1;
+            jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];
+            if (jump)
+            {
+                return scriptStart + jumpTableData[jumpTablePtr + scriptEng.operands[0]];
+            }
+            return scriptCodePtr;
+        }
+        if (ObjectSystem_ExecuteOpcode(opcode, scriptSub) > 0)
+        {
+            for (j = 0; j < scriptOpcodeSizes[opcode]; j++)
+            {
+                if (scriptData[operandPtr] == 2)
+                {
+                    operandPtr = operandPtr + 2;
+                }
+                else
+                {
+                    ObjectSystem_WriteScriptVariable(scriptData[operandPtr + 2], objectLoop, j);
+                    operandPtr = operandPtr + 3;
+                }
+            }
+        }
+    }
+    return scriptCodePtr;
+}
+
+void ObjectSystem_UpdateScriptQuads(int scriptNum)
+{
+    //Script frames are drawn with their object type's sheet, so they are baked against it.
+    int frameEnd = objectScriptList[scriptNum].frameListOffset + objectScriptList[scriptNum].numFrames;
+    for (int i = objectScriptList[scriptNum].frameListOffset; i < frameEnd && i < 0x1000; i++)
+    {
+        GraphicsSystem_BuildSpriteQuads(&scriptQuads[i << 2], &scriptFrames[i], (int)objectScriptList[scriptNum].surfaceNum);
+    }
+}
+void ObjectSystem_UpdateSpriteQuads()
+{
+    for (int i = 0; i < 0x100; i++)
+    {
+        ObjectSystem_UpdateScriptQuads(i);
+    }
+}
+
+void ObjectSystem_SetInteractionBounds(int scriptNum, int cType, int cLeft, int cTop, int cRight, int cBottom)
+{
+    objectScriptList[scriptNum].interactionBounds = 1;
+    objectScriptList[scriptNum].interactionType = (uint8_t)cType;
+    objectScriptList[scriptNum].interactionLeft = cLeft;
+    objectScriptList[scriptNum].interactionTop = cTop;
+    objectScriptList[scriptNum].interactionRight = cRight;
+    objectScriptList[scriptNum].interactionBottom = cBottom;
+}
+
+void ObjectSystem_SetObjectTypeName(char* typeName, int scriptNum)
+{
+    int length = 0;
+    int num = 0;
+    while (length < (int)strlen(typeName))
+    {
+        if (typeName[length] == 0)
+        {
+            length = (int)strlen(typeName);
+        }
+        else
+        {
+            if (typeName[length] != ' ')
+            {
+                typeNames[scriptNum][num] = typeName[length];
+                num++;
+            }
+            length++;
+        }
+    }
+    if (num < sizeof(typeNames[1]))
+    {
+        typeNames[scriptNum][num] = '\0';
+    }
+}
+
+void ObjectSystem_SetRandomSeed(uint32_t seed)
+{
+    randomState = seed;
+    if (randomState == 0)
+    {
+        randomState = 0x9e3779b9; //xorshift never leaves a zero state
+    }
+}
+
+void ObjectSystem_SetTempObjectPoolSize(int poolSize)
+{
+    if (poolSize < 1)
+    {
+        poolSize = 1;
+    }
+    if (poolSize > TEMP_OBJECT_COUNT)
+    {
+        poolSize = TEMP_OBJECT_COUNT;
+    }
+    tempObjectPoolSize = poolSize;
+    ObjectSystem_ResetTempObjects();
+}
+
+int ObjectSystem_SkipInstruction(int scriptCodePtr)
+{
+    //Returns where the next instruction starts, or -1 when the bytecode doesn't decode
+    int opcode = ObjectSystem_GetOpcode(scriptCodePtr);
+    if (opcode < 0 || opcode >= (int)sizeof(scriptOpcodeSizes))
+    {
+        return -1;
+    }
+    scriptCodePtr++;
+    for (int i = 0; i < scriptOpcodeSizes[opcode]; i++)
+    {
+        if (scriptCodePtr + 1 >= SCRIPT_DATA_SIZE)
+        {
+            return -1;
+        }
+        switch (scriptData[scriptCodePtr])
+        {
+            case 1:
+            {
+                scriptCodePtr = scriptCodePtr + (scriptData[scriptCodePtr + 1] == 0 ? 3 : 5);
+                break;
+            }
+            case 2:
+            {
+                scriptCodePtr = scriptCodePtr + 2;
+                break;
+            }
+            case 3:
+            {
+                if (scriptData[scriptCodePtr + 1] < 0)
+                {
+                    return -1;
+                }
+                scriptCodePtr = scriptCodePtr + 3 + (scriptData[scriptCodePtr + 1] >> 2);
+                break;
+            }
+            default:
+            {
+                return -1;
+            }
+        }
+    }
+    return scriptCodePtr < SCRIPT_DATA_SIZE ? scriptCodePtr : -1;
+}
+
+void ObjectSystem_StartScriptProfileStage()
+{
+    struct ScriptStageProfile* stageProfile;
+    if (!scriptProfileEnabled)
+    {
+        return;
+    }
+    if (numScriptStageProfiles > 0)
+    {
+        scriptStageProfiles[numScriptStageProfiles - 1].instructions = scriptInstructionCount;
+        scriptStageProfiles[numScriptStageProfiles - 1].dispatches = scriptDispatchCount;
+    }
+    //Once the list is full the last stage keeps counting
+    if (numScriptStageProfiles == SCRIPT_STAGE_PROFILES)
+    {
+        return;
+    }
+    stageProfile = &scriptStageProfiles[numScriptStageProfiles++];
+    stageProfile->activeStageList = activeStageList;
+    stageProfile->stageListPosition = stageListPosition;
+    stageProfile->fusedSites = numSuperInstructionSites;
+    scriptInstructionCount = 0;
+    scriptDispatchCount = 0;
+    scriptProfileHistoryLength = 0;
+}
+
+bool ObjectSystem_SuperInstructionAllowed(const uint8_t* opcodes, int length)
+{
+    //Anything that moves the script pointer or the stacks breaks a sequence, except a conditional
+    //branch at the very end
+    for (int i = 0; i < length; i++)
+    {
+        int opcode = opcodes[i];
+        bool branch = (opcode >= 19 && opcode <= 24) || (opcode >= 27 && opcode <= 32);
+        if (opcode == 0 || (opcode >= 19 && opcode <= 36 && !(branch && i == length - 1)) || opcode == 105 || opcode == 106)
+        {
+            return false;
+        }
+    }
+    return length >= 2 && length <= SUPERINSTRUCTION_LENGTH;
+}
+
+void ObjectSystem_WriteScriptProfile(const char* filePath)
+{
+    //Dispatches per stage, then the hottest sequences, then the ones worth fusing as fuse lines
+    //ObjectSystem_LoadSuperInstructions can read back
+    struct ScriptNGram* nGrams;
+    struct ScriptStageProfile* stageProfile;
+    int num = 0;
+    int i;
+    int j;
+    FILE* file = fopen(filePath, "w");
+    if (file == NULL)
+    {
+        return;
+    }
+    if (numScriptStageProfiles > 0)
+    {
+        scriptStageProfiles[numScriptStageProfiles - 1].instructions = scriptInstructionCount;
+        scriptStageProfiles[numScriptStageProfiles - 1].dispatches = scriptDispatchCount;
+    }
+    fprintf(file, "#stage list position instructions dispatches saved fusedsites\n");
+    for (i = 0; i < numScriptStageProfiles; i++)
+    {
+        stageProfile = &scriptStageProfiles[i];
+        fprintf(file, "stage %d %d %u %u %.1f%% %d\n", stageProfile->activeStageList, stageProfile->stageListPosition, stageProfile->instructions, stageProfile->dispatches,
+                stageProfile->instructions > 0 ? 100.0 * (stageProfile->instructions - stageProfile->dispatches) / stageProfile->instructions : 0.0, stageProfile->fusedSites);
+    }
+    nGrams = malloc(sizeof(struct ScriptNGram) * SCRIPT_NGRAM_TABLE_SIZE);
+    for (i = 0; i < SCRIPT_NGRAM_TABLE_SIZE; i++)
+    {
+        if (scriptNGrams[i].key != 0)
+        {
+            nGrams[num++] = scriptNGrams[i];
+        }
+    }
+    //Rank by dispatches saved, a sequence of n instructions saves n - 1 of them each time it runs
+    for (i = 1; i < num; i++)
+    {
+        struct ScriptNGram nGram = nGrams[i];
+        uint64_t saved = (uint64_t)nGram.count * ((nGram.key >> 24) - 1);
+        for (j = i; j > 0 && (uint64_t)nGrams[j - 1].count * ((nGrams[j - 1].key >> 24) - 1) < saved; j--)
+        {
+            nGrams[j] = nGrams[j - 1];
+        }
+        nGrams[j] = nGram;
+    }
+    fprintf(file, "#ngram count opcodes\n");
+    for (i = 0; i < num && i < 0x40; i++)
+    {
+        fprintf(file, "ngram %u %d %d", nGrams[i].count, (nGrams[i].key >> 16) & 0xff, (nGrams[i].key >> 8) & 0xff);
+        if ((nGrams[i].key >> 24) == 3)
+        {
+            fprintf(file, " %d", nGrams[i].key & 0xff);
+        }
+        fprintf(file, "\n");
+    }
+    fprintf(file, "#fuse opcodes\n");
+    j = 0;
+    for (i = 0; i < num && j < SUPERINSTRUCTION_COUNT; i++)
+    {
+        uint8_t opcodes[SUPERINSTRUCTION_LENGTH] = { (uint8_t)(nGrams[i].key >> 16), (uint8_t)(nGrams[i].key >> 8), (uint8_t)nGrams[i].key };
+        int length = nGrams[i].key >> 24;
+        if (ObjectSystem_SuperInstructionAllowed(opcodes, length))
+        {
+            fprintf(file, length == 3 ? "fuse %d %d %d\n" : "fuse %d %d\n", opcodes[0], opcodes[1], opcodes[2]);
+            j++;
+        }
+    }
+    free(nGrams);
+    fclose(file);
+}
+
+void ObjectSystem_WriteScriptVariable(int variableNum, int objectNum, int operandNum)
+{
+    switch (variableNum)
+    {
+        case 0:
+        {
+            scriptEng.tempValue[0] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 1:
+        {
+            scriptEng.tempValue[1] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 2:
+        {
+            scriptEng.tempValue[2] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 3:
+        {
+            scriptEng.tempValue[3] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 4:
+        {
+            scriptEng.tempValue[4] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 5:
+        {
+            scriptEng.tempValue[5] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 6:
+        {
+            scriptEng.tempValue[6] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 7:
+        {
+            scriptEng.tempValue[7] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 8:
+        {
+            scriptEng.checkResult = scriptEng.operands[operandNum];
+            break;
+        }
+        case 9:
+        {
+            scriptEng.arrayPosition[0] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 10:
+        {
+            scriptEng.arrayPosition[1] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 11:
+        {
+            globalVariables[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 13:
+        {
+            objectEntityType[objectNum] = (uint8_t)scriptEng.operands[operandNum];
+            ObjectSystem_MarkTempObject(objectNum);
+            break;
+        }
+        case 14:
+        {
+            objectEntityList[objectNum].propertyValue = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 15:
+        {
+            objectEntityXPos[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 16:
+        {
+            objectEntityYPos[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 17:
+        {
+            objectEntityXPos[objectNum] = scriptEng.operands[operandNum] << 16;
+            break;
+        }
+        case 18:
+        {
+            objectEntityYPos[objectNum] = scriptEng.operands[operandNum] << 16;
+            break;
+        }
+        case 19:
+        {
+            objectEntityList[objectNum].state = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 20:
+        {
+            objectEntityList[objectNum].rotation = scriptEng.operands[operandNum];
+            break;
+        }
+        case 21:
+        {
+            objectEntityList[objectNum].scale = scriptEng.operands[operandNum];
+            break;
+        }
+        case 22:
+        {
+            objectEntityPriority[objectNum] = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 23:
+        {
+            objectEntityDrawOrder[objectNum] = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 24:
+        {
+            objectEntityList[objectNum].direction = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 25:
+        {
+            objectEntityList[objectNum].inkEffect = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 26:
+        {
+            objectEntityList[objectNum].alpha = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 27:
+        {
+            objectEntityList[objectNum].frame = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 28:
+        {
+            objectEntityList[objectNum].animation = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 29:
+        {
+            objectEntityList[objectNum].prevAnimation = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 30:
+        {
+            objectEntityList[objectNum].animationSpeed = scriptEng.operands[operandNum];
+            break;
+        }
+        case 31:
+        {
+            objectEntityList[objectNum].animationTimer = scriptEng.operands[operandNum];
+            break;
+        }
+        case 32:
+        {
+            objectEntityList[objectNum].value[0] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 33:
+        {
+            objectEntityList[objectNum].value[1] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 34:
+        {
+            objectEntityList[objectNum].value[2] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 35:
+        {
+            objectEntityList[objectNum].value[3] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 36:
+        {
+            objectEntityList[objectNum].value[4] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 37:
+        {
+            objectEntityList[objectNum].value[5] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 38:
+        {
+            objectEntityList[objectNum].value[6] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 39:
+        {
+            objectEntityList[objectNum].value[7] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 41:
+        {
+            playerList[playerNum].objectPtr->state = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 42:
+        {
+            playerList[playerNum].controlMode = (signed char)scriptEng.operands[operandNum];
+            break;
+        }
+        case 43:
+        {
+            playerList[playerNum].controlLock = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 44:
+        {
+            playerList[playerNum].collisionMode = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 45:
+        {
+            playerList[playerNum].collisionPlane = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 46:
+        {
+            playerList[playerNum].xPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 47:
+        {
+            playerList[playerNum].yPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 48:
+        {
+            playerList[playerNum].xPos = scriptEng.operands[operandNum] << 16;
+            break;
+        }
+        case 49:
+        {
+            playerList[playerNum].yPos = scriptEng.operands[operandNum] << 16;
+            break;
+        }
+        case 50:
+        {
+            playerList[playerNum].screenXPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 51:
+        {
+            playerList[playerNum].screenYPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 52:
+        {
+            playerList[playerNum].speed = scriptEng.operands[operandNum];
+            break;
+        }
+        case 53:
+        {
+            playerList[playerNum].xVelocity = scriptEng.operands[operandNum];
+            break;
+        }
+        case 54:
+        {
+            playerList[playerNum].yVelocity = scriptEng.operands[operandNum];
+            break;
+        }
+        case 55:
+        {
+            playerList[playerNum].gravity = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 56:
+        {
+            playerList[playerNum].angle = scriptEng.operands[operandNum];
+            break;
+        }
+        case 57:
+        {
+            playerList[playerNum].skidding = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 58:
+        {
+            playerList[playerNum].pushing = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 59:
+        {
+            playerList[playerNum].trackScroll = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 60:
+        {
+            playerList[playerNum].up = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 61:
+        {
+            playerList[playerNum].down = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 62:
+        {
+            playerList[playerNum].left = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 63:
+        {
+            playerList[playerNum].right = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 64:
+        {
+            playerList[playerNum].jumpPress = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 65:
+        {
+            playerList[playerNum].jumpHold = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 66:
+        {
+            playerList[playerNum].followPlayer1 = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 67:
+        {
+            playerList[playerNum].lookPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 68:
+        {
+            playerList[playerNum].water = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 69:
+        {
+            playerList[playerNum].movementStats.topSpeed = scriptEng.operands[operandNum];
+            break;
+        }
+        case 70:
+        {
+            playerList[playerNum].movementStats.acceleration = scriptEng.operands[operandNum];
+            break;
+        }
+        case 71:
+        {
+            playerList[playerNum].movementStats.deceleration = scriptEng.operands[operandNum];
+            break;
+        }
+        case 72:
+        {
+            playerList[playerNum].movementStats.airAcceleration = scriptEng.operands[operandNum];
+            break;
+        }
+        case 73:
+        {
+            playerList[playerNum].movementStats.airDeceleration = scriptEng.operands[operandNum];
+            break;
+        }
+        case 74:
+        {
+            playerList[playerNum].movementStats.gravity = scriptEng.operands[operandNum];
+            break;
+        }
+        case 75:
+        {
+            playerList[playerNum].movementStats.jumpStrength = scriptEng.operands[operandNum];
+            break;
+        }
+        case 76:
+        {
+            playerList[playerNum].movementStats.jumpCap = scriptEng.operands[operandNum];
+            break;
+        }
+        case 77:
+        {
+            playerList[playerNum].movementStats.rollingAcceleration = scriptEng.operands[operandNum];
+            break;
+        }
+        case 78:
+        {
+            playerList[playerNum].movementStats.rollingDeceleration = scriptEng.operands[operandNum];
+            break;
+        }
+        case 84:
+        {
+            playerList[playerNum].flailing[objectNum] = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 85:
+        {
+            playerList[playerNum].timer = scriptEng.operands[operandNum];
+            break;
+        }
+        case 86:
+        {
+            playerList[playerNum].tileCollisions = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 87:
+        {
+            playerList[playerNum].objectInteraction = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 88:
+        {
+            playerList[playerNum].visible = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 89:
+        {
+            playerList[playerNum].objectPtr->rotation = scriptEng.operands[operandNum];
+            break;
+        }
+        case 90:
+        {
+            playerList[playerNum].objectPtr->scale = scriptEng.operands[operandNum];
+            break;
+        }
+        case 91:
+        {
+            objectEntityPriority[playerList[playerNum].objectPtr - objectEntityList] = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 92:
+        {
+            objectEntityDrawOrder[playerList[playerNum].objectPtr - objectEntityList] = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 93:
+        {
+            playerList[playerNum].objectPtr->direction = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 94:
+        {
+            playerList[playerNum].objectPtr->inkEffect = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 95:
+        {
+            playerList[playerNum].objectPtr->alpha = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 96:
+        {
+            playerList[playerNum].objectPtr->frame = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 97:
+        {
+            playerList[playerNum].objectPtr->animation = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 98:
+        {
+            playerList[playerNum].objectPtr->prevAnimation = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 99:
+        {
+            playerList[playerNum].objectPtr->animationSpeed = scriptEng.operands[operandNum];
+            break;
+        }
+        case 100:
+        {
+            playerList[playerNum].objectPtr->animationTimer = scriptEng.operands[operandNum];
+            break;
+        }
+        case 101:
+        {
+            playerList[playerNum].objectPtr->value[0] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 102:
+        {
+            playerList[playerNum].objectPtr->value[1] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 103:
+        {
+            playerList[playerNum].objectPtr->value[2] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 104:
+        {
+            playerList[playerNum].objectPtr->value[3] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 105:
+        {
+            playerList[playerNum].objectPtr->value[4] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 106:
+        {
+            playerList[playerNum].objectPtr->value[5] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 107:
+        {
+            playerList[playerNum].objectPtr->value[6] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 108:
+        {
+            playerList[playerNum].objectPtr->value[7] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 109:
+        {
+            playerList[playerNum].value[0] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 110:
+        {
+            playerList[playerNum].value[1] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 111:
+        {
+            playerList[playerNum].value[2] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 112:
+        {
+            playerList[playerNum].value[3] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 113:
+        {
+            playerList[playerNum].value[4] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 114:
+        {
+            playerList[playerNum].value[5] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 115:
+        {
+            playerList[playerNum].value[6] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 116:
+        {
+            playerList[playerNum].value[7] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 118:
+        {
+            stageMode = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 119:
+        {
+            activeStageList = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 120:
+        {
+            stageListPosition = scriptEng.operands[operandNum];
+            break;
+        }
+        case 121:
+        {
+            timeEnabled = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 122:
+        {
+            milliSeconds = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 123:
+        {
+            seconds = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 124:
+        {
+            minutes = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 125:
+        {
+            actNumber = scriptEng.operands[operandNum];
+            break;
+        }
+        case 126:
+        {
+            pauseEnabled = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 128:
+        {
+            newXBoundary1 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 129:
+        {
+            newXBoundary2 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 130:
+        {
+            newYBoundary1 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 131:
+        {
+            newYBoundary2 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 132:
+        {
+            if (xBoundary1 == scriptEng.operands[operandNum])
+            {
+                break;
+            }
+            xBoundary1 = scriptEng.operands[operandNum];
+            newXBoundary1 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 133:
+        {
+            if (xBoundary2 == scriptEng.operands[operandNum])
+            {
+                break;
+            }
+            xBoundary2 = scriptEng.operands[operandNum];
+            newXBoundary2 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 134:
+        {
+            if (yBoundary1 == scriptEng.operands[operandNum])
+            {
+                break;
+            }
+            yBoundary1 = scriptEng.operands[operandNum];
+            newYBoundary1 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 135:
+        {
+            if (yBoundary2 == scriptEng.operands[operandNum])
+            {
+                break;
+            }
+            yBoundary2 = scriptEng.operands[operandNum];
+            newYBoundary2 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 136:
+        {
+            bgDeformationData0[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 137:
+        {
+            bgDeformationData1[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 138:
+        {
+            bgDeformationData2[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 139:
+        {
+            bgDeformationData3[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 140:
+        {
+            waterLevel = scriptEng.operands[operandNum];
+            break;
+        }
+        case 141:
+        {
+            activeTileLayers[objectNum] = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 142:
+        {
+            tLayerMidPoint = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 143:
+        {
+            playerMenuNum = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 144:
         {
-            ObjectSystem_ProcessScript(objectScriptList[i].startupScript, objectScriptList[i].startupJumpTable, 3);
+            playerNum = scriptEng.operands[operandNum];
+            break;
         }
-        objectScriptList[i].numFrames = scriptFramesNo - objectScriptList[i].numFrames;
-    }
-    objectEntityList[0x420].type = objectEntityList[0x421].type;
-    objectEntityList[0x420].type = 0;
-}
-
-void ObjectSystem_SetObjectTypeName(char* typeName, int scriptNum)
-{
-    int length = 0;
-    int num = 0;
-    while (length < (int)strlen(typeName))
-    {
-        if (typeName[length] == 0)
+        case 145:
         {
-            length = (int)strlen(typeName);
+            cameraEnabled = (uint8_t)scriptEng.operands[operandNum];
+            break;
         }
-        else
+        case 146:
         {
-            if (typeName[length] != ' ')
+            cameraTarget = (signed char)scriptEng.operands[operandNum];
+            break;
+        }
+        case 147:
+        {
+            cameraStyle = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 148:
+        {
+            objectDrawOrderList[objectNum].listSize = scriptEng.operands[operandNum];
+            break;
+        }
+        case 153:
+        {
+            xScrollOffset = scriptEng.operands[operandNum];
+            xScrollA = xScrollOffset;
+            xScrollB = xScrollOffset + SCREEN_XSIZE;
+            break;
+        }
+        case 154:
+        {
+            yScrollOffset = scriptEng.operands[operandNum];
+            yScrollA = yScrollOffset;
+            yScrollB = yScrollOffset + 240;
+            break;
+        }
+        case 155:
+        {
+            screenShakeX = scriptEng.operands[operandNum];
+            break;
+        }
+        case 156:
+        {
+            screenShakeY = scriptEng.operands[operandNum];
+            break;
+        }
+        case 157:
+        {
+            cameraAdjustY = scriptEng.operands[operandNum];
+            break;
+        }
+        case 161:
+        {
+            AudioPlayback_SetMusicVolume(scriptEng.operands[operandNum]);
+            break;
+        }
+        case 163:
+        {
+            gKeyDown.up = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 164:
+        {
+            gKeyDown.down = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 165:
+        {
+            gKeyDown.left = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 166:
+        {
+            gKeyDown.right = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 167:
+        {
+            gKeyDown.buttonA = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 168:
+        {
+            gKeyDown.buttonB = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 169:
+        {
+            gKeyDown.buttonC = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 170:
+        {
+            gKeyDown.start = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 171:
+        {
+            gKeyPress.up = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 172:
+        {
+            gKeyPress.down = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 173:
+        {
+            gKeyPress.left = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 174:
+        {
+            gKeyPress.right = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 175:
+        {
+            gKeyPress.buttonA = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 176:
+        {
+            gKeyPress.buttonB = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 177:
+        {
+            gKeyPress.buttonC = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 178:
+        {
+            gKeyPress.start = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 179:
+        {
+            gameMenu[0].selection1 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 180:
+        {
+            gameMenu[1].selection1 = scriptEng.operands[operandNum];
+            break;
+        }
+        case 181:
+        {
+            stageLayouts[objectNum].xSize = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 182:
+        {
+            stageLayouts[objectNum].ySize = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 183:
+        {
+            stageLayouts[objectNum].type = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 184:
+        {
+            stageLayouts[objectNum].angle = scriptEng.operands[operandNum];
+            if (stageLayouts[objectNum].angle < 0)
             {
-                typeNames[scriptNum][num] = typeName[length];
-                num++;
+                struct LayoutMap* layoutMap = &stageLayouts[objectNum];
+                layoutMap->angle = layoutMap->angle + 0x200;
             }
-            length++;
+            struct LayoutMap* layoutMap1 = &stageLayouts[objectNum];
+            layoutMap1->angle = layoutMap1->angle & 0x1ff;
+            break;
+        }
+        case 185:
+        {
+            stageLayouts[objectNum].xPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 186:
+        {
+            stageLayouts[objectNum].yPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 187:
+        {
+            stageLayouts[objectNum].zPos = scriptEng.operands[operandNum];
+            break;
+        }
+        case 188:
+        {
+            stageLayouts[objectNum].parallaxFactor = scriptEng.operands[operandNum];
+            break;
+        }
+        case 189:
+        {
+            stageLayouts[objectNum].scrollSpeed = scriptEng.operands[operandNum];
+            break;
+        }
+        case 190:
+        {
+            stageLayouts[objectNum].scrollPosition = scriptEng.operands[operandNum];
+            break;
+        }
+        case 191:
+        {
+            stageLayouts[objectNum].deformationPos = scriptEng.operands[operandNum];
+            struct LayoutMap* layoutMap2 = &stageLayouts[objectNum];
+            layoutMap2->deformationPos = layoutMap2->deformationPos & 0xff;
+            break;
+        }
+        case 192:
+        {
+            stageLayouts[objectNum].deformationPosW = scriptEng.operands[operandNum];
+            struct LayoutMap* layoutMap3 = &stageLayouts[objectNum];
+            layoutMap3->deformationPosW = layoutMap3->deformationPosW & 0xff;
+            break;
+        }
+        case 193:
+        {
+            hParallax.parallaxFactor[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 194:
+        {
+            hParallax.scrollSpeed[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 195:
+        {
+            hParallax.scrollPosition[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 196:
+        {
+            vParallax.parallaxFactor[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 197:
+        {
+            vParallax.scrollSpeed[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 198:
+        {
+            vParallax.scrollPosition[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 199:
+        {
+            numVertices = scriptEng.operands[operandNum];
+            break;
+        }
+        case 200:
+        {
+            numFaces = scriptEng.operands[operandNum];
+            break;
+        }
+        case 201:
+        {
+            vertexBuffer[objectNum].x = scriptEng.operands[operandNum];
+            break;
+        }
+        case 202:
+        {
+            vertexBuffer[objectNum].y = scriptEng.operands[operandNum];
+            break;
+        }
+        case 203:
+        {
+            vertexBuffer[objectNum].z = scriptEng.operands[operandNum];
+            break;
+        }
+        case 204:
+        {
+            vertexBuffer[objectNum].u = scriptEng.operands[operandNum];
+            break;
+        }
+        case 205:
+        {
+            vertexBuffer[objectNum].v = scriptEng.operands[operandNum];
+            break;
+        }
+        case 206:
+        {
+            indexBuffer[objectNum].a = scriptEng.operands[operandNum];
+            break;
+        }
+        case 207:
+        {
+            indexBuffer[objectNum].b = scriptEng.operands[operandNum];
+            break;
+        }
+        case 208:
+        {
+            indexBuffer[objectNum].c = scriptEng.operands[operandNum];
+            break;
+        }
+        case 209:
+        {
+            indexBuffer[objectNum].d = scriptEng.operands[operandNum];
+            break;
+        }
+        case 210:
+        {
+            indexBuffer[objectNum].flag = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 211:
+        {
+            indexBuffer[objectNum].color = scriptEng.operands[operandNum];
+            break;
+        }
+        case 212:
+        {
+            projectionX = scriptEng.operands[operandNum];
+            break;
+        }
+        case 213:
+        {
+            projectionY = scriptEng.operands[operandNum];
+            break;
+        }
+        case 214:
+        {
+            gameMode = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 215:
+        {
+            debugMode = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 217:
+        {
+            saveRAM[objectNum] = scriptEng.operands[operandNum];
+            break;
+        }
+        case 218:
+        {
+            gameLanguage = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 219:
+        {
+            objectScriptList[objectEntityType[objectLoop]].surfaceNum = (uint8_t)scriptEng.operands[operandNum];
+            ObjectSystem_UpdateScriptQuads((int)objectEntityType[objectLoop]);
+            break;
+        }
+        case 221:
+        {
+            frameSkipTimer = scriptEng.operands[operandNum];
+            break;
+        }
+        case 222:
+        {
+            frameSkipSetting = scriptEng.operands[operandNum];
+            break;
+        }
+        case 223:
+        {
+            gameSFXVolume = scriptEng.operands[operandNum];
+            AudioPlayback_SetGameVolumes(gameBGMVolume, gameSFXVolume);
+            break;
+        }
+        case 224:
+        {
+            gameBGMVolume = scriptEng.operands[operandNum];
+            AudioPlayback_SetGameVolumes(gameBGMVolume, gameSFXVolume);
+            break;
+        }
+        case 227:
+        {
+            gKeyPress.start = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 228:
+        {
+            gameHapticsEnabled = (uint8_t)scriptEng.operands[operandNum];
+            break;
+        }
+        case 12:
+        case 40:
+        case 79:
+        case 80:
+        case 81:
+        case 82:
+        case 83:
+        case 117:
+        case 127:
+        case 149:
+        case 150:
+        case 151:
+        case 152:
+        case 158:
+        case 159:
+        case 160:
+        case 162:
+        case 216:
+        case 220:
+        case 225:
+        case 226:
+        default:
+        {
+            break;
         }
-    }
-    if (num < sizeof(typeNames[1]))
-    {
-        typeNames[scriptNum][num] = '\0';
     }
 }
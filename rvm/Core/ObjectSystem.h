@@ -30,39 +30,81 @@
 #include "GraphicsSystem.h"
 #include "TextSystem.h"
 #include "EngineCallbacks.h"
+#include "CompiledScriptModule.h"
+#include "ScriptSuperInstruction.h"
+#include "ScriptNGram.h"
+#include "ScriptStageProfile.h"
+#include "EngineContext.h"
 
-extern int scriptData[0x40000];
-extern int scriptDataPos;
-extern int scriptDataOffset;
-extern int scriptLineNumber;
-extern int jumpTableData[0x4000];
-extern int jumpTableDataPos;
-extern int jumpTableOffset;
-extern int jumpTableStack[0x400];
-extern int jumpTableStackPos;
-extern int NUM_FUNCTIONS;
-extern int functionStack[0x400];
-extern int functionStackPos;
-extern struct SpriteFrame scriptFrames[0x1000];
-extern int scriptFramesNo;
-extern uint8_t NO_GLOBALVARIABLES;
-extern char globalVariableNames[0x100][32];
-extern int globalVariables[0x100];
-extern int objectLoop;
-extern struct ScriptEngine scriptEng;
-extern char scriptText[0x100];
-extern struct ObjectScript objectScriptList[0x100];
-extern struct FunctionScript functionScriptList[0x200];
-extern struct ObjectEntity objectEntityList[0x4A0];
-extern struct ObjectDrawList objectDrawOrderList[7];
-extern int playerNum;
+#define TEMP_OBJECT_START 0x420
+#define TEMP_OBJECT_COUNT 0x80
+#define COMPILED_SCRIPT_TABLE_SIZE 0x1000
+#define SUPERINSTRUCTION_OPCODE 0x100
+#define SUPERINSTRUCTION_COUNT 0x20
+#define SUPERINSTRUCTION_LENGTH 3
+#define SUPERINSTRUCTION_SITES 0x4000
+#define SCRIPT_NGRAM_TABLE_SIZE 0x2000
+#define SCRIPT_STAGE_PROFILES 0x40
+
+extern ENGINE_STATE int scriptDataPos;
+extern ENGINE_STATE int scriptDataOffset;
+extern ENGINE_STATE int scriptLineNumber;
+extern ENGINE_STATE int jumpTableDataPos;
+extern ENGINE_STATE int jumpTableOffset;
+extern ENGINE_STATE int jumpTableStackPos;
+extern ENGINE_STATE int NUM_FUNCTIONS;
+extern ENGINE_STATE int functionStackPos;
+extern ENGINE_STATE int scriptFramesNo;
+extern ENGINE_STATE uint8_t NO_GLOBALVARIABLES;
+extern ENGINE_STATE int objectLoop;
+extern ENGINE_STATE struct ScriptEngine scriptEng;
+extern ENGINE_STATE bool objectDrawnInWorld;
+extern ENGINE_STATE int playerNum;
+extern ENGINE_STATE uint32_t randomState;
+extern ENGINE_STATE bool objectBroadphase;
+extern ENGINE_STATE unsigned int playerScriptCalls;
+extern ENGINE_STATE unsigned int playerScriptSkips;
+extern ENGINE_STATE int tempObjectPoolSize;
+extern ENGINE_STATE uint32_t tempObjectFreeMap[TEMP_OBJECT_COUNT >> 5];
+extern ENGINE_STATE int tempObjectFreeCount;
+extern ENGINE_STATE int tempObjectPeak;
+extern ENGINE_STATE unsigned int tempObjectEvictions;
+extern ENGINE_STATE bool compiledScriptsEnabled;
+extern ENGINE_STATE const struct CompiledScriptModule* compiledScriptModule;
+extern const struct CompiledScriptModule* const compiledScriptModules[];
+extern const int numCompiledScriptModules;
+extern ENGINE_STATE struct ScriptSuperInstruction superInstructions[SUPERINSTRUCTION_COUNT];
+extern ENGINE_STATE int numSuperInstructions;
+extern ENGINE_STATE int numSuperInstructionSites;
+extern ENGINE_STATE bool scriptProfileEnabled;
+extern ENGINE_STATE int numScriptNGrams;
+extern ENGINE_STATE int scriptProfileHistory[2];
+extern ENGINE_STATE int scriptProfileHistoryLength;
+extern ENGINE_STATE int scriptProfileNext;
+extern ENGINE_STATE unsigned int scriptInstructionCount;
+extern ENGINE_STATE unsigned int scriptDispatchCount;
+extern ENGINE_STATE int numScriptStageProfiles;
 
 void Init_ObjectSystem(void);
+int ObjectSystem_AllocTempObject(void);
 void ObjectSystem_BasicCollision(int cLeft, int cTop, int cRight, int cBottom);
+void ObjectSystem_BindCompiledScripts(void);
 void ObjectSystem_BoxCollision(int cLeft, int cTop, int cRight, int cBottom);
+int ObjectSystem_CallFunctionScript(int functionNum, int scriptSub);
 void ObjectSystem_ClearScriptData(void);
+void ObjectSystem_CountNGram(uint32_t key);
 void ObjectSystem_DrawObjectList(int DrawListNo);
+int ObjectSystem_ExecuteOpcode(int opcode, int scriptSub);
+CompiledScript ObjectSystem_FindCompiledScript(int scriptCodePtr, int jumpTablePtr);
+int ObjectSystem_FindFreeTempObject(int slot);
+void ObjectSystem_FuseScript(int scriptCodePtr);
+void ObjectSystem_FuseSuperInstructions(void);
+int ObjectSystem_GetOpcode(int scriptCodePtr);
+void ObjectSystem_InferInteractionBounds(int scriptNum);
 void ObjectSystem_LoadByteCodeFile(int fileType, int scriptNum);
+bool ObjectSystem_LoadSuperInstructions(const char* filePath);
+void ObjectSystem_MarkTempObject(int objectNum);
+bool ObjectSystem_MatchSuperInstruction(int superNum, int scriptCodePtr, int scriptEnd);
 void ObjectSystem_ObjectFloorCollision(int xOffset, int yOffset, int cPlane);
 void ObjectSystem_ObjectFloorGrip(int xOffset, int yOffset, int cPlane);
 void ObjectSystem_ObjectLWallCollision(int xOffset, int yOffset, int cPlane);
@@ -72,10 +114,27 @@ void ObjectSystem_ObjectRoofGrip(int xOffset, int yOffset, int cPlane);
 void ObjectSystem_ObjectRWallCollision(int xOffset, int yOffset, int cPlane);
 void ObjectSystem_ObjectRWallGrip(int xOffset, int yOffset, int cPlane);
 void ObjectSystem_PlatformCollision(int cLeft, int cTop, int cRight, int cBottom);
+bool ObjectSystem_PlayerInInteractionBounds(struct ObjectScript* objectScript, struct PlayerObject* playerO);
 void ObjectSystem_ProcessObjects(void);
 void ObjectSystem_ProcessPausedObjects(void);
 void ObjectSystem_ProcessScript(int scriptCodePtr, int jumpTablePtr, int scriptSub);
 void ObjectSystem_ProcessStartupScripts(void);
+void ObjectSystem_ProfileInstruction(int opcode, int scriptCodePtr);
+int ObjectSystem_Random(void);
+void ObjectSystem_ReadScriptVariable(int variableNum, int objectNum, int operandNum);
+void ObjectSystem_ResetTempObjects(void);
+int ObjectSystem_RunScript(int scriptCodePtr, int jumpTablePtr, int scriptStart, int scriptSub);
+int ObjectSystem_RunSuperInstruction(int superNum, int scriptCodePtr, int jumpTablePtr, int scriptStart, int scriptSub);
+void ObjectSystem_UpdateScriptQuads(int scriptNum);
+void ObjectSystem_UpdateSpriteQuads(void);
+void ObjectSystem_SetInteractionBounds(int scriptNum, int cType, int cLeft, int cTop, int cRight, int cBottom);
 void ObjectSystem_SetObjectTypeName(char* typeName, int scriptNum);
+void ObjectSystem_SetRandomSeed(uint32_t seed);
+void ObjectSystem_SetTempObjectPoolSize(int poolSize);
+int ObjectSystem_SkipInstruction(int scriptCodePtr);
+void ObjectSystem_StartScriptProfileStage(void);
+bool ObjectSystem_SuperInstructionAllowed(const uint8_t* opcodes, int length);
+void ObjectSystem_WriteScriptProfile(const char* filePath);
+void ObjectSystem_WriteScriptVariable(int variableNum, int objectNum, int operandNum);
 
 #endif /* ObjectSystem_h */
@@ -0,0 +1,20 @@
+//
+//  PlayerHitbox.h
+//  rvm
+//
+
+#ifndef PlayerHitbox_h
+#define PlayerHitbox_h
+
+#include "AnimationFileList.h"
+#include "CollisionBox.h"
+
+struct PlayerHitbox {
+    struct AnimationFileList* animationFile;
+    int animation;
+    int frame;
+    int dataVersion;
+    struct CollisionBox* collisionBox;
+};
+
+#endif /* PlayerHitbox_h */
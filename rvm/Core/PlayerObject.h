@@ -10,6 +10,7 @@
 #include "PlayerStatistics.h"
 #include "AnimationFileList.h"
 #include "ObjectEntity.h"
+#include "PlayerHitbox.h"
 
 struct PlayerObject {
     int objectNum;
@@ -47,6 +48,7 @@ struct PlayerObject {
     uint8_t flailing[3];
     struct AnimationFileList* animationFile;
     struct ObjectEntity* objectPtr;
+    struct PlayerHitbox hitbox;
 };
 
 #endif /* PlayerObject_h */
@@ -4,22 +4,22 @@
 //
 
 #include "PlayerSystem.h"
+#include "EngineBuffers.h"
 
-unsigned short delayLeft;
-unsigned short delayRight;
-unsigned short delayUp;
-unsigned short delayDown;
-unsigned short delayJumpPress;
-unsigned short delayJumpHold;
-unsigned char jumpWait;
-unsigned char numActivePlayers;
-unsigned char playerMenuNum;
-struct PlayerObject playerList[2];
-struct CollisionSensor player_cSensor[6];
-int collisionLeft;
-int collisionTop;
-int collisionRight;
-int collisionBottom;
+ENGINE_STATE unsigned short delayLeft;
+ENGINE_STATE unsigned short delayRight;
+ENGINE_STATE unsigned short delayUp;
+ENGINE_STATE unsigned short delayDown;
+ENGINE_STATE unsigned short delayJumpPress;
+ENGINE_STATE unsigned short delayJumpHold;
+ENGINE_STATE unsigned char jumpWait;
+ENGINE_STATE unsigned char numActivePlayers;
+ENGINE_STATE unsigned char playerMenuNum;
+ENGINE_STATE struct CollisionSensor player_cSensor[6];
+ENGINE_STATE int collisionLeft;
+ENGINE_STATE int collisionTop;
+ENGINE_STATE int collisionRight;
+ENGINE_STATE int collisionBottom;
 
 void Init_PlayerSystem()
 {
@@ -27,107 +27,76 @@ void Init_PlayerSystem()
     playerMenuNum = 0;
 }
 
-void PlayerSystem_FindFloorPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos)
+void PlayerSystem_FindFloorPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->angle;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int prevCollisionPos[SENSOR_BATCH_LIMIT];
+    int startAngle[SENSOR_BATCH_LIMIT];
+    uint8_t aborted[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        prevCollisionPos[s] = sensors[s].yPos >> 16;
+        startAngle[s] = sensors[s].angle;
+        aborted[s] = 0;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
+        {
+            probes[s].xPos = sensors[s].xPos >> 16;
+            probes[s].yPos = (sensors[s].yPos >> 16) - 16 + i;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_FLOOR);
+        for (int s = 0; s < count; s++)
         {
-            int num2 = cSensorRef->xPos >> 16;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = (cSensorRef->yPos >> 16) - 16 + i;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startAngle[s];
+            if (cSensorRef->collided == 0 && aborted[s] == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] != 2 && tile128x128.collisionFlag[playerO->collisionPlane][num8] != 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num6 = num5 >> 7;
+                int num7 = (num5 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag != 2 && probes[s].cFlag != 3)
                     {
-                        case 0:
+                        if (probes[s].mask < 64)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].floorMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
+                            cSensorRef->yPos = probes[s].mask + (num6 << 7) + (num7 << 4);
                             cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(tileCollisions[playerO->collisionPlane].angle[num9] & 0xff);
-                            break;
+                            cSensorRef->angle = probes[s].angle;
                         }
-                        case 1:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->angle < 0)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].floorMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (tileCollisions[playerO->collisionPlane].angle[num9] & 0xff));
-                            break;
+                            struct CollisionSensor* collisionSensor = cSensorRef;
+                            collisionSensor->angle = collisionSensor->angle + 0x100;
                         }
-                        case 2:
+                        if (cSensorRef->angle > 0xff)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].roofMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24) & 0xff);
-                            break;
+                            struct CollisionSensor* collisionSensor1 = cSensorRef;
+                            collisionSensor1->angle = collisionSensor1->angle - 0x100;
                         }
-                        case 3:
+                        if ((abs(cSensorRef->angle - num1) > 32) && (abs(cSensorRef->angle - 0x100 - num1) > 32) && (abs(cSensorRef->angle + 0x100 - num1) > 32))
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].roofMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24) & 0xff));
-                            break;
+                            cSensorRef->yPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
+                            cSensorRef->angle = num1;
+                            aborted[s] = 1;
+                        }
+                        else if (cSensorRef->yPos - prevCollisionPos[s] > 14)
+                        {
+                            cSensorRef->yPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
+                        }
+                        else if (cSensorRef->yPos - prevCollisionPos[s] < -14)
+                        {
+                            cSensorRef->yPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
                         }
-                    }
-                }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->angle < 0)
-                    {
-                        struct CollisionSensor* collisionSensor = cSensorRef;
-                        collisionSensor->angle = collisionSensor->angle + 0x100;
-                    }
-                    if (cSensorRef->angle > 0xff)
-                    {
-                        struct CollisionSensor* collisionSensor1 = cSensorRef;
-                        collisionSensor1->angle = collisionSensor1->angle - 0x100;
-                    }
-                    if ((abs(cSensorRef->angle - num1) > 32) && (abs(cSensorRef->angle - 0x100 - num1) > 32) && (abs(cSensorRef->angle + 0x100 - num1) > 32))
-                    {
-                        cSensorRef->yPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
-                        cSensorRef->angle = num1;
-                        i = 48;
-                    }
-                    else if (cSensorRef->yPos - prevCollisionPos > 14)
-                    {
-                        cSensorRef->yPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->yPos - prevCollisionPos < -14)
-                    {
-                        cSensorRef->yPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
                     }
                 }
             }
@@ -135,107 +104,76 @@ void PlayerSystem_FindFloorPosition(struct PlayerObject* playerO, struct Collisi
     }
 }
 
-void PlayerSystem_FindLWallPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos)
+void PlayerSystem_FindLWallPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->angle;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int prevCollisionPos[SENSOR_BATCH_LIMIT];
+    int startAngle[SENSOR_BATCH_LIMIT];
+    uint8_t aborted[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        prevCollisionPos[s] = sensors[s].xPos >> 16;
+        startAngle[s] = sensors[s].angle;
+        aborted[s] = 0;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
+        {
+            probes[s].xPos = (sensors[s].xPos >> 16) - 16 + i;
+            probes[s].yPos = sensors[s].yPos >> 16;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_LWALL);
+        for (int s = 0; s < count; s++)
         {
-            int num2 = (cSensorRef->xPos >> 16) - 16 + i;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = cSensorRef->yPos >> 16;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startAngle[s];
+            if (cSensorRef->collided == 0 && aborted[s] == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] < 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num3 = num2 >> 7;
+                int num4 = (num2 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag < 3)
                     {
-                        case 0:
+                        if (probes[s].mask < 64)
                         {
-                            num = (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].leftWallMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
+                            cSensorRef->xPos = probes[s].mask + (num3 << 7) + (num4 << 4);
                             cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff00) >> 8);
-                            break;
+                            cSensorRef->angle = probes[s].angle;
                         }
-                        case 1:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->angle < 0)
                         {
-                            num = (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].rightWallMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - ((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff0000) >> 16));
-                            break;
+                            struct CollisionSensor* collisionSensor = cSensorRef;
+                            collisionSensor->angle = collisionSensor->angle + 0x100;
                         }
-                        case 2:
+                        if (cSensorRef->angle > 0xff)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].leftWallMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff00) >> 8) & 0xff);
-                            break;
+                            struct CollisionSensor* collisionSensor1 = cSensorRef;
+                            collisionSensor1->angle = collisionSensor1->angle - 0x100;
                         }
-                        case 3:
+                        if (abs(num1 - cSensorRef->angle) > 32)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].rightWallMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff0000) >> 16) & 0xff));
-                            break;
+                            cSensorRef->xPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
+                            cSensorRef->angle = num1;
+                            aborted[s] = 1;
+                        }
+                        else if (cSensorRef->xPos - prevCollisionPos[s] > 14)
+                        {
+                            cSensorRef->xPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
+                        }
+                        else if (cSensorRef->xPos - prevCollisionPos[s] < -14)
+                        {
+                            cSensorRef->xPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
                         }
-                    }
-                }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->angle < 0)
-                    {
-                        struct CollisionSensor* collisionSensor = cSensorRef;
-                        collisionSensor->angle = collisionSensor->angle + 0x100;
-                    }
-                    if (cSensorRef->angle > 0xff)
-                    {
-                        struct CollisionSensor* collisionSensor1 = cSensorRef;
-                        collisionSensor1->angle = collisionSensor1->angle - 0x100;
-                    }
-                    if (abs(num1 - cSensorRef->angle) > 32)
-                    {
-                        cSensorRef->xPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
-                        cSensorRef->angle = num1;
-                        i = 48;
-                    }
-                    else if (cSensorRef->xPos - prevCollisionPos > 14)
-                    {
-                        cSensorRef->xPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->xPos - prevCollisionPos < -14)
-                    {
-                        cSensorRef->xPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
                     }
                 }
             }
@@ -243,218 +181,156 @@ void PlayerSystem_FindLWallPosition(struct PlayerObject* playerO, struct Collisi
     }
 }
 
-void PlayerSystem_FindRoofPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos)
+void PlayerSystem_FindRoofPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->angle;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int prevCollisionPos[SENSOR_BATCH_LIMIT];
+    int startAngle[SENSOR_BATCH_LIMIT];
+    uint8_t aborted[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        prevCollisionPos[s] = sensors[s].yPos >> 16;
+        startAngle[s] = sensors[s].angle;
+        aborted[s] = 0;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
+        {
+            probes[s].xPos = sensors[s].xPos >> 16;
+            probes[s].yPos = (sensors[s].yPos >> 16) + 16 - i;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_ROOF);
+        for (int s = 0; s < count; s++)
         {
-            int num2 = cSensorRef->xPos >> 16;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = (cSensorRef->yPos >> 16) + 16 - i;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startAngle[s];
+            if (cSensorRef->collided == 0 && aborted[s] == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] < 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num6 = num5 >> 7;
+                int num7 = (num5 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag < 3)
                     {
-                        case 0:
+                        if (probes[s].mask > -64)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].roofMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
+                            cSensorRef->yPos = probes[s].mask + (num6 << 7) + (num7 << 4);
                             cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24);
-                            break;
+                            cSensorRef->angle = probes[s].angle;
                         }
-                        case 1:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->angle < 0)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].roofMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - ((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24));
-                            break;
+                            struct CollisionSensor* collisionSensor = cSensorRef;
+                            collisionSensor->angle = collisionSensor->angle + 0x100;
                         }
-                        case 2:
+                        if (cSensorRef->angle > 0xff)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].floorMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x180 - (tileCollisions[playerO->collisionPlane].angle[num9] & 0xff) & 0xff);
-                            break;
+                            struct CollisionSensor* collisionSensor1 = cSensorRef;
+                            collisionSensor1->angle = collisionSensor1->angle - 0x100;
                         }
-                        case 3:
+                        if (abs(cSensorRef->angle - num1) <= 32)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].floorMask[num] >= 64)
+                            if (cSensorRef->yPos - prevCollisionPos[s] > 15)
                             {
-                                break;
+                                cSensorRef->yPos = prevCollisionPos[s] << 16;
+                                cSensorRef->collided = 0;
+                            }
+                            if (cSensorRef->yPos - prevCollisionPos[s] < -15)
+                            {
+                                cSensorRef->yPos = prevCollisionPos[s] << 16;
+                                cSensorRef->collided = 0;
                             }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (0x180 - (tileCollisions[playerO->collisionPlane].angle[num9] & 0xff) & 0xff));
-                            break;
-                        }
-                    }
-                }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->angle < 0)
-                    {
-                        struct CollisionSensor* collisionSensor = cSensorRef;
-                        collisionSensor->angle = collisionSensor->angle + 0x100;
-                    }
-                    if (cSensorRef->angle > 0xff)
-                    {
-                        struct CollisionSensor* collisionSensor1 = cSensorRef;
-                        collisionSensor1->angle = collisionSensor1->angle - 0x100;
-                    }
-                    if (abs(cSensorRef->angle - num1) <= 32)
-                    {
-                        if (cSensorRef->yPos - prevCollisionPos > 15)
-                        {
-                            cSensorRef->yPos = prevCollisionPos << 16;
-                            cSensorRef->collided = 0;
                         }
-                        if (cSensorRef->yPos - prevCollisionPos < -15)
+                        else
                         {
-                            cSensorRef->yPos = prevCollisionPos << 16;
+                            cSensorRef->yPos = prevCollisionPos[s] << 16;
                             cSensorRef->collided = 0;
+                            cSensorRef->angle = num1;
+                            aborted[s] = 1;
                         }
                     }
-                    else
-                    {
-                        cSensorRef->yPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
-                        cSensorRef->angle = num1;
-                        i = 48;
-                    }
                 }
             }
         }
     }
 }
 
-void PlayerSystem_FindRWallPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos)
+void PlayerSystem_FindRWallPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->angle;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int prevCollisionPos[SENSOR_BATCH_LIMIT];
+    int startAngle[SENSOR_BATCH_LIMIT];
+    uint8_t aborted[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        prevCollisionPos[s] = sensors[s].xPos >> 16;
+        startAngle[s] = sensors[s].angle;
+        aborted[s] = 0;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
+        {
+            probes[s].xPos = (sensors[s].xPos >> 16) + 16 - i;
+            probes[s].yPos = sensors[s].yPos >> 16;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_RWALL);
+        for (int s = 0; s < count; s++)
         {
-            int num2 = (cSensorRef->xPos >> 16) + 16 - i;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = cSensorRef->yPos >> 16;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startAngle[s];
+            if (cSensorRef->collided == 0 && aborted[s] == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] < 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num3 = num2 >> 7;
+                int num4 = (num2 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag < 3)
                     {
-                        case 0:
+                        if (probes[s].mask > -64)
                         {
-                            num = (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].rightWallMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
+                            cSensorRef->xPos = probes[s].mask + (num3 << 7) + (num4 << 4);
                             cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff0000) >> 16);
-                            break;
+                            cSensorRef->angle = probes[s].angle;
                         }
-                        case 1:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->angle < 0)
                         {
-                            num = (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].leftWallMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - ((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff00) >> 8));
-                            break;
+                            struct CollisionSensor* collisionSensor = cSensorRef;
+                            collisionSensor->angle = collisionSensor->angle + 0x100;
                         }
-                        case 2:
+                        if (cSensorRef->angle > 0xff)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].rightWallMask[num] <= -64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff0000) >> 16) & 0xff);
-                            break;
+                            struct CollisionSensor* collisionSensor1 = cSensorRef;
+                            collisionSensor1->angle = collisionSensor1->angle - 0x100;
                         }
-                        case 3:
+                        if (abs(cSensorRef->angle - num1) > 32)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if (tileCollisions[playerO->collisionPlane].leftWallMask[num] >= 64)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & 0xff00) >> 8) & 0xff));
-                            break;
+                            cSensorRef->xPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
+                            cSensorRef->angle = num1;
+                            aborted[s] = 1;
+                        }
+                        else if (cSensorRef->xPos - prevCollisionPos[s] > 14)
+                        {
+                            cSensorRef->xPos = prevCollisionPos[s] >> 16;
+                            cSensorRef->collided = 0;
+                        }
+                        else if (cSensorRef->xPos - prevCollisionPos[s] < -14)
+                        {
+                            cSensorRef->xPos = prevCollisionPos[s] << 16;
+                            cSensorRef->collided = 0;
                         }
-                    }
-                }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->angle < 0)
-                    {
-                        struct CollisionSensor* collisionSensor = cSensorRef;
-                        collisionSensor->angle = collisionSensor->angle + 0x100;
-                    }
-                    if (cSensorRef->angle > 0xff)
-                    {
-                        struct CollisionSensor* collisionSensor1 = cSensorRef;
-                        collisionSensor1->angle = collisionSensor1->angle - 0x100;
-                    }
-                    if (abs(cSensorRef->angle - num1) > 32)
-                    {
-                        cSensorRef->xPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
-                        cSensorRef->angle = num1;
-                        i = 48;
-                    }
-                    else if (cSensorRef->xPos - prevCollisionPos > 14)
-                    {
-                        cSensorRef->xPos = prevCollisionPos >> 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->xPos - prevCollisionPos < -14)
-                    {
-                        cSensorRef->xPos = prevCollisionPos << 16;
-                        cSensorRef->collided = 0;
                     }
                 }
             }
@@ -462,100 +338,81 @@ void PlayerSystem_FindRWallPosition(struct PlayerObject* playerO, struct Collisi
     }
 }
 
-void PlayerSystem_FloorCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef)
+struct CollisionBox* PlayerSystem_GetCollisionBox(struct PlayerObject* playerO)
 {
-    int num;
-    int num1 = cSensorRef->yPos >> 16;
+    //The box only changes with the animation frame, so skip the table walk while that stays the same
+    struct PlayerHitbox* hitbox = &playerO->hitbox;
+    if (hitbox->collisionBox == NULL || hitbox->animationFile != playerO->animationFile || hitbox->animation != playerO->objectPtr->animation || hitbox->frame != playerO->objectPtr->frame || hitbox->dataVersion != animationDataVersion)
+    {
+        hitbox->animationFile = playerO->animationFile;
+        hitbox->animation = playerO->objectPtr->animation;
+        hitbox->frame = playerO->objectPtr->frame;
+        hitbox->dataVersion = animationDataVersion;
+        hitbox->collisionBox = &collisionBoxList[playerO->animationFile->cbListOffset + animationFrames[animationList[playerO->animationFile->aniListOffset + playerO->objectPtr->animation].frameListOffset + playerO->objectPtr->frame].collisionBox];
+    }
+    return hitbox->collisionBox;
+}
+
+void PlayerSystem_FloorCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
+{
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int startPos[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        startPos[s] = sensors[s].yPos >> 16;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
+        {
+            probes[s].xPos = sensors[s].xPos >> 16;
+            probes[s].yPos = (sensors[s].yPos >> 16) - 16 + i;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_FLOOR);
+        for (int s = 0; s < count; s++)
         {
-            int num2 = cSensorRef->xPos >> 16;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = (cSensorRef->yPos >> 16) - 16 + i;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startPos[s];
+            if (cSensorRef->collided == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] != 2 && tile128x128.collisionFlag[playerO->collisionPlane][num8] != 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num6 = num5 >> 7;
+                int num7 = (num5 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag != 2 && probes[s].cFlag != 3)
                     {
-                        case 0:
+                        //Only tiles that aren't flipped vertically skip a surface on their bottom row
+                        if ((num5 & 15) > probes[s].mask - 16 + i && (probes[s].mask < 15 || (probes[s].tile & 2)))
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) <= tileCollisions[playerO->collisionPlane].floorMask[num] - 16 + i || tileCollisions[playerO->collisionPlane].floorMask[num] >= 15)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
+                            cSensorRef->yPos = probes[s].mask + (num6 << 7) + (num7 << 4);
                             cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(tileCollisions[playerO->collisionPlane].angle[num9] & 0xff);
-                            break;
+                            cSensorRef->angle = probes[s].angle;
                         }
-                        case 1:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->angle < 0)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) <= tileCollisions[playerO->collisionPlane].floorMask[num] - 16 + i || tileCollisions[playerO->collisionPlane].floorMask[num] >= 15)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (tileCollisions[playerO->collisionPlane].angle[num9] & 0xff));
-                            break;
+                            struct CollisionSensor* collisionSensor = cSensorRef;
+                            collisionSensor->angle = collisionSensor->angle + 0x100;
                         }
-                        case 2:
+                        if (cSensorRef->angle > 0xff)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) <= 15 - tileCollisions[playerO->collisionPlane].roofMask[num] - 16 + i)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24) & 0xff);
-                            break;
+                            struct CollisionSensor* collisionSensor1 = cSensorRef;
+                            collisionSensor1->angle = collisionSensor1->angle - 0x100;
                         }
-                        case 3:
+                        if (cSensorRef->yPos - num1 > 14)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) <= 15 - tileCollisions[playerO->collisionPlane].roofMask[num] - 16 + i)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (0x180 - ((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24) & 0xff));
-                            break;
+                            cSensorRef->yPos = num1 << 16;
+                            cSensorRef->collided = 0;
+                        }
+                        else if (cSensorRef->yPos - num1 < -17)
+                        {
+                            cSensorRef->yPos = num1 << 16;
+                            cSensorRef->collided = 0;
                         }
-                    }
-                }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->angle < 0)
-                    {
-                        struct CollisionSensor* collisionSensor = cSensorRef;
-                        collisionSensor->angle = collisionSensor->angle + 0x100;
-                    }
-                    if (cSensorRef->angle > 0xff)
-                    {
-                        struct CollisionSensor* collisionSensor1 = cSensorRef;
-                        collisionSensor1->angle = collisionSensor1->angle - 0x100;
-                    }
-                    if (cSensorRef->yPos - num1 > 14)
-                    {
-                        cSensorRef->yPos = num1 << 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->yPos - num1 < -17)
-                    {
-                        cSensorRef->yPos = num1 << 16;
-                        cSensorRef->collided = 0;
                     }
                 }
             }
@@ -563,88 +420,56 @@ void PlayerSystem_FloorCollision(struct PlayerObject* playerO, struct CollisionS
     }
 }
 
-void PlayerSystem_LWallCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef)
+void PlayerSystem_LWallCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->xPos >> 16;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int startPos[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        startPos[s] = sensors[s].xPos >> 16;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
+        {
+            probes[s].xPos = (sensors[s].xPos >> 16) - 16 + i;
+            probes[s].yPos = sensors[s].yPos >> 16;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_LWALL);
+        for (int s = 0; s < count; s++)
         {
-            int num2 = (cSensorRef->xPos >> 16) - 16 + i;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = cSensorRef->yPos >> 16;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startPos[s];
+            if (cSensorRef->collided == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] != 1 && tile128x128.collisionFlag[playerO->collisionPlane][num8] < 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num3 = num2 >> 7;
+                int num4 = (num2 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag != 1 && probes[s].cFlag < 3)
                     {
-                        case 0:
+                        if ((num2 & 15) > probes[s].mask - 16 + i)
                         {
-                            num = (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) <= tileCollisions[playerO->collisionPlane].leftWallMask[num] - 16 + i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            break;
-                        }
-                        case 1:
-                        {
-                            num = (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) <= 15 - tileCollisions[playerO->collisionPlane].rightWallMask[num] - 16 + i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
+                            cSensorRef->xPos = probes[s].mask + (num3 << 7) + (num4 << 4);
                             cSensorRef->collided = 1;
-                            break;
                         }
-                        case 2:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->xPos - num1 > 15)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) <= tileCollisions[playerO->collisionPlane].leftWallMask[num] - 16 + i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            break;
+                            cSensorRef->xPos = num1 << 16;
+                            cSensorRef->collided = 0;
                         }
-                        case 3:
+                        else if (cSensorRef->xPos - num1 < -15)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) <= 15 - tileCollisions[playerO->collisionPlane].rightWallMask[num] - 16 + i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            break;
+                            cSensorRef->xPos = num1 << 16;
+                            cSensorRef->collided = 0;
                         }
                     }
                 }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->xPos - num1 > 15)
-                    {
-                        cSensorRef->xPos = num1 << 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->xPos - num1 < -15)
-                    {
-                        cSensorRef->xPos = num1 << 16;
-                        cSensorRef->collided = 0;
-                    }
-                }
             }
         }
     }
@@ -657,7 +482,7 @@ void PlayerSystem_ProcessAirCollision(struct PlayerObject* playerO)
     uint8_t num1;
     uint8_t num2;
     uint8_t num3;
-    struct CollisionBox* collisionBox = &collisionBoxList[playerO->animationFile->cbListOffset + animationFrames[animationList[playerO->animationFile->aniListOffset + playerO->objectPtr->animation].frameListOffset + playerO->objectPtr->frame].collisionBox];
+    struct CollisionBox* collisionBox = PlayerSystem_GetCollisionBox(playerO);
     collisionLeft = collisionBox->left[0];
     collisionTop = collisionBox->top[0];
     collisionRight = collisionBox->right[0];
@@ -724,7 +549,7 @@ void PlayerSystem_ProcessAirCollision(struct PlayerObject* playerO)
             collisionSensor->xPos = collisionSensor->xPos + num5 + 0x10000;
             struct CollisionSensor*  collisionSensor1 = &player_cSensor[0];
             collisionSensor1->yPos = collisionSensor1->yPos + num6;
-            PlayerSystem_LWallCollision(playerO, &player_cSensor[0]);
+            PlayerSystem_LWallCollision(playerO, &player_cSensor[0], 1);
             if (player_cSensor[0].collided == 1)
             {
                 num1 = 2;
@@ -736,7 +561,7 @@ void PlayerSystem_ProcessAirCollision(struct PlayerObject* playerO)
             collisionSensor2->xPos = collisionSensor2->xPos + (num5 - 0x10000);
             struct CollisionSensor* collisionSensor3 = &player_cSensor[1];
             collisionSensor3->yPos = collisionSensor3->yPos + num6;
-            PlayerSystem_RWallCollision(playerO, &player_cSensor[1]);
+            PlayerSystem_RWallCollision(playerO, &player_cSensor[1], 1);
             if (player_cSensor[1].collided == 1)
             {
                 num2 = 2;
@@ -778,9 +603,9 @@ void PlayerSystem_ProcessAirCollision(struct PlayerObject* playerO)
                     collisionSensor4->xPos = collisionSensor4->xPos + num5;
                     struct CollisionSensor* collisionSensor5 = &player_cSensor[i];
                     collisionSensor5->yPos = collisionSensor5->yPos + num6;
-                    PlayerSystem_FloorCollision(playerO, &player_cSensor[i]);
                 }
             }
+            PlayerSystem_FloorCollision(playerO, &player_cSensor[2], 2);
             if (player_cSensor[2].collided == 1 | player_cSensor[3].collided == 1)
             {
                 num3 = 2;
@@ -799,9 +624,9 @@ void PlayerSystem_ProcessAirCollision(struct PlayerObject* playerO)
                 collisionSensor6->xPos = collisionSensor6->xPos + num5;
                 struct CollisionSensor* collisionSensor7 = &player_cSensor[i];
                 collisionSensor7->yPos = collisionSensor7->yPos + num6;
-                PlayerSystem_RoofCollision(playerO, &player_cSensor[i]);
             }
         }
+        PlayerSystem_RoofCollision(playerO, &player_cSensor[4], 2);
         if (!(player_cSensor[4].collided == 1 | player_cSensor[5].collided == 1))
         {
             continue;
@@ -1049,11 +874,11 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                 collisionSensor3->yPos = collisionSensor3->yPos + sinValue256;
                 if (playerO->speed > 0)
                 {
-                    PlayerSystem_LWallCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_LWallCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (playerO->speed < 0)
                 {
-                    PlayerSystem_RWallCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_RWallCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (player_cSensor[3].collided == 1)
                 {
@@ -1066,8 +891,8 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                     collisionSensor4->xPos = collisionSensor4->xPos + cosValue256;
                     struct CollisionSensor* collisionSensor5 = &player_cSensor[i];
                     collisionSensor5->yPos = collisionSensor5->yPos + sinValue256;
-                    PlayerSystem_FindFloorPosition(playerO, &player_cSensor[i], player_cSensor[i].yPos >> 16);
                 }
+                PlayerSystem_FindFloorPosition(playerO, player_cSensor, 3);
                 num = -1;
                 for (i = 0; i < 3; i++)
                 {
@@ -1126,11 +951,11 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                 collisionSensor7->yPos = collisionSensor7->yPos + sinValue256;
                 if (playerO->speed > 0)
                 {
-                    PlayerSystem_RoofCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_RoofCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (playerO->speed < 0)
                 {
-                    PlayerSystem_FloorCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_FloorCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (player_cSensor[3].collided == 1)
                 {
@@ -1143,8 +968,8 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                     collisionSensor8->xPos = collisionSensor8->xPos + cosValue256;
                     struct CollisionSensor* collisionSensor9 = &player_cSensor[i];
                     collisionSensor9->yPos = collisionSensor9->yPos + sinValue256;
-                    PlayerSystem_FindLWallPosition(playerO, &player_cSensor[i], player_cSensor[i].xPos >> 16);
                 }
+                PlayerSystem_FindLWallPosition(playerO, player_cSensor, 3);
                 num = -1;
                 for (i = 0; i < 3; i++)
                 {
@@ -1194,11 +1019,11 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                 collisionSensor11->yPos = collisionSensor11->yPos + sinValue256;
                 if (playerO->speed > 0)
                 {
-                    PlayerSystem_RWallCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_RWallCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (playerO->speed < 0)
                 {
-                    PlayerSystem_LWallCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_LWallCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (player_cSensor[3].collided == 1)
                 {
@@ -1211,8 +1036,8 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                     collisionSensor12->xPos = collisionSensor12->xPos + cosValue256;
                     struct CollisionSensor* collisionSensor13 = &player_cSensor[i];
                     collisionSensor13->yPos = collisionSensor13->yPos + sinValue256;
-                    PlayerSystem_FindRoofPosition(playerO, &player_cSensor[i], player_cSensor[i].yPos >> 16);
                 }
+                PlayerSystem_FindRoofPosition(playerO, player_cSensor, 3);
                 num = -1;
                 for (i = 0; i < 3; i++)
                 {
@@ -1264,11 +1089,11 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                 collisionSensor15->yPos = collisionSensor15->yPos + sinValue256;
                 if (playerO->speed > 0)
                 {
-                    PlayerSystem_FloorCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_FloorCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (playerO->speed < 0)
                 {
-                    PlayerSystem_RoofCollision(playerO, &player_cSensor[3]);
+                    PlayerSystem_RoofCollision(playerO, &player_cSensor[3], 1);
                 }
                 if (player_cSensor[3].collided == 1)
                 {
@@ -1281,8 +1106,8 @@ void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO)
                     collisionSensor16->xPos = collisionSensor16->xPos + cosValue256;
                     struct CollisionSensor* collisionSensor17 = &player_cSensor[i];
                     collisionSensor17->yPos = collisionSensor17->yPos + sinValue256;
-                    PlayerSystem_FindRWallPosition(playerO, &player_cSensor[i], player_cSensor[i].xPos >> 16);
                 }
+                PlayerSystem_FindRWallPosition(playerO, player_cSensor, 3);
                 num = -1;
                 for (i = 0; i < 3; i++)
                 {
@@ -1692,100 +1517,65 @@ void PlayerSystem_ProcessPlayerTileCollisions(struct PlayerObject* playerO)
     }
 }
 
-void PlayerSystem_RoofCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef)
+void PlayerSystem_RoofCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->yPos >> 16;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int startPos[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        startPos[s] = sensors[s].yPos >> 16;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
         {
-            int num2 = cSensorRef->xPos >> 16;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = (cSensorRef->yPos >> 16) + 16 - i;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            probes[s].xPos = sensors[s].xPos >> 16;
+            probes[s].yPos = (sensors[s].yPos >> 16) + 16 - i;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_ROOF);
+        for (int s = 0; s < count; s++)
+        {
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startPos[s];
+            if (cSensorRef->collided == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] != 1 && tile128x128.collisionFlag[playerO->collisionPlane][num8] < 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num6 = num5 >> 7;
+                int num7 = (num5 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag != 1 && probes[s].cFlag < 3)
                     {
-                        case 0:
+                        if ((num5 & 15) < probes[s].mask + 16 - i)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) >= tileCollisions[playerO->collisionPlane].roofMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
+                            cSensorRef->yPos = probes[s].mask + (num6 << 7) + (num7 << 4);
                             cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24);
-                            break;
+                            cSensorRef->angle = probes[s].angle;
                         }
-                        case 1:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->angle < 0)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) >= tileCollisions[playerO->collisionPlane].roofMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = tileCollisions[playerO->collisionPlane].roofMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - ((tileCollisions[playerO->collisionPlane].angle[num9] & -16777216) >> 24));
-                            break;
+                            struct CollisionSensor* collisionSensor = cSensorRef;
+                            collisionSensor->angle = collisionSensor->angle + 0x100;
                         }
-                        case 2:
+                        if (cSensorRef->angle > 0xff)
                         {
-                            num = (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) >= 15 - tileCollisions[playerO->collisionPlane].floorMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x180 - (tileCollisions[playerO->collisionPlane].angle[num9] & 0xff) & 0xff);
-                            break;
+                            struct CollisionSensor* collisionSensor1 = cSensorRef;
+                            collisionSensor1->angle = collisionSensor1->angle - 0x100;
                         }
-                        case 3:
+                        if (cSensorRef->yPos - num1 > 14)
                         {
-                            num = 15 - (num2 & 15) + (num9 << 4);
-                            if ((num5 & 15) >= 15 - tileCollisions[playerO->collisionPlane].floorMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->yPos = 15 - tileCollisions[playerO->collisionPlane].floorMask[num] + (num6 << 7) + (num7 << 4);
-                            cSensorRef->collided = 1;
-                            cSensorRef->angle = (int)(0x100 - (0x180 - (tileCollisions[playerO->collisionPlane].angle[num9] & 0xff) & 0xff));
-                            break;
+                            cSensorRef->yPos = num1 << 16;
+                            cSensorRef->collided = 0;
+                        }
+                        else if (cSensorRef->yPos - num1 < -14)
+                        {
+                            cSensorRef->yPos = num1 << 16;
+                            cSensorRef->collided = 0;
                         }
-                    }
-                }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->angle < 0)
-                    {
-                        struct CollisionSensor* collisionSensor = cSensorRef;
-                        collisionSensor->angle = collisionSensor->angle + 0x100;
-                    }
-                    if (cSensorRef->angle > 0xff)
-                    {
-                        struct CollisionSensor* collisionSensor1 = cSensorRef;
-                        collisionSensor1->angle = collisionSensor1->angle - 0x100;
-                    }
-                    if (cSensorRef->yPos - num1 > 14)
-                    {
-                        cSensorRef->yPos = num1 << 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->yPos - num1 < -14)
-                    {
-                        cSensorRef->yPos = num1 << 16;
-                        cSensorRef->collided = 0;
                     }
                 }
             }
@@ -1793,88 +1583,56 @@ void PlayerSystem_RoofCollision(struct PlayerObject* playerO, struct CollisionSe
     }
 }
 
-void PlayerSystem_RWallCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef)
+void PlayerSystem_RWallCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count)
 {
-    int num;
-    int num1 = cSensorRef->xPos >> 16;
+    struct CollisionProbe probes[SENSOR_BATCH_LIMIT];
+    int startPos[SENSOR_BATCH_LIMIT];
+    for (int s = 0; s < count; s++)
+    {
+        startPos[s] = sensors[s].xPos >> 16;
+    }
     for (int i = 0; i < 48; i = i + 16)
     {
-        if (cSensorRef->collided == 0)
+        for (int s = 0; s < count; s++)
         {
-            int num2 = (cSensorRef->xPos >> 16) + 16 - i;
-            int num3 = num2 >> 7;
-            int num4 = (num2 & 127) >> 4;
-            int num5 = cSensorRef->yPos >> 16;
-            int num6 = num5 >> 7;
-            int num7 = (num5 & 127) >> 4;
-            if (num2 > -1 && num5 > -1)
+            probes[s].xPos = (sensors[s].xPos >> 16) + 16 - i;
+            probes[s].yPos = sensors[s].yPos >> 16;
+        }
+        StageSystem_ProbeCollision(probes, count, playerO->collisionPlane, COLLISION_RWALL);
+        for (int s = 0; s < count; s++)
+        {
+            struct CollisionSensor* cSensorRef = &sensors[s];
+            int num1 = startPos[s];
+            if (cSensorRef->collided == 0)
             {
-                int num8 = stageLayouts[0].tileMap[num3 + (num6 << 8)] << 6;
-                num8 = num8 + num4 + (num7 << 3);
-                int num9 = tile128x128.tile16x16[num8];
-                if (tile128x128.collisionFlag[playerO->collisionPlane][num8] != 1 && tile128x128.collisionFlag[playerO->collisionPlane][num8] < 3)
+                int num2 = probes[s].xPos;
+                int num5 = probes[s].yPos;
+                int num3 = num2 >> 7;
+                int num4 = (num2 & 127) >> 4;
+                if (num2 > -1 && num5 > -1)
                 {
-                    switch (tile128x128.direction[num8])
+                    if (probes[s].cFlag != 1 && probes[s].cFlag < 3)
                     {
-                        case 0:
-                        {
-                            num = (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) >= tileCollisions[playerO->collisionPlane].rightWallMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            break;
-                        }
-                        case 1:
+                        if ((num2 & 15) < probes[s].mask + 16 - i)
                         {
-                            num = (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) >= 15 - tileCollisions[playerO->collisionPlane].leftWallMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
+                            cSensorRef->xPos = probes[s].mask + (num3 << 7) + (num4 << 4);
                             cSensorRef->collided = 1;
-                            break;
                         }
-                        case 2:
+                    }
+                    if (cSensorRef->collided == 1)
+                    {
+                        if (cSensorRef->xPos - num1 > 15)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) >= tileCollisions[playerO->collisionPlane].rightWallMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = tileCollisions[playerO->collisionPlane].rightWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            break;
+                            cSensorRef->xPos = num1 << 16;
+                            cSensorRef->collided = 0;
                         }
-                        case 3:
+                        else if (cSensorRef->xPos - num1 < -15)
                         {
-                            num = 15 - (num5 & 15) + (num9 << 4);
-                            if ((num2 & 15) >= 15 - tileCollisions[playerO->collisionPlane].leftWallMask[num] + 16 - i)
-                            {
-                                break;
-                            }
-                            cSensorRef->xPos = 15 - tileCollisions[playerO->collisionPlane].leftWallMask[num] + (num3 << 7) + (num4 << 4);
-                            cSensorRef->collided = 1;
-                            break;
+                            cSensorRef->xPos = num1 << 16;
+                            cSensorRef->collided = 0;
                         }
                     }
                 }
-                if (cSensorRef->collided == 1)
-                {
-                    if (cSensorRef->xPos - num1 > 15)
-                    {
-                        cSensorRef->xPos = num1 << 16;
-                        cSensorRef->collided = 0;
-                    }
-                    else if (cSensorRef->xPos - num1 < -15)
-                    {
-                        cSensorRef->xPos = num1 << 16;
-                        cSensorRef->collided = 0;
-                    }
-                }
             }
         }
     }
@@ -1882,7 +1640,7 @@ void PlayerSystem_RWallCollision(struct PlayerObject* playerO, struct CollisionS
 
 void PlayerSystem_SetPathGripSensors(struct PlayerObject* playerO)
 {
-    struct CollisionBox* collisionBox = &collisionBoxList[playerO->animationFile->cbListOffset + animationFrames[animationList[playerO->animationFile->aniListOffset + playerO->objectPtr->animation].frameListOffset + playerO->objectPtr->frame].collisionBox];
+    struct CollisionBox* collisionBox = PlayerSystem_GetCollisionBox(playerO);
     switch (playerO->collisionMode)
     {
         case 0:
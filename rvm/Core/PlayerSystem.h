@@ -14,35 +14,38 @@
 #include "AnimationSystem.h"
 #include "ObjectSystem.h"
 #include "GlobalAppDefinitions.h"
+#include "EngineContext.h"
 
-extern unsigned short delayLeft;
-extern unsigned short delayRight;
-extern unsigned short delayUp;
-extern unsigned short delayDown;
-extern unsigned short delayJumpPress;
-extern unsigned short delayJumpHold;
-extern unsigned char jumpWait;
-extern unsigned char numActivePlayers;
-extern unsigned char playerMenuNum;
-extern struct PlayerObject playerList[2];
-extern int collisionLeft;
-extern int collisionTop;
-extern int collisionRight;
-extern int collisionBottom;
+#define SENSOR_BATCH_LIMIT 3
+
+extern ENGINE_STATE unsigned short delayLeft;
+extern ENGINE_STATE unsigned short delayRight;
+extern ENGINE_STATE unsigned short delayUp;
+extern ENGINE_STATE unsigned short delayDown;
+extern ENGINE_STATE unsigned short delayJumpPress;
+extern ENGINE_STATE unsigned short delayJumpHold;
+extern ENGINE_STATE unsigned char jumpWait;
+extern ENGINE_STATE unsigned char numActivePlayers;
+extern ENGINE_STATE unsigned char playerMenuNum;
+extern ENGINE_STATE int collisionLeft;
+extern ENGINE_STATE int collisionTop;
+extern ENGINE_STATE int collisionRight;
+extern ENGINE_STATE int collisionBottom;
 
 void Init_PlayerSystem(void);
-void PlayerSystem_FindFloorPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos);
-void PlayerSystem_FindLWallPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos);
-void PlayerSystem_FindRoofPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos);
-void PlayerSystem_FindRWallPosition(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef, int prevCollisionPos);
-void PlayerSystem_FloorCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef);
-void PlayerSystem_LWallCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef);
+void PlayerSystem_FindFloorPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
+void PlayerSystem_FindLWallPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
+void PlayerSystem_FindRoofPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
+void PlayerSystem_FindRWallPosition(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
+struct CollisionBox* PlayerSystem_GetCollisionBox(struct PlayerObject* playerO);
+void PlayerSystem_FloorCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
+void PlayerSystem_LWallCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
 void PlayerSystem_ProcessAirCollision(struct PlayerObject* playerO);
 void PlayerSystem_ProcessPathGrip(struct PlayerObject* playerO);
 void PlayerSystem_ProcessPlayerControl(struct PlayerObject* playerO);
 void PlayerSystem_ProcessPlayerTileCollisions(struct PlayerObject* playerO);
-void PlayerSystem_RoofCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef);
-void PlayerSystem_RWallCollision(struct PlayerObject* playerO, struct CollisionSensor* cSensorRef);
+void PlayerSystem_RoofCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
+void PlayerSystem_RWallCollision(struct PlayerObject* playerO, struct CollisionSensor* sensors, int count);
 void PlayerSystem_SetPathGripSensors(struct PlayerObject* playerO);
 void PlayerSystem_SetPlayerHLockedScreenPosition(struct PlayerObject* playerO);
 void PlayerSystem_SetPlayerLockedScreenPosition(struct PlayerObject* playerO);
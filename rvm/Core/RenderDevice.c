@@ -4,6 +4,8 @@
 //
 
 #include "RenderDevice.h"
+#include "ObjectSystem.h"
+#include "StateDigest.h"
 #if WINDOWS
 #include <Windows.h>
 #include <GL/glew.h>
@@ -14,24 +16,30 @@
 #else
 #include <OpenGL/gl.h>
 #endif
+#include "EngineBuffers.h"
 
-#define NUM_TEXTURES 6
+#define NUM_TEXTURES 8
+#define NUM_PRELOADED_TEXTURES 6
 const int TEXTURE_SIZE = 1024*1024*2;
-int orthWidth;
-int viewWidth;
-int viewHeight;
-float viewAspect;
-int bufferWidth;
-int bufferHeight;
-int highResMode;
-int virtualX;
-int virtualY;
-int virtualWidth;
-int virtualHeight;
-GLuint gfxTextureID[NUM_TEXTURES];
-GLuint framebufferId;
-GLuint fbTextureId;
-short screenVerts[] = {
+ENGINE_STATE int orthWidth;
+ENGINE_STATE int viewWidth;
+ENGINE_STATE int viewHeight;
+ENGINE_STATE float viewAspect;
+ENGINE_STATE int bufferWidth;
+ENGINE_STATE int bufferHeight;
+ENGINE_STATE int highResMode;
+ENGINE_STATE bool redrawSuppression;
+ENGINE_STATE uint64_t presentedFrameHash;
+ENGINE_STATE unsigned int framesSuppressed;
+ENGINE_STATE int virtualX;
+ENGINE_STATE int virtualY;
+ENGINE_STATE int virtualWidth;
+ENGINE_STATE int virtualHeight;
+ENGINE_STATE GLuint gfxTextureID[NUM_TEXTURES];
+ENGINE_STATE bool gfxTextureLoaded[NUM_TEXTURES];
+ENGINE_STATE GLuint framebufferId;
+ENGINE_STATE GLuint fbTextureId;
+ENGINE_STATE short screenVerts[] = {
     0, 0,
     6400, 0,
     0, 3844,
@@ -80,6 +88,12 @@ void InitRenderDevice()
 {
     Init_GraphicsSystem();
     highResMode = 0;
+    if (engineHeadless)
+    {
+        //No GL context on this thread, only the polygon lists are needed
+        GraphicsSystem_SetupPolygonLists();
+        return;
+    }
     glClearColor(0.0, 0.0, 0.0, 1.0);
     glDisable(GL_LIGHTING);
     glDisable(GL_DITHER);
@@ -116,18 +130,41 @@ void InitRenderDevice()
 }
 void RenderDevice_UpdateHardwareTextures()
 {
+    presentedFrameHash = 0;
     GraphicsSystem_SetActivePalette(0, 0, 240);
     GraphicsSystem_UpdateTextureBufferWithTiles();
     GraphicsSystem_UpdateTextureBufferWithSortedSprites();
+    AnimationSystem_UpdateSpriteQuads();
+    ObjectSystem_UpdateSpriteQuads();
+    if (engineHeadless)
+    {
+        return;
+    }
+    if (skipFrameDraw)
+    {
+        //Nothing is drawn this frame, SetPaletteLines uploads each palette's texture on first use instead
+        for (uint8_t b = 0; b < NUM_TEXTURES; b += 1)
+        {
+            gfxTextureLoaded[b] = false;
+        }
+        return;
+    }
     
     glBindTexture(GL_TEXTURE_2D, gfxTextureID[0]);
     HandleGlError();
     
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1024, 1024, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, texBuffer);
     HandleGlError();
+    gfxTextureLoaded[0] = true;
     
     for (uint8_t b = 1; b < NUM_TEXTURES; b += 1)
     {
+        //The last palettes are only used by some water stages, so they get built on first use.
+        gfxTextureLoaded[b] = b < NUM_PRELOADED_TEXTURES;
+        if (!gfxTextureLoaded[b])
+        {
+            continue;
+        }
         GraphicsSystem_SetActivePalette(b, 0, 240);
         GraphicsSystem_UpdateTextureBufferWithTiles();
         GraphicsSystem_UpdateTextureBufferWithSprites();
@@ -140,6 +177,47 @@ void RenderDevice_UpdateHardwareTextures()
     }
     GraphicsSystem_SetActivePalette(0, 0, 240);
 }
+void RenderDevice_LoadPaletteTexture(int paletteNum)
+{
+    int prevPaletteNum = texPaletteNum;
+    texPaletteNum = paletteNum;
+    GraphicsSystem_UpdateTextureBufferWithTiles();
+    GraphicsSystem_UpdateTextureBufferWithSprites();
+    
+    glBindTexture(GL_TEXTURE_2D, gfxTextureID[paletteNum]);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1024, 1024, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, texBuffer);
+    HandleGlError();
+    texPaletteNum = prevPaletteNum;
+    gfxTextureLoaded[paletteNum] = true;
+}
+int RenderDevice_SetPaletteLines(int lineStart)
+{
+    //Finds the run of scanlines sharing lineStart's palette, binds that palette's texture
+    //and scissors to the run. A single run covering the screen draws without a scissor.
+    int paletteNum = gfxLineBuffer[lineStart];
+    int lineEnd = lineStart + 1;
+    while (lineEnd < 240 && gfxLineBuffer[lineEnd] == paletteNum)
+    {
+        lineEnd++;
+    }
+    if (lineStart == 0 && lineEnd == 240)
+    {
+        glDisable(GL_SCISSOR_TEST);
+    }
+    else
+    {
+        int top = (lineStart * 16 * bufferHeight + 1922) / 3844;
+        int bottom = lineEnd == 240 ? bufferHeight : (lineEnd * 16 * bufferHeight + 1922) / 3844;
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(0, bufferHeight - bottom, bufferWidth, bottom - top);
+    }
+    if (!gfxTextureLoaded[paletteNum])
+    {
+        RenderDevice_LoadPaletteTexture(paletteNum);
+    }
+    glBindTexture(GL_TEXTURE_2D, gfxTextureID[paletteNum]);
+    return lineEnd;
+}
 void RenderDevice_SetScreenDimensions(int width, int height)
 {
     touchWidth = width;
@@ -175,6 +253,11 @@ void RenderDevice_SetScreenDimensions(int width, int height)
         bufferHeight = 240;
     }
     orthWidth = SCREEN_XSIZE * 16;
+    presentedFrameHash = 0;
+    if (engineHeadless)
+    {
+        return;
+    }
     
     //You should never change screen dimensions, so we should not need to do this, but I'll do it anyway.
     if(framebufferId > 0){
@@ -225,6 +308,53 @@ void RenderDevice_ScaleViewport(int width, int height){
     }
 }
 
+bool RenderDevice_FrameChanged()
+{
+    //Hashes everything the flips read, so a frame that matches the one on screen can skip its flip and swap.
+    //The textures aren't hashed, uploading them clears presentedFrameHash instead.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    int state[14];
+    if (!redrawSuppression)
+    {
+        return true;
+    }
+    state[0] = gfxVertexSize;
+    state[1] = gfxIndexSize;
+    state[2] = gfxIndexSizeOpaque;
+    state[3] = render3DEnabled;
+    state[4] = indexSize3D;
+    state[5] = sceneBatchCount3D;
+    state[6] = highResMode;
+    state[7] = orthWidth;
+    state[8] = bufferWidth;
+    state[9] = bufferHeight;
+    state[10] = virtualX;
+    state[11] = virtualY;
+    state[12] = virtualWidth;
+    state[13] = virtualHeight;
+    hash = StateDigest_Hash(hash, state, sizeof(state));
+    hash = StateDigest_Hash(hash, gfxLineBuffer, sizeof(gfxLineBuffer));
+    hash = StateDigest_Hash(hash, gfxPolyList, gfxVertexSize * sizeof(struct DrawVertex));
+    if (render3DEnabled)
+    {
+        hash = StateDigest_Hash(hash, &floor3DPos, sizeof(floor3DPos));
+        hash = StateDigest_Hash(hash, &floor3DAngle, sizeof(floor3DAngle));
+        hash = StateDigest_Hash(hash, polyList3D, vertexSize3D * sizeof(struct DrawVertex3D));
+    }
+    if (sceneBatchCount3D > 0)
+    {
+        hash = StateDigest_Hash(hash, sceneBatchList3D, sceneBatchCount3D * sizeof(struct DrawBatch3D));
+        hash = StateDigest_Hash(hash, scenePolyList3D, sceneVertexSize3D * sizeof(struct DrawVertex3D));
+    }
+    if (hash == presentedFrameHash)
+    {
+        framesSuppressed++;
+        return false;
+    }
+    presentedFrameHash = hash;
+    return true;
+}
+
 void CalcPerspective(float fov, float aspectRatio, float nearPlane, float farPlane){
     GLfloat matrix[16];
     float w = 1.0 / tanf(fov * 0.5f);
@@ -254,6 +384,39 @@ void CalcPerspective(float fov, float aspectRatio, float nearPlane, float farPla
     glMultMatrixf(matrix);
 }
 
+void RenderDevice_DrawGfxPolyList(int indexStart, int indexEnd, bool drawTrailing)
+{
+    //Draws a range of the 2D list, splicing in any hardware Scene3D batches recorded inside it.
+    //A batch sitting exactly on indexEnd is only drawn by the range that finishes the list.
+    for (int i = 0; i < sceneBatchCount3D; i++)
+    {
+        struct DrawBatch3D* batch = &sceneBatchList3D[i];
+        if (batch->indexPos < indexStart || batch->indexPos > indexEnd || (batch->indexPos == indexEnd && !drawTrailing))
+        {
+            continue;
+        }
+        if (batch->indexPos > indexStart)
+        {
+            glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
+            glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
+            glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
+            glDrawElements(GL_TRIANGLES, batch->indexPos - indexStart, GL_UNSIGNED_SHORT, &gfxPolyListIndex[indexStart]);
+            indexStart = batch->indexPos;
+        }
+        glPushMatrix();
+        glLoadMatrixf(batch->matrix);
+        glVertexPointer(3, GL_FLOAT, 20, &scenePolyList3D[0].position);
+        glTexCoordPointer(2, GL_SHORT, 20, &scenePolyList3D[0].texCoord);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 20, &scenePolyList3D[0].color);
+        glDrawElements(GL_TRIANGLES, (batch->vertexCount >> 2) * 6, GL_UNSIGNED_SHORT, &gfxPolyListIndex[(batch->vertexStart >> 2) * 6]);
+        glPopMatrix();
+    }
+    glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
+    glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
+    glDrawElements(GL_TRIANGLES, indexEnd - indexStart, GL_UNSIGNED_SHORT, &gfxPolyListIndex[indexStart]);
+}
+
 void RenderDevice_FlipScreen()
 {
     glBindFramebuffer(GL_FRAMEBUFFER, framebufferId);
@@ -262,69 +425,52 @@ void RenderDevice_FlipScreen()
     HandleGlError();
     
     glOrtho(0, orthWidth, 3844.0f, 0.0, 0.0f, 100.0f);
-    if(texPaletteNum >= NUM_TEXTURES){
-        //This is a stage that requires the software renderer for correct water palettes.
-        //Only happens if using the PC / Console Data.rsdk file
-        glBindTexture(GL_TEXTURE_2D, gfxTextureID[texPaletteNum % NUM_TEXTURES]);
-    }
-    else{
-        glBindTexture(GL_TEXTURE_2D, gfxTextureID[texPaletteNum]);
-    }
     glEnableClientState(GL_COLOR_ARRAY);
     HandleGlError();
-    if(render3DEnabled){
-        glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
-        glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
-        glDrawElements(GL_TRIANGLES, gfxIndexSizeOpaque, GL_UNSIGNED_SHORT, gfxPolyListIndex);
-        glEnable(GL_BLEND);
-        HandleGlError();
+    //Water palettes are split by scanline, each run redraws the same lists under its own scissor
+    for (int lineStart = 0; lineStart < 240;)
+    {
+        lineStart = RenderDevice_SetPaletteLines(lineStart);
+        if(render3DEnabled){
+            RenderDevice_DrawGfxPolyList(0, gfxIndexSizeOpaque, false);
+            glEnable(GL_BLEND);
+            HandleGlError();
         
-        glViewport(0, 0, viewWidth, viewHeight);
-        glPushMatrix();
-        glLoadIdentity();
-        CalcPerspective(1.8326f, viewAspect, 0.1f, 1000.0f);
-        glMatrixMode(GL_MODELVIEW);
-        glLoadIdentity();
+            glViewport(0, 0, viewWidth, viewHeight);
+            glPushMatrix();
+            glLoadIdentity();
+            CalcPerspective(1.8326f, viewAspect, 0.1f, 1000.0f);
+            glMatrixMode(GL_MODELVIEW);
+            glLoadIdentity();
        
-        glScalef(1.0f, -1.0f, -1.0f);
-        glRotatef(180.0f + floor3DAngle, 0, 1.0f, 0);
-        glTranslatef(floor3DPos.X, floor3DPos.Y, floor3DPos.Z);
-        glVertexPointer(3, GL_FLOAT, 20, &polyList3D[0].position);
-        glTexCoordPointer(2, GL_SHORT, 20, &polyList3D[0].texCoord);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 20, &polyList3D[0].color);
-        glDrawElements(GL_TRIANGLES, indexSize3D, GL_UNSIGNED_SHORT, gfxPolyListIndex);
-        glLoadIdentity();
-        glMatrixMode(GL_PROJECTION);
+            glScalef(1.0f, -1.0f, -1.0f);
+            glRotatef(180.0f + floor3DAngle, 0, 1.0f, 0);
+            glTranslatef(floor3DPos.X, floor3DPos.Y, floor3DPos.Z);
+            glVertexPointer(3, GL_FLOAT, 20, &polyList3D[0].position);
+            glTexCoordPointer(2, GL_SHORT, 20, &polyList3D[0].texCoord);
+            glColorPointer(4, GL_UNSIGNED_BYTE, 20, &polyList3D[0].color);
+            glDrawElements(GL_TRIANGLES, indexSize3D, GL_UNSIGNED_SHORT, gfxPolyListIndex);
+            glLoadIdentity();
+            glMatrixMode(GL_PROJECTION);
         
-        glViewport(0, 0, bufferWidth, bufferHeight);
-        glPopMatrix();
-        HandleGlError();
+            glViewport(0, 0, bufferWidth, bufferHeight);
+            glPopMatrix();
+            HandleGlError();
         
-        int numBlendedGfx = (int)(gfxIndexSize - gfxIndexSizeOpaque);
-        glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
-        glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
-        glDrawElements(GL_TRIANGLES, numBlendedGfx, GL_UNSIGNED_SHORT, &gfxPolyListIndex[gfxIndexSizeOpaque]);
-        HandleGlError();
-    }
-    else{
-        glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
-        glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
-        glDrawElements(GL_TRIANGLES, gfxIndexSizeOpaque, GL_UNSIGNED_SHORT, gfxPolyListIndex);
-        HandleGlError();
-        
-        int numBlendedGfx = (int)(gfxIndexSize - gfxIndexSizeOpaque);
+            RenderDevice_DrawGfxPolyList(gfxIndexSizeOpaque, gfxIndexSize, true);
+            HandleGlError();
+        }
+        else{
+            RenderDevice_DrawGfxPolyList(0, gfxIndexSizeOpaque, false);
+            HandleGlError();
         
-        glEnable(GL_BLEND);
-        glEnable(GL_TEXTURE_2D);
-        glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
-        glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
-        glDrawElements(GL_TRIANGLES, numBlendedGfx, GL_UNSIGNED_SHORT, &gfxPolyListIndex[gfxIndexSizeOpaque]);
-        HandleGlError();
+            glEnable(GL_BLEND);
+            glEnable(GL_TEXTURE_2D);
+            RenderDevice_DrawGfxPolyList(gfxIndexSizeOpaque, gfxIndexSize, true);
+            HandleGlError();
+        }
     }
+    glDisable(GL_SCISSOR_TEST);
     glDisableClientState(GL_COLOR_ARRAY);
     
     //Render the framebuffer now
@@ -350,26 +496,23 @@ void RenderDevice_FlipScreenHRes()
     
     glOrtho(0, orthWidth, 3844.0f, 0.0, 0.0f, 100.0f);
     glViewport(0, 0, bufferWidth, bufferHeight);
-    glBindTexture(GL_TEXTURE_2D, gfxTextureID[texPaletteNum]);
-    glDisable(GL_BLEND);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     
     glEnableClientState(GL_COLOR_ARRAY);
     
-    glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
-    glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
-    glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
-    glDrawElements(GL_TRIANGLES, gfxIndexSizeOpaque, GL_UNSIGNED_SHORT, gfxPolyListIndex);
-    
-    HandleGlError();
-    
-    glEnable(GL_BLEND);
-    int numBlendedGfx = (int)((gfxIndexSize) - (gfxIndexSizeOpaque));
-    glVertexPointer(2, GL_SHORT, 12, &gfxPolyList[0].position);
-    glTexCoordPointer(2, GL_SHORT, 12, &gfxPolyList[0].texCoord);
-    glColorPointer(4, GL_UNSIGNED_BYTE, 12, &gfxPolyList[0].color);
-    glDrawElements(GL_TRIANGLES, numBlendedGfx, GL_UNSIGNED_SHORT, &gfxPolyListIndex[gfxIndexSizeOpaque]);
+    for (int lineStart = 0; lineStart < 240;)
+    {
+        lineStart = RenderDevice_SetPaletteLines(lineStart);
+        glDisable(GL_BLEND);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        RenderDevice_DrawGfxPolyList(0, gfxIndexSizeOpaque, false);
+        
+        HandleGlError();
+        
+        glEnable(GL_BLEND);
+        RenderDevice_DrawGfxPolyList(gfxIndexSizeOpaque, gfxIndexSize, true);
+    }
+    glDisable(GL_SCISSOR_TEST);
     
     glDisableClientState(GL_COLOR_ARRAY);
     
@@ -10,20 +10,28 @@
 #include <stdbool.h>
 #include "GraphicsSystem.h"
 #include "InputSystem.h"
+#include "EngineContext.h"
 
-extern int orthWidth;
-extern int viewWidth;
-extern int viewHeight;
-extern float viewAspect;
-extern int bufferWidth;
-extern int bufferHeight;
-extern int highResMode;
+extern ENGINE_STATE int orthWidth;
+extern ENGINE_STATE int viewWidth;
+extern ENGINE_STATE int viewHeight;
+extern ENGINE_STATE float viewAspect;
+extern ENGINE_STATE int bufferWidth;
+extern ENGINE_STATE int bufferHeight;
+extern ENGINE_STATE int highResMode;
+extern ENGINE_STATE bool redrawSuppression;
+extern ENGINE_STATE uint64_t presentedFrameHash;
+extern ENGINE_STATE unsigned int framesSuppressed;
 extern bool useFBTexture;
 
 void InitRenderDevice(void);
 void RenderDevice_UpdateHardwareTextures(void);
+void RenderDevice_LoadPaletteTexture(int paletteNum);
+int RenderDevice_SetPaletteLines(int lineStart);
 void RenderDevice_SetScreenDimensions(int width, int height);
 void RenderDevice_ScaleViewport(int width, int height);
+void RenderDevice_DrawGfxPolyList(int indexStart, int indexEnd, bool drawTrailing);
+bool RenderDevice_FrameChanged(void);
 void RenderDevice_FlipScreen(void);
 void RenderDevice_FlipScreenHRes(void);
 void drawGLTest(void);
@@ -0,0 +1,18 @@
+//
+//  SaveRAMHeader.h
+//  rvm
+//
+
+#ifndef SaveRAMHeader_h
+#define SaveRAMHeader_h
+
+#include "SDL.h"
+
+struct SaveRAMHeader {
+    char signature[4];
+    uint32_t version;
+    uint32_t dataSize;
+    uint32_t checksum;
+};
+
+#endif /* SaveRAMHeader_h */
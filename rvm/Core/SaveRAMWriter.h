@@ -0,0 +1,24 @@
+//
+//  SaveRAMWriter.h
+//  rvm
+//
+
+#ifndef SaveRAMWriter_h
+#define SaveRAMWriter_h
+
+#include <stdbool.h>
+#include "SDL.h"
+
+struct SaveRAMWriter {
+    int pending[8192];
+    int image[8192];
+    int written[8192];
+    bool hasPending;
+    bool hasWritten;
+    bool quit;
+    SDL_mutex* lock;
+    SDL_sem* wake;
+    SDL_Thread* thread;
+};
+
+#endif /* SaveRAMWriter_h */
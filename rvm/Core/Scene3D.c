@@ -4,19 +4,18 @@
 //
 
 #include "Scene3D.h"
+#include "EngineBuffers.h"
 
-struct Vertex3D vertexBuffer[4096];
-struct Vertex3D vertexBufferT[4096];
-struct Face3D indexBuffer[1024];
-struct SortList drawList[1024];
-int numVertices;
-int numFaces;
-int projectionX;
-int projectionY;
-int matWorld[16];
-int matView[16];
-int matFinal[16];
-int matTemp[16];
+ENGINE_STATE int numVertices;
+ENGINE_STATE int numFaces;
+ENGINE_STATE int projectionX;
+ENGINE_STATE int projectionY;
+ENGINE_STATE int matWorld[16];
+ENGINE_STATE int matView[16];
+ENGINE_STATE int matFinal[16];
+ENGINE_STATE int matTemp[16];
+ENGINE_STATE bool cull3DBackFaces;
+ENGINE_STATE bool hardware3DEnabled;
 
 void Init_Scene3D()
 {
@@ -24,6 +23,8 @@ void Init_Scene3D()
     numFaces = 0;
     projectionX = 136;
     projectionY = 160;
+    cull3DBackFaces = false;
+    hardware3DEnabled = false;
 }
 
 void Scene3D_SetIdentityMatrix(int* m)
@@ -215,72 +216,291 @@ void Scene3D_MatrixRotateXYZ(int* m, int angleX, int angleY, int angleZ)
     m[14] = 0;
     m[15] = 256;
 }
+void Scene3D_TransformVertexBlock(int* m, struct Vertex3D* src, struct Vertex3D* dst, int count)
+{
+    //Matrix rows are hoisted into locals and vertices are processed four at a time so the
+    //lane loops below can be vectorised by the compiler. Results are identical to the scalar path.
+    int m0 = m[0], m1 = m[1], m2 = m[2];
+    int m4 = m[4], m5 = m[5], m6 = m[6];
+    int m8 = m[8], m9 = m[9], m10 = m[10];
+    int m12 = m[12], m13 = m[13], m14 = m[14];
+    int vx[4];
+    int vy[4];
+    int vz[4];
+    int tx[4];
+    int ty[4];
+    int tz[4];
+    int i = 0;
+    int lane;
+    for (; i + 4 <= count; i += 4)
+    {
+        for (lane = 0; lane < 4; lane++)
+        {
+            vx[lane] = src[i + lane].x;
+            vy[lane] = src[i + lane].y;
+            vz[lane] = src[i + lane].z;
+        }
+        for (lane = 0; lane < 4; lane++)
+        {
+            tx[lane] = (m0 * vx[lane] >> 8) + (m4 * vy[lane] >> 8) + (m8 * vz[lane] >> 8) + m12;
+            ty[lane] = (m1 * vx[lane] >> 8) + (m5 * vy[lane] >> 8) + (m9 * vz[lane] >> 8) + m13;
+            tz[lane] = (m2 * vx[lane] >> 8) + (m6 * vy[lane] >> 8) + (m10 * vz[lane] >> 8) + m14;
+        }
+        for (lane = 0; lane < 4; lane++)
+        {
+            dst[i + lane].x = tx[lane];
+            dst[i + lane].y = ty[lane];
+            dst[i + lane].z = tz[lane];
+        }
+    }
+    for (; i < count; i++)
+    {
+        int x = src[i].x;
+        int y = src[i].y;
+        int z = src[i].z;
+        dst[i].x = (m0 * x >> 8) + (m4 * y >> 8) + (m8 * z >> 8) + m12;
+        dst[i].y = (m1 * x >> 8) + (m5 * y >> 8) + (m9 * z >> 8) + m13;
+        dst[i].z = (m2 * x >> 8) + (m6 * y >> 8) + (m10 * z >> 8) + m14;
+    }
+}
 void Scene3D_TransformVertexBuffer()
 {
-    int num = 0;
-    int num2 = 0;
     for (int i = 0; i < 16; i++)
     {
         matFinal[i] = matWorld[i];
     }
     Scene3D_MatrixMultiply(matFinal, matView);
-    for (int i = 0; i < numVertices; i++)
-    {
-        struct Vertex3D* vertex3D = &vertexBuffer[num];
-        vertexBufferT[num2].x = (matFinal[0] * vertex3D->x >> 8) + (matFinal[4] * vertex3D->y >> 8) + (matFinal[8] * vertex3D->z >> 8) + matFinal[12];
-        vertexBufferT[num2].y = (matFinal[1] * vertex3D->x >> 8) + (matFinal[5] * vertex3D->y >> 8) + (matFinal[9] * vertex3D->z >> 8) + matFinal[13];
-        vertexBufferT[num2].z = (matFinal[2] * vertex3D->x >> 8) + (matFinal[6] * vertex3D->y >> 8) + (matFinal[10] * vertex3D->z >> 8) + matFinal[14];
-        if (vertexBufferT[num2].z < 1 && vertexBufferT[num2].z > 0)
-        {
-            vertexBufferT[num2].z = 1;
-        }
-        num++;
-        num2++;
-    }
+    Scene3D_TransformVertexBlock(matFinal, vertexBuffer, vertexBufferT, numVertices);
 }
 void Scene3D_TransformVertices(int* m, int vStart, int vEnd)
 {
-    int num = 0;
-    struct Vertex3D vertex3D;
-    vEnd++;
-    for (int i = vStart; i < vEnd; i++)
+    if (vEnd < vStart)
     {
-        struct Vertex3D* vertex3D2 = &vertexBuffer[i];
-        vertex3D.x = (m[0] * vertex3D2->x >> 8) + (m[4] * vertex3D2->y >> 8) + (m[8] * vertex3D2->z >> 8) + m[12];
-        vertex3D.y = (m[1] * vertex3D2->x >> 8) + (m[5] * vertex3D2->y >> 8) + (m[9] * vertex3D2->z >> 8) + m[13];
-        vertex3D.z = (m[2] * vertex3D2->x >> 8) + (m[6] * vertex3D2->y >> 8) + (m[10] * vertex3D2->z >> 8) + m[14];
-        vertexBuffer[i].x = vertex3D.x;
-        vertexBuffer[i].y = vertex3D.y;
-        vertexBuffer[i].z = vertex3D.z;
-        num++;
+        return;
     }
+    Scene3D_TransformVertexBlock(m, &vertexBuffer[vStart], &vertexBuffer[vStart], vEnd - vStart + 1);
 }
 void Scene3D_Sort3DDrawList()
 {
+    //Stable LSD radix sort, far to near. Keys are biased so that an ascending unsigned sort gives
+    //descending z, and equal depths keep their face order exactly like the old bubble sort did.
+    unsigned int count[256];
+    struct SortList* src = drawList;
+    struct SortList* dst = sortBuffer;
+    unsigned int keyOr = 0;
+    unsigned int keyAnd = 0xFFFFFFFF;
     for (int i = 0; i < numFaces; i++)
     {
         drawList[i].z = (vertexBufferT[indexBuffer[i].a].z + vertexBufferT[indexBuffer[i].b].z + vertexBufferT[indexBuffer[i].c].z + vertexBufferT[indexBuffer[i].d].z) >> 2;
         drawList[i].index = i;
+        sortKeys[i] = ~((unsigned int)drawList[i].z ^ 0x80000000);
+        keyOr |= sortKeys[i];
+        keyAnd &= sortKeys[i];
     }
-    for (int i = 0; i < numFaces; i++)
+    for (int shift = 0; shift < 32; shift += 8)
     {
-        for (int j = numFaces - 1; j > i; j--)
+        //Every key shares this byte, so the pass would not move anything
+        if (((keyOr ^ keyAnd) >> shift & 0xFF) == 0)
         {
-            if (drawList[j].z > drawList[j - 1].z)
-            {
-                int index = drawList[j].index;
-                int z = drawList[j].z;
-                drawList[j].index = drawList[j - 1].index;
-                drawList[j].z = drawList[j - 1].z;
-                drawList[j - 1].index = index;
-                drawList[j - 1].z = z;
-            }
+            continue;
+        }
+        memset(count, 0, sizeof(count));
+        for (int i = 0; i < numFaces; i++)
+        {
+            count[sortKeys[src[i].index] >> shift & 0xFF]++;
+        }
+        unsigned int pos = 0;
+        for (int i = 0; i < 256; i++)
+        {
+            unsigned int c = count[i];
+            count[i] = pos;
+            pos += c;
+        }
+        for (int i = 0; i < numFaces; i++)
+        {
+            dst[count[sortKeys[src[i].index] >> shift & 0xFF]++] = src[i];
+        }
+        struct SortList* swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != drawList)
+    {
+        memcpy(drawList, src, numFaces * sizeof(struct SortList));
+    }
+}
+bool Scene3D_FaceIsBackFacing(struct Face3D* face3D)
+{
+    //View space has the camera at the origin looking down +z, so the sign of the normal against
+    //the first corner gives the winding as seen on screen. Counter-clockwise faces are rejected.
+    struct Vertex3D* a = &vertexBufferT[face3D->a];
+    struct Vertex3D* b = &vertexBufferT[face3D->b];
+    struct Vertex3D* c = &vertexBufferT[face3D->c];
+    int64_t e1x = b->x - a->x;
+    int64_t e1y = b->y - a->y;
+    int64_t e1z = b->z - a->z;
+    int64_t e2x = c->x - a->x;
+    int64_t e2y = c->y - a->y;
+    int64_t e2z = c->z - a->z;
+    int64_t nx = e1y * e2z - e1z * e2y;
+    int64_t ny = e1z * e2x - e1x * e2z;
+    int64_t nz = e1x * e2y - e1y * e2x;
+    return nx * a->x + ny * a->y + nz * a->z > 0;
+}
+void Scene3D_ProjectVertices()
+{
+    //Shared corners are projected once here instead of once per face that uses them.
+    //Anything on or behind the near plane is left untouched and rejected by the face loop.
+    for (int i = 0; i < numVertices; i++)
+    {
+        if (vertexBufferT[i].z > 256)
+        {
+            projectedVertices[i].x = SCREEN_CENTER + vertexBufferT[i].x * projectionX / vertexBufferT[i].z;
+            projectedVertices[i].y = 120 - vertexBufferT[i].y * projectionY / vertexBufferT[i].z;
         }
     }
 }
+void Scene3D_BuildHardwareMatrix(float* m)
+{
+    //Folds matFinal, the x * projectionX / z projection and the 2D ortho into one column-major matrix.
+    //w ends up as view space z, so the GPU does the divide and clips at the same z = 256 near plane.
+    float world[16];
+    float nearPlane = 256.0f;
+    float farPlane = 16777216.0f;
+    float scaleX = 2.0f / (SCREEN_XSIZE << 4);
+    float scaleY = 2.0f / 3844.0f;
+    for (int i = 0; i < 16; i++)
+    {
+        world[i] = matFinal[i] / 256.0f;
+    }
+    world[3] = 0.0f;
+    world[7] = 0.0f;
+    world[11] = 0.0f;
+    world[12] = (float)matFinal[12];
+    world[13] = (float)matFinal[13];
+    world[14] = (float)matFinal[14];
+    world[15] = 1.0f;
+    for (int i = 0; i < 16; i += 4)
+    {
+        m[i] = scaleX * (projectionX << 4) * world[i] + (scaleX * (SCREEN_CENTER << 4) - 1.0f) * world[i + 2];
+        m[i + 1] = scaleY * (projectionY << 4) * world[i + 1] + (1.0f - scaleY * (120 << 4)) * world[i + 2];
+        m[i + 2] = (farPlane + nearPlane) / (farPlane - nearPlane) * world[i + 2] - 2.0f * farPlane * nearPlane / (farPlane - nearPlane) * world[i + 3];
+        m[i + 3] = world[i + 2];
+    }
+}
+struct DrawBatch3D* Scene3D_AddHardwareFace(struct DrawBatch3D* batch, float* matrix, struct Face3D* face3D, int surfaceNum)
+{
+    if (sceneVertexSize3D + 4 > SCENE_VERTEX_LIMIT)
+    {
+        return batch;
+    }
+    if (batch == NULL || batch->indexPos != gfxIndexSize)
+    {
+        //Anything 2D drawn since the last face splits the batch so the draw order is kept.
+        if (sceneBatchCount3D == SCENE_BATCH_LIMIT)
+        {
+            return NULL;
+        }
+        batch = &sceneBatchList3D[sceneBatchCount3D];
+        memcpy(batch->matrix, matrix, sizeof(batch->matrix));
+        batch->indexPos = gfxIndexSize;
+        batch->vertexStart = sceneVertexSize3D;
+        batch->vertexCount = 0;
+        sceneBatchCount3D++;
+    }
+    int corners[4] = { face3D->a, face3D->b, face3D->c, face3D->d };
+    for (int i = 0; i < 4; i++)
+    {
+        struct DrawVertex3D* vertex = &scenePolyList3D[sceneVertexSize3D];
+        vertex->position.X = (float)vertexBuffer[corners[i]].x;
+        vertex->position.Y = (float)vertexBuffer[corners[i]].y;
+        vertex->position.Z = (float)vertexBuffer[corners[i]].z;
+        if (face3D->flag == 0)
+        {
+            vertex->texCoord.X = (short)(gfxSurface[surfaceNum].texStartX + vertexBuffer[corners[i]].u);
+            vertex->texCoord.Y = (short)(gfxSurface[surfaceNum].texStartY + vertexBuffer[corners[i]].v);
+            vertex->color.R = 0xFF;
+            vertex->color.G = 0xFF;
+            vertex->color.B = 0xFF;
+            vertex->color.A = 0xFF;
+        }
+        else
+        {
+            int alpha = (face3D->color & 0x7F000000) >> 23;
+            vertex->texCoord.X = 10;
+            vertex->texCoord.Y = 10;
+            vertex->color.R = (uint8_t)(face3D->color >> 16 & 255);
+            vertex->color.G = (uint8_t)(face3D->color >> 8 & 255);
+            vertex->color.B = (uint8_t)(face3D->color & 255);
+            vertex->color.A = alpha > 253 ? 0xFF : (uint8_t)alpha;
+        }
+        sceneVertexSize3D++;
+    }
+    batch->vertexCount += 4;
+    return batch;
+}
 void Scene3D_Draw3DScene(int surfaceNum)
 {
     struct Quad2D quad2D;
+    if (hardware3DEnabled)
+    {
+        //Projected faces go to the GPU untouched, screen space faces still go through the 2D list.
+        //Faces crossing the near plane are rejected whole like the software path does, rather than
+        //left for the GPU to clip, so both modes draw the same set of faces.
+        struct DrawBatch3D* batch = NULL;
+        float matrix[16];
+        Scene3D_BuildHardwareMatrix(matrix);
+        for (int i = 0; i < numFaces; i++)
+        {
+            struct Face3D* face3D = &indexBuffer[drawList[i].index];
+            switch (face3D->flag)
+            {
+                case 0:
+                case 2:
+                    if (vertexBufferT[face3D->a].z <= 256 || vertexBufferT[face3D->b].z <= 256 || vertexBufferT[face3D->c].z <= 256 || vertexBufferT[face3D->d].z <= 256)
+                    {
+                        break;
+                    }
+                    if (!cull3DBackFaces || !Scene3D_FaceIsBackFacing(face3D))
+                    {
+                        batch = Scene3D_AddHardwareFace(batch, matrix, face3D, surfaceNum);
+                    }
+                    break;
+                case 1:
+                    quad2D.vertex[0].x = vertexBuffer[face3D->a].x;
+                    quad2D.vertex[0].y = vertexBuffer[face3D->a].y;
+                    quad2D.vertex[1].x = vertexBuffer[face3D->b].x;
+                    quad2D.vertex[1].y = vertexBuffer[face3D->b].y;
+                    quad2D.vertex[2].x = vertexBuffer[face3D->c].x;
+                    quad2D.vertex[2].y = vertexBuffer[face3D->c].y;
+                    quad2D.vertex[3].x = vertexBuffer[face3D->d].x;
+                    quad2D.vertex[3].y = vertexBuffer[face3D->d].y;
+                    quad2D.vertex[0].u = vertexBuffer[face3D->a].u;
+                    quad2D.vertex[0].v = vertexBuffer[face3D->a].v;
+                    quad2D.vertex[1].u = vertexBuffer[face3D->b].u;
+                    quad2D.vertex[1].v = vertexBuffer[face3D->b].v;
+                    quad2D.vertex[2].u = vertexBuffer[face3D->c].u;
+                    quad2D.vertex[2].v = vertexBuffer[face3D->c].v;
+                    quad2D.vertex[3].u = vertexBuffer[face3D->d].u;
+                    quad2D.vertex[3].v = vertexBuffer[face3D->d].v;
+                    GraphicsSystem_DrawTexturedQuad(&quad2D, surfaceNum);
+                    break;
+                case 3:
+                    quad2D.vertex[0].x = vertexBuffer[face3D->a].x;
+                    quad2D.vertex[0].y = vertexBuffer[face3D->a].y;
+                    quad2D.vertex[1].x = vertexBuffer[face3D->b].x;
+                    quad2D.vertex[1].y = vertexBuffer[face3D->b].y;
+                    quad2D.vertex[2].x = vertexBuffer[face3D->c].x;
+                    quad2D.vertex[2].y = vertexBuffer[face3D->c].y;
+                    quad2D.vertex[3].x = vertexBuffer[face3D->d].x;
+                    quad2D.vertex[3].y = vertexBuffer[face3D->d].y;
+                    GraphicsSystem_DrawQuad(&quad2D, face3D->color);
+                    break;
+            }
+        }
+        return;
+    }
+    Scene3D_ProjectVertices();
     for (int i = 0; i < numFaces; i++)
     {
         struct Face3D* face3D = &indexBuffer[drawList[i].index];
@@ -289,14 +509,18 @@ void Scene3D_Draw3DScene(int surfaceNum)
             case 0:
                 if (vertexBufferT[face3D->a].z > 256 && vertexBufferT[face3D->b].z > 256 && vertexBufferT[face3D->c].z > 256 && vertexBufferT[face3D->d].z > 256)
                 {
-                    quad2D.vertex[0].x = SCREEN_CENTER + vertexBufferT[face3D->a].x * projectionX / vertexBufferT[face3D->a].z;
-                    quad2D.vertex[0].y = 120 - vertexBufferT[face3D->a].y * projectionY / vertexBufferT[face3D->a].z;
-                    quad2D.vertex[1].x = SCREEN_CENTER + vertexBufferT[face3D->b].x * projectionX / vertexBufferT[face3D->b].z;
-                    quad2D.vertex[1].y = 120 - vertexBufferT[face3D->b].y * projectionY / vertexBufferT[face3D->b].z;
-                    quad2D.vertex[2].x = SCREEN_CENTER + vertexBufferT[face3D->c].x * projectionX / vertexBufferT[face3D->c].z;
-                    quad2D.vertex[2].y = 120 - vertexBufferT[face3D->c].y * projectionY / vertexBufferT[face3D->c].z;
-                    quad2D.vertex[3].x = SCREEN_CENTER + vertexBufferT[face3D->d].x * projectionX / vertexBufferT[face3D->d].z;
-                    quad2D.vertex[3].y = 120 - vertexBufferT[face3D->d].y * projectionY / vertexBufferT[face3D->d].z;
+                    if (cull3DBackFaces && Scene3D_FaceIsBackFacing(face3D))
+                    {
+                        break;
+                    }
+                    quad2D.vertex[0].x = projectedVertices[face3D->a].x;
+                    quad2D.vertex[0].y = projectedVertices[face3D->a].y;
+                    quad2D.vertex[1].x = projectedVertices[face3D->b].x;
+                    quad2D.vertex[1].y = projectedVertices[face3D->b].y;
+                    quad2D.vertex[2].x = projectedVertices[face3D->c].x;
+                    quad2D.vertex[2].y = projectedVertices[face3D->c].y;
+                    quad2D.vertex[3].x = projectedVertices[face3D->d].x;
+                    quad2D.vertex[3].y = projectedVertices[face3D->d].y;
                     quad2D.vertex[0].u = vertexBuffer[face3D->a].u;
                     quad2D.vertex[0].v = vertexBuffer[face3D->a].v;
                     quad2D.vertex[1].u = vertexBuffer[face3D->b].u;
@@ -330,14 +554,18 @@ void Scene3D_Draw3DScene(int surfaceNum)
             case 2:
                 if (vertexBufferT[face3D->a].z > 256 && vertexBufferT[face3D->b].z > 256 && vertexBufferT[face3D->c].z > 256 && vertexBufferT[face3D->d].z > 256)
                 {
-                    quad2D.vertex[0].x = SCREEN_CENTER + vertexBufferT[face3D->a].x * projectionX / vertexBufferT[face3D->a].z;
-                    quad2D.vertex[0].y = 120 - vertexBufferT[face3D->a].y * projectionY / vertexBufferT[face3D->a].z;
-                    quad2D.vertex[1].x = SCREEN_CENTER + vertexBufferT[face3D->b].x * projectionX / vertexBufferT[face3D->b].z;
-                    quad2D.vertex[1].y = 120 - vertexBufferT[face3D->b].y * projectionY / vertexBufferT[face3D->b].z;
-                    quad2D.vertex[2].x = SCREEN_CENTER + vertexBufferT[face3D->c].x * projectionX / vertexBufferT[face3D->c].z;
-                    quad2D.vertex[2].y = 120 - vertexBufferT[face3D->c].y * projectionY / vertexBufferT[face3D->c].z;
-                    quad2D.vertex[3].x = SCREEN_CENTER + vertexBufferT[face3D->d].x * projectionX / vertexBufferT[face3D->d].z;
-                    quad2D.vertex[3].y = 120 - vertexBufferT[face3D->d].y * projectionY / vertexBufferT[face3D->d].z;
+                    if (cull3DBackFaces && Scene3D_FaceIsBackFacing(face3D))
+                    {
+                        break;
+                    }
+                    quad2D.vertex[0].x = projectedVertices[face3D->a].x;
+                    quad2D.vertex[0].y = projectedVertices[face3D->a].y;
+                    quad2D.vertex[1].x = projectedVertices[face3D->b].x;
+                    quad2D.vertex[1].y = projectedVertices[face3D->b].y;
+                    quad2D.vertex[2].x = projectedVertices[face3D->c].x;
+                    quad2D.vertex[2].y = projectedVertices[face3D->c].y;
+                    quad2D.vertex[3].x = projectedVertices[face3D->d].x;
+                    quad2D.vertex[3].y = projectedVertices[face3D->d].y;
                     GraphicsSystem_DrawQuad(&quad2D, face3D->color);
                 }
                 break;
@@ -355,3 +583,97 @@ void Scene3D_Draw3DScene(int surfaceNum)
         }
     }
 }
+void Scene3D_Benchmark(int iterations)
+{
+    //Builds a 32x32 quad floor (1024 faces), then times the transform, sort and draw stages.
+    //The sorted order is checked against the original bubble sort. Clobbers the current 3D scene.
+    struct SortList reference[1024];
+    int x;
+    int z;
+    numVertices = 0;
+    for (z = 0; z < 33; z++)
+    {
+        for (x = 0; x < 33; x++)
+        {
+            vertexBuffer[numVertices].x = (x - 16) << 12;
+            vertexBuffer[numVertices].y = ((x * 7 + z * 13) & 15) << 8;
+            vertexBuffer[numVertices].z = (z - 16) << 12;
+            vertexBuffer[numVertices].u = x << 3;
+            vertexBuffer[numVertices].v = z << 3;
+            numVertices++;
+        }
+    }
+    numFaces = 0;
+    for (z = 0; z < 32; z++)
+    {
+        for (x = 0; x < 32; x++)
+        {
+            indexBuffer[numFaces].a = z * 33 + x;
+            indexBuffer[numFaces].b = z * 33 + x + 1;
+            indexBuffer[numFaces].c = (z + 1) * 33 + x;
+            indexBuffer[numFaces].d = (z + 1) * 33 + x + 1;
+            indexBuffer[numFaces].color = 0;
+            indexBuffer[numFaces].flag = 0;
+            numFaces++;
+        }
+    }
+    Scene3D_MatrixRotateXYZ(matWorld, 32, 96, 0);
+    Scene3D_MatrixTranslateXYZ(matView, 0, -0x1000, 0x14000);
+    Scene3D_TransformVertexBuffer();
+    for (int i = 0; i < numFaces; i++)
+    {
+        reference[i].z = (vertexBufferT[indexBuffer[i].a].z + vertexBufferT[indexBuffer[i].b].z + vertexBufferT[indexBuffer[i].c].z + vertexBufferT[indexBuffer[i].d].z) >> 2;
+        reference[i].index = i;
+    }
+    for (int i = 0; i < numFaces; i++)
+    {
+        for (int j = numFaces - 1; j > i; j--)
+        {
+            if (reference[j].z > reference[j - 1].z)
+            {
+                struct SortList swap = reference[j];
+                reference[j] = reference[j - 1];
+                reference[j - 1] = swap;
+            }
+        }
+    }
+    Scene3D_Sort3DDrawList();
+    for (int i = 0; i < numFaces; i++)
+    {
+        if (drawList[i].index != reference[i].index || drawList[i].z != reference[i].z)
+        {
+            printf("Scene3D_Benchmark: sort mismatch at %d\n", i);
+            break;
+        }
+    }
+    uint64_t freq = SDL_GetPerformanceFrequency();
+    uint64_t transformTime = 0;
+    uint64_t sortTime = 0;
+    uint64_t drawTime = 0;
+    for (int n = 0; n < iterations; n++)
+    {
+        uint64_t t0 = SDL_GetPerformanceCounter();
+        Scene3D_TransformVertexBuffer();
+        uint64_t t1 = SDL_GetPerformanceCounter();
+        Scene3D_Sort3DDrawList();
+        uint64_t t2 = SDL_GetPerformanceCounter();
+        gfxVertexSize = 0;
+        gfxIndexSize = 0;
+        Scene3D_Draw3DScene(0);
+        uint64_t t3 = SDL_GetPerformanceCounter();
+        transformTime += t1 - t0;
+        sortTime += t2 - t1;
+        drawTime += t3 - t2;
+    }
+    gfxVertexSize = 0;
+    gfxIndexSize = 0;
+    numVertices = 0;
+    numFaces = 0;
+    if (iterations > 0)
+    {
+        printf("Scene3D_Benchmark: %d faces, %d iterations\n", 1024, iterations);
+        printf("  transform: %.2f us\n", (double)transformTime * 1000000.0 / freq / iterations);
+        printf("  sort:      %.2f us\n", (double)sortTime * 1000000.0 / freq / iterations);
+        printf("  draw:      %.2f us\n", (double)drawTime * 1000000.0 / freq / iterations);
+    }
+}
@@ -7,25 +7,27 @@
 #define Scene3D_h
 
 #include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "Vertex2D.h"
 #include "Vertex3D.h"
 #include "Face3D.h"
 #include "SortList.h"
 #include "GlobalAppDefinitions.h"
 #include "Quad2D.h"
 #include "GraphicsSystem.h"
+#include "EngineContext.h"
 
-extern struct Vertex3D vertexBuffer[4096];
-extern struct Vertex3D vertexBufferT[4096];
-extern struct Face3D indexBuffer[1024];
-extern struct SortList drawList[1024];
-extern int numVertices;
-extern int numFaces;
-extern int projectionX;
-extern int projectionY;
-extern int matWorld[16];
-extern int matView[16];
-extern int matFinal[16];
-extern int matTemp[16];
+extern ENGINE_STATE int numVertices;
+extern ENGINE_STATE int numFaces;
+extern ENGINE_STATE int projectionX;
+extern ENGINE_STATE int projectionY;
+extern ENGINE_STATE int matWorld[16];
+extern ENGINE_STATE int matView[16];
+extern ENGINE_STATE int matFinal[16];
+extern ENGINE_STATE int matTemp[16];
+extern ENGINE_STATE bool cull3DBackFaces;
+extern ENGINE_STATE bool hardware3DEnabled;
 
 void Init_Scene3D(void);
 void Scene3D_SetIdentityMatrix(int* m);
@@ -36,9 +38,15 @@ void Scene3D_MatrixRotateX(int* m, int angle);
 void Scene3D_MatrixRotateY(int* m, int angle);
 void Scene3D_MatrixRotateZ(int* m, int angle);
 void Scene3D_MatrixRotateXYZ(int* m, int angleX, int angleY, int angleZ);
+void Scene3D_TransformVertexBlock(int* m, struct Vertex3D* src, struct Vertex3D* dst, int count);
 void Scene3D_TransformVertexBuffer(void);
 void Scene3D_TransformVertices(int* m, int vStart, int vEnd);
 void Scene3D_Sort3DDrawList(void);
+bool Scene3D_FaceIsBackFacing(struct Face3D* face3D);
+void Scene3D_ProjectVertices(void);
+void Scene3D_BuildHardwareMatrix(float* m);
+struct DrawBatch3D* Scene3D_AddHardwareFace(struct DrawBatch3D* batch, float* matrix, struct Face3D* face3D, int surfaceNum);
 void Scene3D_Draw3DScene(int surfaceNum);
+void Scene3D_Benchmark(int iterations);
 
 #endif /* Scene3D_h */
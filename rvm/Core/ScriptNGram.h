@@ -0,0 +1,16 @@
+//
+//  ScriptNGram.h
+//  rvm
+//
+
+#ifndef ScriptNGram_h
+#define ScriptNGram_h
+
+#include "SDL.h"
+
+struct ScriptNGram {
+    uint32_t key;
+    unsigned int count;
+};
+
+#endif /* ScriptNGram_h */
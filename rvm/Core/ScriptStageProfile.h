@@ -0,0 +1,19 @@
+//
+//  ScriptStageProfile.h
+//  rvm
+//
+
+#ifndef ScriptStageProfile_h
+#define ScriptStageProfile_h
+
+#include "SDL.h"
+
+struct ScriptStageProfile {
+    uint8_t activeStageList;
+    int stageListPosition;
+    unsigned int instructions;
+    unsigned int dispatches;
+    int fusedSites;
+};
+
+#endif /* ScriptStageProfile_h */
@@ -0,0 +1,16 @@
+//
+//  ScriptSuperInstruction.h
+//  rvm
+//
+
+#ifndef ScriptSuperInstruction_h
+#define ScriptSuperInstruction_h
+
+#include "SDL.h"
+
+struct ScriptSuperInstruction {
+    uint8_t length;
+    uint8_t opcodes[3];
+};
+
+#endif /* ScriptSuperInstruction_h */
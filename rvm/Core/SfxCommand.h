@@ -0,0 +1,20 @@
+//
+//  SfxCommand.h
+//  rvm
+//
+
+#ifndef SfxCommand_h
+#define SfxCommand_h
+
+#include "SDL.h"
+
+struct SfxCommand {
+    uint8_t type;
+    uint8_t loop;
+    uint8_t panL;
+    uint8_t panR;
+    short sfxNum;
+    short volume;
+};
+
+#endif /* SfxCommand_h */
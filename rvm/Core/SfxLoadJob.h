@@ -0,0 +1,23 @@
+//
+//  SfxLoadJob.h
+//  rvm
+//
+
+#ifndef SfxLoadJob_h
+#define SfxLoadJob_h
+
+#include <stdbool.h>
+#include "SDL.h"
+#include "FileStream.h"
+
+struct SfxLoadJob {
+    char filePath[64];
+    int sfxNum;
+    int cacheSlot;
+    bool opened;
+    struct FileStream stream;
+    uint8_t* data;
+    uint32_t length;
+};
+
+#endif /* SfxLoadJob_h */
@@ -0,0 +1,20 @@
+//
+//  SfxSample.h
+//  rvm
+//
+
+#ifndef SfxSample_h
+#define SfxSample_h
+
+#include "SDL.h"
+#include "SDL_mixer.h"
+
+struct SfxSample {
+    char filePath[64];
+    Mix_Chunk chunk;
+    int bank;
+    unsigned int lastUsed;
+    int evictedAt;
+};
+
+#endif /* SfxSample_h */
@@ -0,0 +1,26 @@
+//
+//  SfxVoice.h
+//  rvm
+//
+
+#ifndef SfxVoice_h
+#define SfxVoice_h
+
+#include "SDL.h"
+#include "SDL_mixer.h"
+
+struct SfxVoice {
+    Mix_Chunk* chunk;
+    int length;
+    int position;
+    int sfxNum;
+    int gainL;
+    int gainR;
+    uint8_t panL;
+    uint8_t panR;
+    uint8_t loop;
+    uint8_t priority;
+    unsigned int startTime;
+};
+
+#endif /* SfxVoice_h */
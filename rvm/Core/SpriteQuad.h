@@ -0,0 +1,18 @@
+//
+//  SpriteQuad.h
+//  rvm
+//
+
+#ifndef SpriteQuad_h
+#define SpriteQuad_h
+
+#include <stdbool.h>
+#include "DrawVertex.h"
+
+struct SpriteQuad {
+    struct Vector2 position[4];
+    struct Vector2 texCoord[4];
+    bool visible;
+};
+
+#endif /* SpriteQuad_h */
@@ -0,0 +1,81 @@
+//
+//  StageSnapshot.h
+//  rvm
+//
+
+#ifndef StageSnapshot_h
+#define StageSnapshot_h
+
+#include "SDL.h"
+#include "ObjectEntity.h"
+#include "ObjectScript.h"
+#include "ScriptEngine.h"
+#include "PlayerObject.h"
+#include "LayoutMap.h"
+#include "Mappings128x128.h"
+#include "LineScrollParallax.h"
+#include "PaletteEntry.h"
+#include "Vertex3D.h"
+#include "Face3D.h"
+
+//Copies of the EngineBuffers tables take a saved prefix, their own names are macros for the live ones
+struct StageSnapshot {
+    bool valid;
+    uint8_t activeStageList;
+    int stageListPosition;
+    unsigned int gfxDataPosition;
+    struct ObjectEntity savedObjectEntityList[0x4A0];
+    int savedObjectEntityXPos[0x4A0];
+    int savedObjectEntityYPos[0x4A0];
+    uint8_t savedObjectEntityType[0x4A0];
+    uint8_t savedObjectEntityPriority[0x4A0];
+    uint8_t savedObjectEntityDrawOrder[0x4A0];
+    struct ObjectScript savedObjectScriptList[0x100];
+    struct ScriptEngine scriptEng;
+    int scriptFramesNo;
+    int playerNum;
+    struct PlayerObject savedPlayerList[2];
+    struct LayoutMap savedStageLayouts[9];
+    struct Mappings128x128 savedTile128x128;
+    struct LineScrollParallax savedHParallax;
+    struct LineScrollParallax savedVParallax;
+    int savedBgDeformationData0[0x240];
+    int savedBgDeformationData1[0x240];
+    int savedBgDeformationData2[0x240];
+    int savedBgDeformationData3[0x240];
+    uint8_t activeTileLayers[4];
+    uint8_t tLayerMidPoint;
+    int xBoundary1;
+    int xBoundary2;
+    int yBoundary1;
+    int yBoundary2;
+    int newXBoundary1;
+    int newXBoundary2;
+    int newYBoundary1;
+    int newYBoundary2;
+    uint8_t cameraEnabled;
+    signed char cameraTarget;
+    uint8_t cameraShift;
+    uint8_t cameraStyle;
+    int cameraAdjustY;
+    int xScrollOffset;
+    int yScrollOffset;
+    int yScrollA;
+    int yScrollB;
+    int xScrollA;
+    int xScrollB;
+    int waterLevel;
+    char titleCardText[24];
+    char titleCardWord2;
+    uint8_t timeEnabled;
+    uint8_t pauseEnabled;
+    struct PaletteEntry savedTilePalette[256];
+    unsigned short savedTilePalette16_Data[8][256];
+    struct Vertex3D savedVertexBuffer[4096];
+    struct Face3D savedIndexBuffer[1024];
+    int numVertices;
+    int numFaces;
+    char musicTrackName[16][64];
+};
+
+#endif /* StageSnapshot_h */
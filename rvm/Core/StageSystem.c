@@ -4,64 +4,68 @@
 //
 
 #include "StageSystem.h"
+#include "EngineBuffers.h"
 
 const int ACTLAYOUT = 0;
 const int LOADSTAGE = 0;
 const int PLAYSTAGE = 1;
 const int STAGEPAUSED = 2;
-struct InputResult gKeyDown;
-struct InputResult gKeyPress;
-uint8_t stageMode;
-uint8_t pauseEnabled;
-int stageListPosition;
-struct Mappings128x128 tile128x128;
-struct LayoutMap stageLayouts[9];
-uint8_t tLayerMidPoint;
-uint8_t activeTileLayers[4];
-struct CollisionMask16x16 tileCollisions[2];
-struct LineScrollParallax hParallax;
-struct LineScrollParallax vParallax;
-int lastXSize;
-int lastYSize;
-int bgDeformationData0[0x240];
-int bgDeformationData1[0x240];
-int bgDeformationData2[0x240];
-int bgDeformationData3[0x240];
-int xBoundary1;
-int xBoundary2;
-int yBoundary1;
-int yBoundary2;
-int newXBoundary1;
-int newXBoundary2;
-int newYBoundary1;
-int newYBoundary2;
-uint8_t cameraEnabled;
-signed char cameraTarget;
-uint8_t cameraShift;
-uint8_t cameraStyle;
-int cameraAdjustY;
-int xScrollOffset;
-int yScrollOffset;
-int yScrollA;
-int yScrollB;
-int xScrollA;
-int xScrollB;
-int xScrollMove;
-int yScrollMove;
-int screenShakeX;
-int screenShakeY;
-int waterLevel;
-char titleCardText[24];
-char titleCardWord2;
-struct TextMenu gameMenu[2];
-uint8_t timeEnabled;
-uint8_t milliSeconds;
-uint8_t seconds;
-uint8_t minutes;
-uint8_t debugMode;
+ENGINE_STATE struct InputResult gKeyDown;
+ENGINE_STATE struct InputResult gKeyPress;
+ENGINE_STATE uint8_t stageMode;
+ENGINE_STATE uint8_t pauseEnabled;
+ENGINE_STATE int stageListPosition;
+ENGINE_STATE uint8_t tLayerMidPoint;
+ENGINE_STATE uint8_t activeTileLayers[4];
+ENGINE_STATE uint32_t* collisionMap;
+ENGINE_STATE int collisionMapWidth;
+ENGINE_STATE int collisionMapHeight;
+ENGINE_STATE int collisionMapSize;
+ENGINE_STATE int lastXSize;
+ENGINE_STATE int lastYSize;
+ENGINE_STATE int xBoundary1;
+ENGINE_STATE int xBoundary2;
+ENGINE_STATE int yBoundary1;
+ENGINE_STATE int yBoundary2;
+ENGINE_STATE int newXBoundary1;
+ENGINE_STATE int newXBoundary2;
+ENGINE_STATE int newYBoundary1;
+ENGINE_STATE int newYBoundary2;
+ENGINE_STATE uint8_t cameraEnabled;
+ENGINE_STATE signed char cameraTarget;
+ENGINE_STATE uint8_t cameraShift;
+ENGINE_STATE uint8_t cameraStyle;
+ENGINE_STATE int cameraAdjustY;
+ENGINE_STATE int xScrollOffset;
+ENGINE_STATE int yScrollOffset;
+ENGINE_STATE int prevXScrollOffset;
+ENGINE_STATE int prevYScrollOffset;
+ENGINE_STATE int layerParallaxOffsetY[9];
+ENGINE_STATE int yScrollA;
+ENGINE_STATE int yScrollB;
+ENGINE_STATE int xScrollA;
+ENGINE_STATE int xScrollB;
+ENGINE_STATE int xScrollMove;
+ENGINE_STATE int yScrollMove;
+ENGINE_STATE int screenShakeX;
+ENGINE_STATE int screenShakeY;
+ENGINE_STATE int waterLevel;
+ENGINE_STATE char titleCardText[24];
+ENGINE_STATE char titleCardWord2;
+ENGINE_STATE uint8_t timeEnabled;
+ENGINE_STATE uint8_t milliSeconds;
+ENGINE_STATE uint8_t seconds;
+ENGINE_STATE uint8_t minutes;
+ENGINE_STATE uint8_t debugMode;
+ENGINE_STATE bool parallelTileLayers;
+ENGINE_STATE SDL_Thread* tileLayerThreads[TILE_LAYER_THREADS];
+ENGINE_STATE int numTileLayerThreads;
+ENGINE_STATE struct DrawVertex* tileLayerVertices;
 
 void Init_StageSystem()
 {
+    collisionMapWidth = 0;
+    collisionMapHeight = 0;
     xBoundary1 = 0;
     yBoundary1 = 0;
     newXBoundary1 = 0;
@@ -70,6 +74,8 @@ void Init_StageSystem()
     cameraStyle = 0;
     xScrollOffset = 0;
     yScrollOffset = 0;
+    prevXScrollOffset = 0;
+    prevYScrollOffset = 0;
     yScrollA = 0;
     yScrollB = 240;
     xScrollA = 0;
@@ -79,70 +85,130 @@ void Init_StageSystem()
     screenShakeX = 0;
     screenShakeY = 0;
     debugMode = 0;
+    stageSnapshot.valid = false;
+}
+
+void StageSystem_CompleteStageSnapshot()
+{
+    int i;
+    for (i = 0; i < 16; i++)
+    {
+        FileIO_StrCopy(stageSnapshot.musicTrackName[i], sizeof(stageSnapshot.musicTrackName[i]), musicTracks[i].trackName, sizeof(musicTracks[i].trackName));
+    }
+    stageSnapshot.gfxDataPosition = gfxDataPosition;
+    stageSnapshot.valid = true;
 }
 
 void StageSystem_Draw3DFloorLayer(uint8_t layerNum)
+{
+    struct TileLayerJob job;
+    StageSystem_Prepare3DFloorLayer(layerNum, &job);
+    if (skipFrameDraw)
+    {
+        return;
+    }
+    StageSystem_Build3DFloorLayer(&job);
+    vertexSize3D = (uint16_t)job.vertexCount;
+    indexSize3D = (uint16_t)job.indexCount;
+}
+
+void StageSystem_Prepare3DFloorLayer(uint8_t layerNum, struct TileLayerJob* job)
+{
+    struct LayoutMap* layout = &stageLayouts[activeTileLayers[layerNum]];
+    job->layerNum = layerNum;
+    job->type = layout->type;
+    job->tileMap = layout->tileMap;
+    job->gfxDataPos = tile128x128.gfxDataPos;
+    job->direction = tile128x128.direction;
+    job->tileUVs = tileUVArray;
+    job->xSize = layout->xSize << 7;
+    job->ySize = layout->ySize << 7;
+    job->detailedFloor = HQ3DFloorEnabled;
+    if (HQ3DFloorEnabled)
+    {
+        job->floorX = (layout->xPos >> 16) - 0x100;
+        job->floorX = job->floorX + (SinValue512[layout->angle] >> 1);
+        job->floorX = job->floorX >> 4 << 4;
+        job->floorZ = (layout->zPos >> 16) - 0x100;
+        job->floorZ = job->floorZ + (CosValue512[layout->angle] >> 1);
+        job->floorZ = job->floorZ >> 4 << 4;
+    }
+    else
+    {
+        job->floorX = (layout->xPos >> 16) - 160;
+        job->floorX = job->floorX + SinValue512[layout->angle] / 3;
+        job->floorX = job->floorX >> 4 << 4;
+        job->floorZ = (layout->zPos >> 16) - 160;
+        job->floorZ = job->floorZ + CosValue512[layout->angle] / 3;
+        job->floorZ = job->floorZ >> 4 << 4;
+    }
+    job->vertices3D = polyList3D;
+    floor3DPos.X = (float)(layout->xPos >> 8) * -0.00390625f;
+    floor3DPos.Y = (float)(layout->yPos >> 8) * 0.00390625f;
+    floor3DPos.Z = (float)(layout->zPos >> 8) * -0.00390625f;
+    floor3DAngle = (float)layout->angle / 512.0f * -360.0f;
+    render3DEnabled = true;
+}
+
+void StageSystem_Build3DFloorLayer(struct TileLayerJob* job)
 {
     int tileOffset, tileX, tileY, tileSinBlock, tileCosBlock;
-    int sinValue512, cosValue512;
-    int* gfxData = tile128x128.gfxDataPos;
-    uint8_t* tileDirections = tile128x128.direction;
-    int layerWidth = stageLayouts[activeTileLayers[layerNum]].xSize << 7;
-    int layerHeight = stageLayouts[activeTileLayers[layerNum]].ySize << 7;
-    unsigned short* currentTileMap = stageLayouts[activeTileLayers[layerNum]].tileMap;
-    vertexSize3D = 0;
-    indexSize3D = 0;
+    int sinValue512 = job->floorX;
+    int cosValue512 = job->floorZ;
+    int* gfxData = job->gfxDataPos;
+    uint8_t* tileDirections = job->direction;
+    int layerWidth = job->xSize;
+    int layerHeight = job->ySize;
+    unsigned short* currentTileMap = job->tileMap;
+    float* tileUVs = job->tileUVs;
+    struct DrawVertex3D* vertices = job->vertices3D;
+    int vertexCount = 0;
+    int indexCount = 0;
     //Draw full floor (low detail version)
-    polyList3D[vertexSize3D].position.X = 0.0f;
-    polyList3D[vertexSize3D].position.Y = 0.0f;
-    polyList3D[vertexSize3D].position.Z = 0.0f;
-    polyList3D[vertexSize3D].texCoord.X = 512.0f;
-    polyList3D[vertexSize3D].texCoord.Y = 0.0f;
-    polyList3D[vertexSize3D].color.R = 0xff;
-    polyList3D[vertexSize3D].color.G = 0xff;
-    polyList3D[vertexSize3D].color.B = 0xff;
-    polyList3D[vertexSize3D].color.A = 0xff;
-    vertexSize3D = (uint16_t)(vertexSize3D + 1);
-    polyList3D[vertexSize3D].position.X = 4096.0f;
-    polyList3D[vertexSize3D].position.Y = 0.0f;
-    polyList3D[vertexSize3D].position.Z = 0.0f;
-    polyList3D[vertexSize3D].texCoord.X = 1024.0f;
-    polyList3D[vertexSize3D].texCoord.Y = 0.0f;
-    polyList3D[vertexSize3D].color.R = 0xff;
-    polyList3D[vertexSize3D].color.G = 0xff;
-    polyList3D[vertexSize3D].color.B = 0xff;
-    polyList3D[vertexSize3D].color.A = 0xff;
-    vertexSize3D = (uint16_t)(vertexSize3D + 1);
-    polyList3D[vertexSize3D].position.X = 0.0f;
-    polyList3D[vertexSize3D].position.Y = 0.0f;
-    polyList3D[vertexSize3D].position.Z = 4096.0f;
-    polyList3D[vertexSize3D].texCoord.X = 512.0f;
-    polyList3D[vertexSize3D].texCoord.Y = 512.0f;
-    polyList3D[vertexSize3D].color.R = 0xff;
-    polyList3D[vertexSize3D].color.G = 0xff;
-    polyList3D[vertexSize3D].color.B = 0xff;
-    polyList3D[vertexSize3D].color.A = 0xff;
-    vertexSize3D = (uint16_t)(vertexSize3D + 1);
-    polyList3D[vertexSize3D].position.X = 4096.0f;
-    polyList3D[vertexSize3D].position.Y = 0.0f;
-    polyList3D[vertexSize3D].position.Z = 4096.0f;
-    polyList3D[vertexSize3D].texCoord.X = 1024.0f;
-    polyList3D[vertexSize3D].texCoord.Y = 512.0f;
-    polyList3D[vertexSize3D].color.R = 0xff;
-    polyList3D[vertexSize3D].color.G = 0xff;
-    polyList3D[vertexSize3D].color.B = 0xff;
-    polyList3D[vertexSize3D].color.A = 0xff;
-    vertexSize3D = (uint16_t)(vertexSize3D + 1);
-    indexSize3D = (uint16_t)(indexSize3D + 6);
+    vertices[vertexCount].position.X = 0.0f;
+    vertices[vertexCount].position.Y = 0.0f;
+    vertices[vertexCount].position.Z = 0.0f;
+    vertices[vertexCount].texCoord.X = 512.0f;
+    vertices[vertexCount].texCoord.Y = 0.0f;
+    vertices[vertexCount].color.R = 0xff;
+    vertices[vertexCount].color.G = 0xff;
+    vertices[vertexCount].color.B = 0xff;
+    vertices[vertexCount].color.A = 0xff;
+    vertexCount = vertexCount + 1;
+    vertices[vertexCount].position.X = 4096.0f;
+    vertices[vertexCount].position.Y = 0.0f;
+    vertices[vertexCount].position.Z = 0.0f;
+    vertices[vertexCount].texCoord.X = 1024.0f;
+    vertices[vertexCount].texCoord.Y = 0.0f;
+    vertices[vertexCount].color.R = 0xff;
+    vertices[vertexCount].color.G = 0xff;
+    vertices[vertexCount].color.B = 0xff;
+    vertices[vertexCount].color.A = 0xff;
+    vertexCount = vertexCount + 1;
+    vertices[vertexCount].position.X = 0.0f;
+    vertices[vertexCount].position.Y = 0.0f;
+    vertices[vertexCount].position.Z = 4096.0f;
+    vertices[vertexCount].texCoord.X = 512.0f;
+    vertices[vertexCount].texCoord.Y = 512.0f;
+    vertices[vertexCount].color.R = 0xff;
+    vertices[vertexCount].color.G = 0xff;
+    vertices[vertexCount].color.B = 0xff;
+    vertices[vertexCount].color.A = 0xff;
+    vertexCount = vertexCount + 1;
+    vertices[vertexCount].position.X = 4096.0f;
+    vertices[vertexCount].position.Y = 0.0f;
+    vertices[vertexCount].position.Z = 4096.0f;
+    vertices[vertexCount].texCoord.X = 1024.0f;
+    vertices[vertexCount].texCoord.Y = 512.0f;
+    vertices[vertexCount].color.R = 0xff;
+    vertices[vertexCount].color.G = 0xff;
+    vertices[vertexCount].color.B = 0xff;
+    vertices[vertexCount].color.A = 0xff;
+    vertexCount = vertexCount + 1;
+    indexCount = indexCount + 6;
     //Draw nearby detailed floor
-    if (HQ3DFloorEnabled)
+    if (job->detailedFloor)
     {
-        sinValue512 = (stageLayouts[activeTileLayers[layerNum]].xPos >> 16) - 0x100;
-        sinValue512 = sinValue512 + (SinValue512[stageLayouts[activeTileLayers[layerNum]].angle] >> 1);
-        sinValue512 = sinValue512 >> 4 << 4;
-        cosValue512 = (stageLayouts[activeTileLayers[layerNum]].zPos >> 16) - 0x100;
-        cosValue512 = cosValue512 + (CosValue512[stageLayouts[activeTileLayers[layerNum]].angle] >> 1);
-        cosValue512 = cosValue512 >> 4 << 4;
         for (int i = 32; i > 0; i--)
         {
             for (int j = 32; j > 0; j--)
@@ -162,194 +228,194 @@ void StageSystem_Draw3DFloorLayer(uint8_t layerNum)
                         {
                             case 0:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                             case 1:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                             case 2:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                             case 3:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                         }
@@ -363,12 +429,6 @@ void StageSystem_Draw3DFloorLayer(uint8_t layerNum)
     }
     else
     {
-        sinValue512 = (stageLayouts[activeTileLayers[layerNum]].xPos >> 16) - 160;
-        sinValue512 = sinValue512 + SinValue512[stageLayouts[activeTileLayers[layerNum]].angle] / 3;
-        sinValue512 = sinValue512 >> 4 << 4;
-        cosValue512 = (stageLayouts[activeTileLayers[layerNum]].zPos >> 16) - 160;
-        cosValue512 = cosValue512 + CosValue512[stageLayouts[activeTileLayers[layerNum]].angle] / 3;
-        cosValue512 = cosValue512 >> 4 << 4;
         for (int i = 20; i > 0; i--)
         {
             for (int j = 20; j > 0; j--)
@@ -388,194 +448,194 @@ void StageSystem_Draw3DFloorLayer(uint8_t layerNum)
                         {
                             case 0:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                             case 1:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                             case 2:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                             case 3:
                             {
-                                polyList3D[vertexSize3D].position.X = (float)(sinValue512 + 16);
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)(cosValue512 + 16);
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].position.X = (float)(sinValue512 + 16);
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)(cosValue512 + 16);
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = (float)sinValue512;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = tileUVArray[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = (float)sinValue512;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = tileUVs[gfxData[tileIndex] + tileOffset];
                                 tileOffset++;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = (float)cosValue512;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = tileUVArray[gfxData[tileIndex] + tileOffset];
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                polyList3D[vertexSize3D].position.X = polyList3D[vertexSize3D - 2].position.X;
-                                polyList3D[vertexSize3D].position.Y = 0.0f;
-                                polyList3D[vertexSize3D].position.Z = polyList3D[vertexSize3D - 1].position.Z;
-                                polyList3D[vertexSize3D].texCoord.X = polyList3D[vertexSize3D - 2].texCoord.X;
-                                polyList3D[vertexSize3D].texCoord.Y = polyList3D[vertexSize3D - 1].texCoord.Y;
-                                polyList3D[vertexSize3D].color.R = 0xff;
-                                polyList3D[vertexSize3D].color.G = 0xff;
-                                polyList3D[vertexSize3D].color.B = 0xff;
-                                polyList3D[vertexSize3D].color.A = 0xff;
-                                vertexSize3D = (uint16_t)(vertexSize3D + 1);
-                                indexSize3D = (uint16_t)(indexSize3D + 6);
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = (float)cosValue512;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = tileUVs[gfxData[tileIndex] + tileOffset];
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                vertices[vertexCount].position.X = vertices[vertexCount - 2].position.X;
+                                vertices[vertexCount].position.Y = 0.0f;
+                                vertices[vertexCount].position.Z = vertices[vertexCount - 1].position.Z;
+                                vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                                vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                                vertices[vertexCount].color.R = 0xff;
+                                vertices[vertexCount].color.G = 0xff;
+                                vertices[vertexCount].color.B = 0xff;
+                                vertices[vertexCount].color.A = 0xff;
+                                vertexCount = vertexCount + 1;
+                                indexCount = indexCount + 6;
                                 break;
                             }
                         }
@@ -587,38 +647,45 @@ void StageSystem_Draw3DFloorLayer(uint8_t layerNum)
             cosValue512 = cosValue512 + 16;
         }
     }
-    floor3DPos.X = (float)(stageLayouts[activeTileLayers[layerNum]].xPos >> 8) * -0.00390625f;
-    floor3DPos.Y = (float)(stageLayouts[activeTileLayers[layerNum]].yPos >> 8) * 0.00390625f;
-    floor3DPos.Z = (float)(stageLayouts[activeTileLayers[layerNum]].zPos >> 8) * -0.00390625f;
-    floor3DAngle = (float)stageLayouts[activeTileLayers[layerNum]].angle / 512.0f * -360.0f;
-    render3DEnabled = true;
+    job->vertexCount = vertexCount;
+    job->indexCount = indexCount;
 }
 
 void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
+{
+    struct TileLayerJob job;
+    StageSystem_PrepareHLineScrollLayer8(layerNum, &job);
+    if (skipFrameDraw)
+    {
+        return;
+    }
+    job.vertices = &gfxPolyList[gfxVertexSize];
+    StageSystem_BuildHLineScrollLayer8(&job);
+    if (renderInterpolation)
+    {
+        StageSystem_AddLayerInterpolationSpans(&job, gfxVertexSize);
+    }
+    gfxVertexSize = (unsigned short)(gfxVertexSize + job.vertexCount);
+    gfxIndexSize = (unsigned short)(gfxIndexSize + job.indexCount);
+}
+
+void StageSystem_PrepareHLineScrollLayer8(uint8_t layerNum, struct TileLayerJob* job)
 {
     uint16_t* tileMap;
     uint8_t* lineScrollRef;
-    int parallaxPosX;
-    int parallaxBlockX;
-    int gfxIndex;
     int parallaxOffsetY;
-    int tileUvOffset;
-    int deformX1;
-    int deformX2;
     int i;
     uint8_t highPlane;
     int* bgDeformationA;
     int* bgDeformationB;
     int deformationX;
     int deformationY;
-    int parallaxIdx = 0;
     int* gfxDataPos = tile128x128.gfxDataPos;
     uint8_t* direction = tile128x128.direction;
     uint8_t* visualPlane = tile128x128.visualPlane;
     int xSize = stageLayouts[activeTileLayers[layerNum]].xSize;
     int ySize = stageLayouts[activeTileLayers[layerNum]].ySize;
     int sCREENXSIZE = (SCREEN_XSIZE >> 4) + 3;
-    bool flag = false;
     highPlane = (uint8_t)((layerNum < tLayerMidPoint ? 0 : 1));
     if (activeTileLayers[layerNum] != 0)
     {
@@ -678,6 +745,76 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
     else if (layoutType != 5)
     {
     }
+    job->layerNum = layerNum;
+    job->type = layoutType;
+    job->tileMap = tileMap;
+    job->lineScrollRef = lineScrollRef;
+    job->gfxDataPos = gfxDataPos;
+    job->direction = direction;
+    job->visualPlane = visualPlane;
+    job->tileUVs = tileUVArray;
+    //The next layer's scroll update can move the line positions again, and draw scripts can rewrite
+    //the deformation tables while the layers build, so the build keeps its own copy of both
+    memcpy(job->bgDeformationA, bgDeformationA, sizeof(job->bgDeformationA));
+    memcpy(job->bgDeformationB, bgDeformationB, sizeof(job->bgDeformationB));
+    memcpy(job->linePos, hParallax.linePos, sizeof(job->linePos));
+    memcpy(job->deformationEnabled, hParallax.deformationEnabled, sizeof(job->deformationEnabled));
+    if (renderInterpolation)
+    {
+        //Every layer moves by its own scroll, so each layout keeps where its lines were on the last step
+        int* lastLinePos = layerLinePos[activeTileLayers[layerNum]];
+        for (i = 0; i < 256; i++)
+        {
+            job->lineDeltaX[i] = lastLinePos[i] - hParallax.linePos[i];
+        }
+        job->deltaY = layerParallaxOffsetY[activeTileLayers[layerNum]] - parallaxOffsetY;
+        memcpy(lastLinePos, hParallax.linePos, sizeof(hParallax.linePos));
+        layerParallaxOffsetY[activeTileLayers[layerNum]] = parallaxOffsetY;
+    }
+    job->xSize = xSize;
+    job->ySize = ySize;
+    job->screenTiles = sCREENXSIZE;
+    job->highPlane = highPlane;
+    job->parallaxOffsetY = parallaxOffsetY;
+    job->deformationX = deformationX;
+    job->deformationY = deformationY;
+    job->waterDrawPos = waterDrawPos;
+    job->vertices = NULL;
+}
+
+void StageSystem_BuildHLineScrollLayer8(struct TileLayerJob* job)
+{
+    int parallaxPosX;
+    int parallaxBlockX;
+    int gfxIndex;
+    int tileUvOffset;
+    int deformX1;
+    int deformX2;
+    int i;
+    int parallaxIdx = 0;
+    bool flag = false;
+    uint16_t* tileMap = job->tileMap;
+    uint8_t* lineScrollRef = job->lineScrollRef;
+    int* gfxDataPos = job->gfxDataPos;
+    uint8_t* direction = job->direction;
+    uint8_t* visualPlane = job->visualPlane;
+    float* tileUVs = job->tileUVs;
+    int* bgDeformationA = job->bgDeformationA;
+    int* bgDeformationB = job->bgDeformationB;
+    int* linePos = job->linePos;
+    uint8_t* deformationEnabled = job->deformationEnabled;
+    int xSize = job->xSize;
+    int ySize = job->ySize;
+    int sCREENXSIZE = job->screenTiles;
+    uint8_t highPlane = job->highPlane;
+    int parallaxOffsetY = job->parallaxOffsetY;
+    int deformationX = job->deformationX;
+    int deformationY = job->deformationY;
+    int waterPos = job->waterDrawPos << 4;
+    struct DrawVertex* vertices = job->vertices;
+    int vertexCount = 0;
+    int indexCount = 0;
+    int numRows = 0;
     if (parallaxOffsetY < 0)
     {
         parallaxOffsetY = parallaxOffsetY + (ySize << 7);
@@ -697,26 +834,29 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
     deformY = -(parallaxOffsetY & 15);
     int parallaxPosY = parallaxOffsetY >> 7;
     int parallaxBlockY = (parallaxOffsetY & 127) >> 4;
-    waterDrawPos = waterDrawPos << 4;
     deformY = deformY << 4;
     for (int j = (deformY != 0 ? 0x110 : 0x100); j > 0; j = j - 16)
     {
-        int parallaxLinePos = hParallax.linePos[lineScrollRef[parallaxIdx]] - 16;
+        //Rows are noted with the line they scroll by, so interpolation can move each with its own scroll
+        job->rowLine[numRows] = lineScrollRef[parallaxIdx];
+        job->rowVertexStart[numRows] = vertexCount;
+        numRows++;
+        int parallaxLinePos = linePos[lineScrollRef[parallaxIdx]] - 16;
         parallaxIdx = parallaxIdx + 8;
-        if (parallaxLinePos != hParallax.linePos[lineScrollRef[parallaxIdx]] - 16)
+        if (parallaxLinePos != linePos[lineScrollRef[parallaxIdx]] - 16)
         {
             flag = true;
         }
-        else if (hParallax.deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
+        else if (deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
         {
             flag = false;
         }
         else
         {
-            deformX1 = (deformY < waterDrawPos ? bgDeformationA[deformationX] : bgDeformationB[deformationY]);
+            deformX1 = (deformY < waterPos ? bgDeformationA[deformationX] : bgDeformationB[deformationY]);
             deformationX = deformationX + 8;
             deformationY = deformationY + 8;
-            deformX2 = (deformY + 64 <= waterDrawPos ? bgDeformationA[deformationX] : bgDeformationB[deformationY]);
+            deformX2 = (deformY + 64 <= waterPos ? bgDeformationA[deformationX] : bgDeformationB[deformationY]);
             flag = (deformX1 != deformX2 ? true : false);
             deformationX = deformationX - 8;
             deformationY = deformationY - 8;
@@ -738,17 +878,17 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
             deformX1 = -((parallaxLinePos & 15) << 4);
             deformX1 = deformX1 - 0x100;
             deformX2 = deformX1;
-            if (hParallax.deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
+            if (deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
             {
                 deformationX = deformationX + 16;
                 deformationY = deformationY + 16;
             }
             else
             {
-                deformX1 = (deformY < waterDrawPos ? deformX1 - bgDeformationA[deformationX] : deformX1 - bgDeformationB[deformationY]);
+                deformX1 = (deformY < waterPos ? deformX1 - bgDeformationA[deformationX] : deformX1 - bgDeformationB[deformationY]);
                 deformationX = deformationX + 16;
                 deformationY = deformationY + 16;
-                deformX2 = (deformY + 128 <= waterDrawPos ? deformX2 - bgDeformationA[deformationX] : deformX2 - bgDeformationB[deformationY]);
+                deformX2 = (deformY + 128 <= waterPos ? deformX2 - bgDeformationA[deformationX] : deformX2 - bgDeformationB[deformationY]);
             }
             parallaxIdx = parallaxIdx + 16;
             gfxIndex = (parallaxPosX <= -1 || parallaxPosY <= -1 ? 0 : tileMap[parallaxPosX + (parallaxPosY << 8)] << 6);
@@ -762,178 +902,178 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
                     {
                         case 0:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 0x100);
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 0x100);
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 1:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 0x100);
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 0x100);
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 2:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 0x100);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 0x100);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 0x100);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 0x100);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 3:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 0x100);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 0x100);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 0x100);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 0x100);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                     }
@@ -975,17 +1115,17 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
             deformX1 = -((parallaxLinePos & 15) << 4);
             deformX1 = deformX1 - 0x100;
             deformX2 = deformX1;
-            if (hParallax.deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
+            if (deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
             {
                 deformationX = deformationX + 8;
                 deformationY = deformationY + 8;
             }
             else
             {
-                deformX1 = (deformY < waterDrawPos ? deformX1 - bgDeformationA[deformationX] : deformX1 - bgDeformationB[deformationY]);
+                deformX1 = (deformY < waterPos ? deformX1 - bgDeformationA[deformationX] : deformX1 - bgDeformationB[deformationY]);
                 deformationX = deformationX + 8;
                 deformationY = deformationY + 8;
-                deformX2 = (deformY + 64 <= waterDrawPos ? deformX2 - bgDeformationA[deformationX] : deformX2 - bgDeformationB[deformationY]);
+                deformX2 = (deformY + 64 <= waterPos ? deformX2 - bgDeformationA[deformationX] : deformX2 - bgDeformationB[deformationY]);
             }
             parallaxIdx = parallaxIdx + 8;
             gfxIndex = (parallaxPosX <= -1 || parallaxPosY <= -1 ? 0 : tileMap[parallaxPosX + (parallaxPosY << 8)] << 6);
@@ -999,178 +1139,178 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
                     {
                         case 0:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 1:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 2:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 3:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                     }
@@ -1195,7 +1335,10 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
                 }
             }
             deformY = deformY + 128;
-            parallaxLinePos = hParallax.linePos[lineScrollRef[parallaxIdx]] - 16;
+            job->rowLine[numRows] = lineScrollRef[parallaxIdx];
+            job->rowVertexStart[numRows] = vertexCount;
+            numRows++;
+            parallaxLinePos = linePos[lineScrollRef[parallaxIdx]] - 16;
             i = xSize << 7;
             if (parallaxLinePos < 0)
             {
@@ -1210,17 +1353,17 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
             deformX1 = -((parallaxLinePos & 15) << 4);
             deformX1 = deformX1 - 0x100;
             deformX2 = deformX1;
-            if (hParallax.deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
+            if (deformationEnabled[lineScrollRef[parallaxIdx]] != 1)
             {
                 deformationX = deformationX + 8;
                 deformationY = deformationY + 8;
             }
             else
             {
-                deformX1 = (deformY < waterDrawPos ? deformX1 - bgDeformationA[deformationX] : deformX1 - bgDeformationB[deformationY]);
+                deformX1 = (deformY < waterPos ? deformX1 - bgDeformationA[deformationX] : deformX1 - bgDeformationB[deformationY]);
                 deformationX = deformationX + 8;
                 deformationY = deformationY + 8;
-                deformX2 = (deformY + 64 <= waterDrawPos ? deformX2 - bgDeformationA[deformationX] : deformX2 - bgDeformationB[deformationY]);
+                deformX2 = (deformY + 64 <= waterPos ? deformX2 - bgDeformationA[deformationX] : deformX2 - bgDeformationB[deformationY]);
             }
             parallaxIdx = parallaxIdx + 8;
             gfxIndex = (parallaxPosX <= -1 || parallaxPosY <= -1 ? 0 : tileMap[parallaxPosX + (parallaxPosY << 8)] << 6);
@@ -1234,178 +1377,178 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
                     {
                         case 0:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 1:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] + 8;
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = (uint16_t)(gfxIndexSize + 6);
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 2:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                         case 3:
                         {
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX2 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].position.X = (float)(deformX2 + 0x100);
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX2;
-                            gfxPolyList[gfxVertexSize].position.Y = (float)(deformY + 128);
-                            gfxPolyList[gfxVertexSize].texCoord.X = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset];
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX2;
+                            vertices[vertexCount].position.Y = (float)(deformY + 128);
+                            vertices[vertexCount].texCoord.X = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset];
                             tileUvOffset++;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)(deformX1 + 0x100);
-                            gfxPolyList[gfxVertexSize].position.Y = (float)deformY;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = tileUVArray[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxPolyList[gfxVertexSize].position.X = (float)deformX1;
-                            gfxPolyList[gfxVertexSize].position.Y = gfxPolyList[gfxVertexSize - 1].position.Y;
-                            gfxPolyList[gfxVertexSize].texCoord.X = gfxPolyList[gfxVertexSize - 2].texCoord.X;
-                            gfxPolyList[gfxVertexSize].texCoord.Y = gfxPolyList[gfxVertexSize - 1].texCoord.Y;
-                            gfxPolyList[gfxVertexSize].color.R = 0xff;
-                            gfxPolyList[gfxVertexSize].color.G = 0xff;
-                            gfxPolyList[gfxVertexSize].color.B = 0xff;
-                            gfxPolyList[gfxVertexSize].color.A = 0xff;
-                            gfxVertexSize = gfxVertexSize + 1;
-                            gfxIndexSize = gfxIndexSize + 6;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)(deformX1 + 0x100);
+                            vertices[vertexCount].position.Y = (float)deformY;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = tileUVs[gfxDataPos[gfxIndex] + tileUvOffset] - 8;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            vertices[vertexCount].position.X = (float)deformX1;
+                            vertices[vertexCount].position.Y = vertices[vertexCount - 1].position.Y;
+                            vertices[vertexCount].texCoord.X = vertices[vertexCount - 2].texCoord.X;
+                            vertices[vertexCount].texCoord.Y = vertices[vertexCount - 1].texCoord.Y;
+                            vertices[vertexCount].color.R = 0xff;
+                            vertices[vertexCount].color.G = 0xff;
+                            vertices[vertexCount].color.B = 0xff;
+                            vertices[vertexCount].color.A = 0xff;
+                            vertexCount = vertexCount + 1;
+                            indexCount = indexCount + 6;
                             break;
                         }
                     }
@@ -1443,7 +1586,25 @@ void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum)
             parallaxBlockY = 0;
         }
     }
-    waterDrawPos = waterDrawPos >> 4;
+    job->vertexCount = vertexCount;
+    job->indexCount = indexCount;
+    job->numRows = numRows;
+}
+
+void StageSystem_AddLayerInterpolationSpans(struct TileLayerJob* job, int vertexStart)
+{
+    //Neighbouring rows on the same line scroll share a span
+    int rowStart = 0;
+    int rowEnd;
+    for (int i = 1; i <= job->numRows; i++)
+    {
+        if (i == job->numRows || job->lineDeltaX[job->rowLine[i]] != job->lineDeltaX[job->rowLine[rowStart]])
+        {
+            rowEnd = i < job->numRows ? job->rowVertexStart[i] : job->vertexCount;
+            GraphicsSystem_AddInterpolationSpan(vertexStart + job->rowVertexStart[rowStart], vertexStart + rowEnd, job->lineDeltaX[job->rowLine[rowStart]], job->deltaY);
+            rowStart = i;
+        }
+    }
 }
 
 void StageSystem_DrawStageGfx()
@@ -1459,6 +1620,12 @@ void StageSystem_DrawStageGfx()
     {
         waterDrawPos = 0x100;
     }
+    //A skipped frame still runs the draw scripts and scroll updates, only the layer vertices are left out
+    if (parallelTileLayers && !skipFrameDraw && StageSystem_StartTileLayerWorkers())
+    {
+        StageSystem_DrawStageGfxParallel();
+        return;
+    }
     ObjectSystem_DrawObjectList(0);
     if (activeTileLayers[0] < 9)
     {
@@ -1554,6 +1721,294 @@ void StageSystem_DrawStageGfx()
     ObjectSystem_DrawObjectList(6);
 }
 
+void StageSystem_DrawStageGfxParallel()
+{
+    //Object lists each layer is drawn after, layer 3 sits between lists 4 and 5
+    int layerObjectList[4] = { 0, 1, 2, 4 };
+    int objectVertexEnd[7];
+    int objectIndexEnd[7];
+    int objectSpanEnd[7];
+    int layerVertices[4] = { 0, 0, 0, 0 };
+    int layerIndices[4] = { 0, 0, 0, 0 };
+    struct TileLayerJob* layerJobs[4] = { NULL, NULL, NULL, NULL };
+    struct TileLayerJob* floorJob = NULL;
+    int layerVertexTotal = 0;
+    int layerIndexTotal = 0;
+    int vertexShift;
+    int chunkStart;
+    int chunkEnd;
+    int i;
+
+    //Scroll positions are still advanced in layer order here, only the vertex building is spread out
+    tileLayerQueue.numJobs = 0;
+    for (i = 0; i < 4; i++)
+    {
+        if (activeTileLayers[i] < 9)
+        {
+            switch (stageLayouts[activeTileLayers[i]].type)
+            {
+                case 1:
+                {
+                    struct TileLayerJob* job = &tileLayerQueue.jobs[tileLayerQueue.numJobs];
+                    StageSystem_PrepareHLineScrollLayer8((uint8_t)i, job);
+                    job->vertices = &tileLayerVertices[i * VERTEX_LIMIT];
+                    tileLayerQueue.numJobs++;
+                    break;
+                }
+                case 3:
+                case 4:
+                {
+                    //Every floor layer rebuilds polyList3D from the start, so only the last one needs building
+                    if (floorJob == NULL)
+                    {
+                        floorJob = &tileLayerQueue.jobs[tileLayerQueue.numJobs];
+                        tileLayerQueue.numJobs++;
+                    }
+                    StageSystem_Prepare3DFloorLayer((uint8_t)i, floorJob);
+                    break;
+                }
+            }
+        }
+    }
+    tileLayerQueue.numWorkers = tileLayerQueue.numJobs < numTileLayerThreads ? tileLayerQueue.numJobs : numTileLayerThreads;
+    tileLayerQueue.running = true;
+    SDL_AtomicSet(&tileLayerQueue.nextJob, 0);
+    for (i = 0; i < tileLayerQueue.numWorkers; i++)
+    {
+        SDL_SemPost(tileLayerQueue.start);
+    }
+
+    //Objects go into gfxPolyList back to back while the layers build, the gaps are opened up afterwards
+    for (i = 0; i < 7; i++)
+    {
+        ObjectSystem_DrawObjectList(i);
+        objectVertexEnd[i] = gfxVertexSize;
+        objectIndexEnd[i] = gfxIndexSize;
+        objectSpanEnd[i] = numInterpolationSpans;
+    }
+    StageSystem_FinishTileLayerJobs();
+
+    for (i = 0; i < tileLayerQueue.numJobs; i++)
+    {
+        struct TileLayerJob* job = &tileLayerQueue.jobs[i];
+        if (job == floorJob)
+        {
+            vertexSize3D = (uint16_t)job->vertexCount;
+            indexSize3D = (uint16_t)job->indexCount;
+        }
+        else
+        {
+            layerJobs[job->layerNum] = job;
+            layerVertices[job->layerNum] = job->vertexCount;
+            layerIndices[job->layerNum] = job->indexCount;
+            layerVertexTotal = layerVertexTotal + job->vertexCount;
+            layerIndexTotal = layerIndexTotal + job->indexCount;
+        }
+    }
+
+    //Stitch from the back so every object run only moves once
+    vertexShift = layerVertexTotal;
+    chunkEnd = objectVertexEnd[6];
+    for (i = 3; i >= 0; i--)
+    {
+        chunkStart = objectVertexEnd[layerObjectList[i]];
+        StageSystem_PlaceVertices(chunkStart + vertexShift, &gfxPolyList[chunkStart], chunkEnd - chunkStart);
+        vertexShift = vertexShift - layerVertices[i];
+        StageSystem_PlaceVertices(chunkStart + vertexShift, &tileLayerVertices[i * VERTEX_LIMIT], layerVertices[i]);
+        chunkEnd = chunkStart;
+    }
+    if (renderInterpolation)
+    {
+        StageSystem_StitchInterpolationSpans(objectVertexEnd, objectSpanEnd, layerObjectList, layerJobs);
+    }
+    if (objectVertexEnd[6] + layerVertexTotal > VERTEX_LIMIT)
+    {
+        gfxVertexSize = VERTEX_LIMIT;
+        gfxIndexSize = VERTEX_LIMIT / 4 * 6;
+    }
+    else
+    {
+        gfxVertexSize = (unsigned short)(objectVertexEnd[6] + layerVertexTotal);
+        gfxIndexSize = (unsigned short)(objectIndexEnd[6] + layerIndexTotal);
+    }
+    gfxVertexSizeOpaque = (unsigned short)(objectVertexEnd[0] + layerVertices[0]);
+    gfxIndexSizeOpaque = (unsigned short)(objectIndexEnd[0] + layerIndices[0]);
+    if (gfxVertexSizeOpaque > gfxVertexSize)
+    {
+        gfxVertexSizeOpaque = gfxVertexSize;
+        gfxIndexSizeOpaque = gfxIndexSize;
+    }
+}
+
+void StageSystem_StitchInterpolationSpans(int* objectVertexEnd, int* objectSpanEnd, int* layerObjectList, struct TileLayerJob** layerJobs)
+{
+    int layerStart[4];
+    int vertexShift = 0;
+    int spanStart = 0;
+    int i;
+    int j;
+
+    //Object spans were recorded against the compact lists, move them along with their runs
+    for (i = 0; i < 7; i++)
+    {
+        for (j = spanStart; j < objectSpanEnd[i]; j++)
+        {
+            interpolationSpans[j].vertexStart = (unsigned short)(interpolationSpans[j].vertexStart + vertexShift);
+            interpolationSpans[j].vertexEnd = (unsigned short)(interpolationSpans[j].vertexEnd + vertexShift);
+        }
+        spanStart = objectSpanEnd[i];
+        for (j = 0; j < 4; j++)
+        {
+            if (layerObjectList[j] == i && layerJobs[j] != NULL)
+            {
+                layerStart[j] = objectVertexEnd[i] + vertexShift;
+                vertexShift = vertexShift + layerJobs[j]->vertexCount;
+            }
+        }
+    }
+    for (i = 0; i < 4; i++)
+    {
+        if (layerJobs[i] != NULL)
+        {
+            StageSystem_AddLayerInterpolationSpans(layerJobs[i], layerStart[i]);
+        }
+    }
+}
+
+void StageSystem_StartInterpolationFrame()
+{
+    //Taken before the step runs, so the draws it makes can tell how far everything moved
+    prevXScrollOffset = xScrollOffset;
+    prevYScrollOffset = yScrollOffset;
+    memcpy(objectEntityPrevXPos, objectEntityXPos, sizeof(objectEntityXPos));
+    memcpy(objectEntityPrevYPos, objectEntityYPos, sizeof(objectEntityYPos));
+}
+
+void StageSystem_PlaceVertices(int vertexPos, struct DrawVertex* vertices, int count)
+{
+    if (vertexPos + count > VERTEX_LIMIT)
+    {
+        count = VERTEX_LIMIT - vertexPos;
+    }
+    if (count > 0)
+    {
+        memmove(&gfxPolyList[vertexPos], vertices, count * sizeof(struct DrawVertex));
+    }
+}
+
+void StageSystem_RunTileLayerJobs(struct TileLayerQueue* queue)
+{
+    //Called on the workers too, so nothing here may touch the engine globals directly
+    int jobNum = SDL_AtomicAdd(&queue->nextJob, 1);
+    while (jobNum < queue->numJobs)
+    {
+        struct TileLayerJob* job = &queue->jobs[jobNum];
+        if (job->type == 1)
+        {
+            StageSystem_BuildHLineScrollLayer8(job);
+        }
+        else
+        {
+            StageSystem_Build3DFloorLayer(job);
+        }
+        jobNum = SDL_AtomicAdd(&queue->nextJob, 1);
+    }
+}
+
+void StageSystem_FinishTileLayerJobs()
+{
+    //Also called before a draw script edits the tiles, the layers in flight were started from the old ones
+    if (!tileLayerQueue.running)
+    {
+        return;
+    }
+    StageSystem_RunTileLayerJobs(&tileLayerQueue);
+    for (int i = 0; i < tileLayerQueue.numWorkers; i++)
+    {
+        SDL_SemWait(tileLayerQueue.done);
+    }
+    tileLayerQueue.running = false;
+}
+
+bool StageSystem_StartTileLayerWorkers()
+{
+    if (numTileLayerThreads > 0)
+    {
+        return true;
+    }
+    //The workers stay up between frames, a new thread per frame costs more than the layers themselves
+    int numThreads = SDL_GetCPUCount() - 1;
+    if (numThreads > TILE_LAYER_THREADS)
+    {
+        numThreads = TILE_LAYER_THREADS;
+    }
+    if (numThreads > 0)
+    {
+        tileLayerVertices = (struct DrawVertex*)malloc(sizeof(struct DrawVertex) * VERTEX_LIMIT * 4);
+        tileLayerQueue.start = SDL_CreateSemaphore(0);
+        tileLayerQueue.done = SDL_CreateSemaphore(0);
+        tileLayerQueue.quit = false;
+        if (tileLayerVertices != NULL && tileLayerQueue.start != NULL && tileLayerQueue.done != NULL)
+        {
+            for (int i = 0; i < numThreads; i++)
+            {
+                tileLayerThreads[numTileLayerThreads] = SDL_CreateThread(StageSystem_TileLayerWorker, "TileLayer", &tileLayerQueue);
+                if (tileLayerThreads[numTileLayerThreads] == NULL)
+                {
+                    break;
+                }
+                numTileLayerThreads++;
+            }
+        }
+    }
+    if (numTileLayerThreads == 0)
+    {
+        //Nothing to spread the layers over, fall back to drawing them in turn
+        StageSystem_StopTileLayerWorkers();
+        parallelTileLayers = false;
+        return false;
+    }
+    return true;
+}
+
+void StageSystem_StopTileLayerWorkers()
+{
+    tileLayerQueue.quit = true;
+    for (int i = 0; i < numTileLayerThreads; i++)
+    {
+        SDL_SemPost(tileLayerQueue.start);
+    }
+    for (int i = 0; i < numTileLayerThreads; i++)
+    {
+        SDL_WaitThread(tileLayerThreads[i], NULL);
+        tileLayerThreads[i] = NULL;
+    }
+    numTileLayerThreads = 0;
+    if (tileLayerQueue.start != NULL)
+    {
+        SDL_DestroySemaphore(tileLayerQueue.start);
+        tileLayerQueue.start = NULL;
+    }
+    if (tileLayerQueue.done != NULL)
+    {
+        SDL_DestroySemaphore(tileLayerQueue.done);
+        tileLayerQueue.done = NULL;
+    }
+    free(tileLayerVertices);
+    tileLayerVertices = NULL;
+}
+
+int StageSystem_TileLayerWorker(void* data)
+{
+    struct TileLayerQueue* queue = (struct TileLayerQueue*)data;
+    while (SDL_SemWait(queue->start) == 0 && !queue->quit)
+    {
+        StageSystem_RunTileLayerJobs(queue);
+        SDL_SemPost(queue->done);
+    }
+    return 0;
+}
+
 void StageSystem_InitErrorMessage()
 {
     xScrollOffset = 0;
@@ -1566,6 +2021,7 @@ void StageSystem_InitErrorMessage()
     gameMode = 0;
     GraphicsSystem_ClearGraphicsData();
     AnimationSystem_ClearAnimationData();
+    stageSnapshot.valid = false;
     GraphicsSystem_LoadPalette("MasterPalette.act", 0, 0, 0, 0x100);
     textMenuSurfaceNo = 0;
     GraphicsSystem_LoadGIFFile("Data/Game/SystemText.gif", 0);
@@ -1589,6 +2045,7 @@ void StageSystem_InitFirstStage()
     playerMenuNum = 0;
     GraphicsSystem_ClearGraphicsData();
     AnimationSystem_ClearAnimationData();
+    stageSnapshot.valid = false;
     GraphicsSystem_LoadPalette("MasterPalette.act", 0, 0, 0, 0x100);
     activeStageList = PRESENTATION_STAGE; //0 - Presentation, 1 - Zone, 2 - Bonus (Desert Dazzle), 3 - Special Stage
     stageMode = 0;
@@ -1608,6 +2065,7 @@ void StageSystem_InitStageSelectMenu()
     gameMode = 0;
     GraphicsSystem_ClearGraphicsData();
     AnimationSystem_ClearAnimationData();
+    stageSnapshot.valid = false;
     GraphicsSystem_LoadPalette("MasterPalette.act", 0, 0, 0, 0x100);
     textMenuSurfaceNo = 0;
     GraphicsSystem_LoadGIFFile("Data/Game/SystemText.gif", 0);
@@ -1727,28 +2185,25 @@ void StageSystem_LoadActLayout()
         for (i = 0; i < k; i++)
         {
             num = FileIO_ReadByte();
-            objectEntityList[j].type = num;
+            objectEntityType[j] = num;
             num = FileIO_ReadByte();
             objectEntityList[j].propertyValue = num;
             num = FileIO_ReadByte();
-            objectEntityList[j].xPos = num << 8;
+            objectEntityXPos[j] = num << 8;
             num = FileIO_ReadByte();
-            struct ObjectEntity* objectEntity = &objectEntityList[j];
-            objectEntity->xPos = objectEntity->xPos + num;
-            struct ObjectEntity* objectEntity1 = &objectEntityList[j];
-            objectEntity1->xPos = objectEntity1->xPos << 16;
+            objectEntityXPos[j] = objectEntityXPos[j] + num;
+            objectEntityXPos[j] = objectEntityXPos[j] << 16;
             num = FileIO_ReadByte();
-            objectEntityList[j].yPos = num << 8;
+            objectEntityYPos[j] = num << 8;
             num = FileIO_ReadByte();
-            struct ObjectEntity* objectEntity2 = &objectEntityList[j];
-            objectEntity2->yPos = objectEntity2->yPos + num;
-            struct ObjectEntity* objectEntity3 = &objectEntityList[j];
-            objectEntity3->yPos = objectEntity3->yPos << 16;
+            objectEntityYPos[j] = objectEntityYPos[j] + num;
+            objectEntityYPos[j] = objectEntityYPos[j] << 16;
             j++;
         }
         stageLayouts[0].type = 1;
         FileIO_CloseFile();
     }
+    StageSystem_BakeCollisionMap();
 }
 
 void StageSystem_LoadStageBackground()
@@ -1891,22 +2346,22 @@ void StageSystem_LoadStageCollisions()
             {
                 uint8_t l = FileIO_ReadByte();
                 int num2 = l >> 4;
-                tileCollisions[j].flags[i] = (uint8_t)(l & 15);
+                collisionMasks[j].flags[i] = (uint8_t)(l & 15);
                 l = FileIO_ReadByte();
-                tileCollisions[j].angle[i] = l;
+                collisionMasks[j].angle[i] = l;
                 l = FileIO_ReadByte();
-                tileCollisions[j].angle[i] = (uint32_t)(tileCollisions[j].angle[i] + (l << 8));
+                collisionMasks[j].angle[i] = (uint32_t)(collisionMasks[j].angle[i] + (l << 8));
                 l = FileIO_ReadByte();
-                tileCollisions[j].angle[i] = (uint32_t)(tileCollisions[j].angle[i] + (l << 16));
+                collisionMasks[j].angle[i] = (uint32_t)(collisionMasks[j].angle[i] + (l << 16));
                 l = FileIO_ReadByte();
-                tileCollisions[j].angle[i] = (uint32_t)(tileCollisions[j].angle[i] + (l << 24));
+                collisionMasks[j].angle[i] = (uint32_t)(collisionMasks[j].angle[i] + (l << 24));
                 if (num2 != 0)
                 {
                     for (k = 0; k < 16; k = k + 2)
                     {
                         l = FileIO_ReadByte();
-                        tileCollisions[j].roofMask[num1 + k] = (char)(l >> 4);
-                        tileCollisions[j].roofMask[num1 + k + 1] = (char)(l & 15);
+                        collisionMasks[j].roofMask[num1 + k] = (char)(l >> 4);
+                        collisionMasks[j].roofMask[num1 + k + 1] = (char)(l & 15);
                     }
                     l = FileIO_ReadByte();
                     num = 1;
@@ -1914,12 +2369,12 @@ void StageSystem_LoadStageCollisions()
                     {
                         if ((l & num) >= 1)
                         {
-                            tileCollisions[j].floorMask[num1 + k + 8] = 0;
+                            collisionMasks[j].floorMask[num1 + k + 8] = 0;
                         }
                         else
                         {
-                            tileCollisions[j].floorMask[num1 + k + 8] = 64;
-                            tileCollisions[j].roofMask[num1 + k + 8] = -64;
+                            collisionMasks[j].floorMask[num1 + k + 8] = 64;
+                            collisionMasks[j].roofMask[num1 + k + 8] = -64;
                         }
                         num = (uint8_t)(num << 1);
                     }
@@ -1929,12 +2384,12 @@ void StageSystem_LoadStageCollisions()
                     {
                         if ((l & num) >= 1)
                         {
-                            tileCollisions[j].floorMask[num1 + k] = 0;
+                            collisionMasks[j].floorMask[num1 + k] = 0;
                         }
                         else
                         {
-                            tileCollisions[j].floorMask[num1 + k] = 64;
-                            tileCollisions[j].roofMask[num1 + k] = -64;
+                            collisionMasks[j].floorMask[num1 + k] = 64;
+                            collisionMasks[j].roofMask[num1 + k] = -64;
                         }
                         num = (uint8_t)(num << 1);
                     }
@@ -1945,16 +2400,16 @@ void StageSystem_LoadStageCollisions()
                         {
                             if (k == 16)
                             {
-                                tileCollisions[j].leftWallMask[num1 + l] = 64;
+                                collisionMasks[j].leftWallMask[num1 + l] = 64;
                                 k = -1;
                             }
-                            else if (l > tileCollisions[j].roofMask[num1 + k])
+                            else if (l > collisionMasks[j].roofMask[num1 + k])
                             {
                                 k++;
                             }
                             else
                             {
-                                tileCollisions[j].leftWallMask[num1 + l] = (char)k;
+                                collisionMasks[j].leftWallMask[num1 + l] = (char)k;
                                 k = -1;
                             }
                         }
@@ -1966,16 +2421,16 @@ void StageSystem_LoadStageCollisions()
                         {
                             if (k == -1)
                             {
-                                tileCollisions[j].rightWallMask[num1 + l] = -64;
+                                collisionMasks[j].rightWallMask[num1 + l] = -64;
                                 k = 16;
                             }
-                            else if (l > tileCollisions[j].roofMask[num1 + k])
+                            else if (l > collisionMasks[j].roofMask[num1 + k])
                             {
                                 k--;
                             }
                             else
                             {
-                                tileCollisions[j].rightWallMask[num1 + l] = (char)k;
+                                collisionMasks[j].rightWallMask[num1 + l] = (char)k;
                                 k = 16;
                             }
                         }
@@ -1986,8 +2441,8 @@ void StageSystem_LoadStageCollisions()
                     for (k = 0; k < 16; k = k + 2)
                     {
                         l = FileIO_ReadByte();
-                        tileCollisions[j].floorMask[num1 + k] = (char)(l >> 4);
-                        tileCollisions[j].floorMask[num1 + k + 1] = (char)(l & 15);
+                        collisionMasks[j].floorMask[num1 + k] = (char)(l >> 4);
+                        collisionMasks[j].floorMask[num1 + k + 1] = (char)(l & 15);
                     }
                     l = FileIO_ReadByte();
                     num = 1;
@@ -1995,12 +2450,12 @@ void StageSystem_LoadStageCollisions()
                     {
                         if ((l & num) >= 1)
                         {
-                            tileCollisions[j].roofMask[num1 + k + 8] = 15;
+                            collisionMasks[j].roofMask[num1 + k + 8] = 15;
                         }
                         else
                         {
-                            tileCollisions[j].floorMask[num1 + k + 8] = 64;
-                            tileCollisions[j].roofMask[num1 + k + 8] = -64;
+                            collisionMasks[j].floorMask[num1 + k + 8] = 64;
+                            collisionMasks[j].roofMask[num1 + k + 8] = -64;
                         }
                         num = (uint8_t)(num << 1);
                     }
@@ -2010,12 +2465,12 @@ void StageSystem_LoadStageCollisions()
                     {
                         if ((l & num) >= 1)
                         {
-                            tileCollisions[j].roofMask[num1 + k] = 15;
+                            collisionMasks[j].roofMask[num1 + k] = 15;
                         }
                         else
                         {
-                            tileCollisions[j].floorMask[num1 + k] = 64;
-                            tileCollisions[j].roofMask[num1 + k] = -64;
+                            collisionMasks[j].floorMask[num1 + k] = 64;
+                            collisionMasks[j].roofMask[num1 + k] = -64;
                         }
                         num = (uint8_t)(num << 1);
                     }
@@ -2026,16 +2481,16 @@ void StageSystem_LoadStageCollisions()
                         {
                             if (k == 16)
                             {
-                                tileCollisions[j].leftWallMask[num1 + l] = 64;
+                                collisionMasks[j].leftWallMask[num1 + l] = 64;
                                 k = -1;
                             }
-                            else if (l < tileCollisions[j].floorMask[num1 + k])
+                            else if (l < collisionMasks[j].floorMask[num1 + k])
                             {
                                 k++;
                             }
                             else
                             {
-                                tileCollisions[j].leftWallMask[num1 + l] = (char)k;
+                                collisionMasks[j].leftWallMask[num1 + l] = (char)k;
                                 k = -1;
                             }
                         }
@@ -2047,16 +2502,16 @@ void StageSystem_LoadStageCollisions()
                         {
                             if (k == -1)
                             {
-                                tileCollisions[j].rightWallMask[num1 + l] = -64;
+                                collisionMasks[j].rightWallMask[num1 + l] = -64;
                                 k = 16;
                             }
-                            else if (l < tileCollisions[j].floorMask[num1 + k])
+                            else if (l < collisionMasks[j].floorMask[num1 + k])
                             {
                                 k--;
                             }
                             else
                             {
-                                tileCollisions[j].rightWallMask[num1 + l] = (char)k;
+                                collisionMasks[j].rightWallMask[num1 + l] = (char)k;
                                 k = 16;
                             }
                         }
@@ -2067,6 +2522,217 @@ void StageSystem_LoadStageCollisions()
         }
         FileIO_CloseFile();
     }
+    for (i = 0; i < 0x400; i++)
+    {
+        StageSystem_BakeCollisionMasks(i);
+    }
+}
+
+void StageSystem_BakeCollisionMasks(int tileIndex)
+{
+    //Every 16x16 tile is stored once per flip direction, with the masks and angles already flipped
+    //the way the sensors read them, so a sensor never has to check the direction.
+    for (int p = 0; p < 2; p++)
+    {
+        struct CollisionMask16x16* masks = &collisionMasks[p];
+        struct FlippedCollisionMask* flipped = &flippedCollisions[p];
+        int floorAngle = (int)(masks->angle[tileIndex] & 0xff);
+        int lWallAngle = (int)((masks->angle[tileIndex] & 0xff00) >> 8);
+        int rWallAngle = (int)((masks->angle[tileIndex] & 0xff0000) >> 16);
+        int roofAngle = (int)((masks->angle[tileIndex] & 0xff000000) >> 24);
+        for (int d = 0; d < 4; d++)
+        {
+            int tile = (tileIndex << 2) + d;
+            for (int i = 0; i < 16; i++)
+            {
+                int x = (tileIndex << 4) + ((d & 1) ? 15 - i : i);
+                int y = (tileIndex << 4) + ((d & 2) ? 15 - i : i);
+                int pos = (tile << 4) + i;
+                if (d & 2)
+                {
+                    flipped->floorMask[pos] = (signed char)(masks->roofMask[x] <= -64 ? 64 : 15 - masks->roofMask[x]);
+                    flipped->roofMask[pos] = (signed char)(masks->floorMask[x] >= 64 ? -64 : 15 - masks->floorMask[x]);
+                }
+                else
+                {
+                    flipped->floorMask[pos] = masks->floorMask[x];
+                    flipped->roofMask[pos] = masks->roofMask[x];
+                }
+                if (d & 1)
+                {
+                    flipped->leftWallMask[pos] = (signed char)(masks->rightWallMask[y] <= -64 ? 64 : 15 - masks->rightWallMask[y]);
+                    flipped->rightWallMask[pos] = (signed char)(masks->leftWallMask[y] >= 64 ? -64 : 15 - masks->leftWallMask[y]);
+                }
+                else
+                {
+                    flipped->leftWallMask[pos] = masks->leftWallMask[y];
+                    flipped->rightWallMask[pos] = masks->rightWallMask[y];
+                }
+            }
+            flipped->floorAngle[tile] = (d & 2) ? roofAngle : floorAngle;
+            flipped->roofAngle[tile] = (d & 2) ? floorAngle : roofAngle;
+            flipped->leftWallAngle[tile] = (d & 1) ? rWallAngle : lWallAngle;
+            flipped->rightWallAngle[tile] = (d & 1) ? lWallAngle : rWallAngle;
+            if (d & 2)
+            {
+                flipped->floorAngle[tile] = (0x180 - flipped->floorAngle[tile]) & 0xff;
+                flipped->roofAngle[tile] = (0x180 - flipped->roofAngle[tile]) & 0xff;
+                flipped->leftWallAngle[tile] = (0x180 - flipped->leftWallAngle[tile]) & 0xff;
+                flipped->rightWallAngle[tile] = (0x180 - flipped->rightWallAngle[tile]) & 0xff;
+            }
+            if (d & 1)
+            {
+                flipped->floorAngle[tile] = 0x100 - flipped->floorAngle[tile];
+                flipped->roofAngle[tile] = 0x100 - flipped->roofAngle[tile];
+                flipped->leftWallAngle[tile] = 0x100 - flipped->leftWallAngle[tile];
+                flipped->rightWallAngle[tile] = 0x100 - flipped->rightWallAngle[tile];
+            }
+        }
+    }
+}
+
+uint32_t StageSystem_BuildCollisionCell(int tileIndex)
+{
+    //Low 12 bits are the flipped 16x16 tile, then the collision flag for each plane.
+    tileIndex &= 0x7FFF;
+    uint32_t direction = tile128x128.direction[tileIndex];
+    uint32_t flag0 = tile128x128.collisionFlag[0][tileIndex];
+    uint32_t flag1 = tile128x128.collisionFlag[1][tileIndex];
+    if (direction > 3)
+    {
+        //Sensors never matched these, a flag of 3 is solid on no side
+        direction = 0;
+        flag0 = 3;
+        flag1 = 3;
+    }
+    return ((uint32_t)(tile128x128.tile16x16[tileIndex] & 0x3FF) << 2) + direction + (flag0 << 16) + (flag1 << 24);
+}
+
+void StageSystem_BakeCollisionMap()
+{
+    int width = stageLayouts[0].xSize << 3;
+    int height = stageLayouts[0].ySize << 3;
+    if (width * height > collisionMapSize)
+    {
+        free(collisionMap);
+        collisionMap = malloc(sizeof(uint32_t) * width * height);
+        collisionMapSize = collisionMap != NULL ? width * height : 0;
+    }
+    if (collisionMap == NULL)
+    {
+        width = 0;
+        height = 0;
+    }
+    collisionMapWidth = width;
+    collisionMapHeight = height;
+    for (int y = 0; y < (height >> 3); y++)
+    {
+        for (int x = 0; x < (width >> 3); x++)
+        {
+            StageSystem_UpdateCollisionMapChunk(x, y);
+        }
+    }
+}
+
+void StageSystem_UpdateCollisionMapChunk(int chunkX, int chunkY)
+{
+    if (chunkX < 0 || chunkY < 0 || chunkX >= (collisionMapWidth >> 3) || chunkY >= (collisionMapHeight >> 3))
+    {
+        return;
+    }
+    int chunk = stageLayouts[0].tileMap[chunkX + (chunkY << 8)] << 6;
+    uint32_t* cells = &collisionMap[(chunkX << 3) + (chunkY << 3) * collisionMapWidth];
+    for (int y = 0; y < 8; y++)
+    {
+        for (int x = 0; x < 8; x++)
+        {
+            cells[x + y * collisionMapWidth] = StageSystem_BuildCollisionCell(chunk + x + (y << 3));
+        }
+    }
+}
+
+void StageSystem_UpdateCollisionMapTile(int tileIndex)
+{
+    //A 128x128 tile can be placed any number of times in the layout
+    int chunk = tileIndex >> 6;
+    int cellX = tileIndex & 7;
+    int cellY = (tileIndex >> 3) & 7;
+    for (int y = 0; y < (collisionMapHeight >> 3); y++)
+    {
+        for (int x = 0; x < (collisionMapWidth >> 3); x++)
+        {
+            if (stageLayouts[0].tileMap[x + (y << 8)] == chunk)
+            {
+                collisionMap[(x << 3) + cellX + ((y << 3) + cellY) * collisionMapWidth] = StageSystem_BuildCollisionCell(tileIndex);
+            }
+        }
+    }
+}
+
+uint32_t StageSystem_GetCollisionCell(int xPos, int yPos)
+{
+    int cellX = xPos >> 4;
+    int cellY = yPos >> 4;
+    if (cellX < collisionMapWidth && cellY < collisionMapHeight)
+    {
+        return collisionMap[cellX + cellY * collisionMapWidth];
+    }
+    return StageSystem_BuildCollisionCell((stageLayouts[0].tileMap[(xPos >> 7) + ((yPos >> 7) << 8)] << 6) + ((xPos & 127) >> 4) + (((yPos & 127) >> 4) << 3));
+}
+
+void StageSystem_ProbeCollision(struct CollisionProbe* probes, int count, int cPlane, int collisionType)
+{
+    //Looks up every probe of a sensor step in one pass, the caller decides what counts as a hit.
+    //Floor and roof masks are indexed by column, wall masks by row.
+    signed char* masks;
+    int* angles;
+    int rowMask = 0;
+    switch (collisionType)
+    {
+        case COLLISION_LWALL:
+            masks = flippedCollisions[cPlane].leftWallMask;
+            angles = flippedCollisions[cPlane].leftWallAngle;
+            rowMask = 15;
+            break;
+        case COLLISION_RWALL:
+            masks = flippedCollisions[cPlane].rightWallMask;
+            angles = flippedCollisions[cPlane].rightWallAngle;
+            rowMask = 15;
+            break;
+        case COLLISION_ROOF:
+            masks = flippedCollisions[cPlane].roofMask;
+            angles = flippedCollisions[cPlane].roofAngle;
+            break;
+        default:
+            masks = flippedCollisions[cPlane].floorMask;
+            angles = flippedCollisions[cPlane].floorAngle;
+            break;
+    }
+    int flagShift = 16 + (cPlane << 3);
+    for (int i = 0; i < count; i++)
+    {
+        int xPos = probes[i].xPos;
+        int yPos = probes[i].yPos;
+        uint32_t cell;
+        if (xPos < 0 || yPos < 0 || xPos > 0x7FFF || yPos > 0x7FFF)
+        {
+            //Off the layout map entirely, callers skip these probes so keep the result harmless
+            cell = 0x03030000;
+        }
+        else if ((xPos >> 4) < collisionMapWidth && (yPos >> 4) < collisionMapHeight)
+        {
+            cell = collisionMap[(xPos >> 4) + (yPos >> 4) * collisionMapWidth];
+        }
+        else
+        {
+            cell = StageSystem_GetCollisionCell(xPos, yPos);
+        }
+        int tile = (int)(cell & 0xFFF);
+        probes[i].tile = tile;
+        probes[i].cFlag = (int)((cell >> flagShift) & 0xFF);
+        probes[i].mask = masks[(((xPos & ~rowMask) | (yPos & rowMask)) & 15) + (tile << 4)];
+        probes[i].angle = angles[tile];
+    }
 }
 
 void StageSystem_LoadStageFiles()
@@ -2162,17 +2828,18 @@ void StageSystem_LoadStageFiles()
                 numArray[1] = FileIO_ReadByte();
                 FileIO_ReadCharArray(chrArray, (int)numArray[1]);
                 chrArray[numArray[1]] = '\0';
-                FileIO_GetFileInfo(&fileDatum);
-                FileIO_CloseFile();
-                AudioPlayback_LoadSfx(chrArray, i + numGlobalSFX);
-                FileIO_SetFileInfo(&fileDatum);
+                AudioPlayback_AddSfxToLoadList(chrArray, i + numGlobalSFX);
             }
             FileIO_CloseFile();
+            AudioPlayback_LoadSfxList();
         }
         GraphicsSystem_LoadStageGIFFile(stageListPosition);
         StageSystem_LoadStageCollisions();
         StageSystem_LoadStageBackground();
+        ObjectSystem_BindCompiledScripts();
+        ObjectSystem_FuseSuperInstructions();
     }
+    ObjectSystem_StartScriptProfileStage();
     StageSystem_Load128x128Mappings();
     for (i = 0; i < 16; i++)
     {
@@ -2180,21 +2847,21 @@ void StageSystem_LoadStageFiles()
     }
     for (i = 0; i < 0x4a0; i++)
     {
-        objectEntityList[i].type = 0;
+        objectEntityType[i] = 0;
         objectEntityList[i].direction = 0;
         objectEntityList[i].animation = 0;
         objectEntityList[i].prevAnimation = 0;
         objectEntityList[i].animationSpeed = 0;
         objectEntityList[i].animationTimer = 0;
         objectEntityList[i].frame = 0;
-        objectEntityList[i].priority = 0;
+        objectEntityPriority[i] = 0;
         objectEntityList[i].direction = 0;
         objectEntityList[i].rotation = 0;
         objectEntityList[i].state = 0;
         objectEntityList[i].propertyValue = 0;
-        objectEntityList[i].xPos = 0;
-        objectEntityList[i].yPos = 0;
-        objectEntityList[i].drawOrder = 3;
+        objectEntityXPos[i] = 0;
+        objectEntityYPos[i] = 0;
+        objectEntityDrawOrder[i] = 3;
         objectEntityList[i].scale = 0x200;
         objectEntityList[i].inkEffect = 0;
         objectEntityList[i].value[0] = 0;
@@ -2207,6 +2874,7 @@ void StageSystem_LoadStageFiles()
         objectEntityList[i].value[7] = 0;
     }
     StageSystem_LoadActLayout();
+    StageSystem_SaveStageSnapshot();
     ObjectSystem_ProcessStartupScripts();
     xScrollA = (playerList[0].xPos >> 16) - 160;
     xScrollB = xScrollA + 0x140;
@@ -2270,6 +2938,15 @@ void StageSystem_ProcessStage()
             minutes = 0;
             frameCounter = 0;
             StageSystem_ResetBackgroundSettings();
+            if (StageSystem_RestoreStageSnapshot())
+            {
+                gfxIndexSize = 0;
+                gfxVertexSize = 0;
+                gfxIndexSizeOpaque = 0;
+                gfxVertexSizeOpaque = 0;
+                stageMode = 1;
+                return;
+            }
             StageSystem_LoadStageFiles();
             texBufferMode = 0;
             for (i = 0; i < 9; i++)
@@ -2315,6 +2992,7 @@ void StageSystem_ProcessStage()
                 }
             }
             RenderDevice_UpdateHardwareTextures();
+            StageSystem_CompleteStageSnapshot();
             gfxIndexSize = 0;
             gfxVertexSize = 0;
             gfxIndexSizeOpaque = 0;
@@ -2774,6 +3452,143 @@ void StageSystem_ResetBackgroundSettings()
     }
 }
 
+bool StageSystem_RestoreStageSnapshot()
+{
+    //Restarting the stage we just loaded only needs the state its act layout left behind.
+    //Global variables are left alone since the startup scripts read lives and checkpoints from them.
+    int i;
+    if (!stageSnapshot.valid || stageSnapshot.activeStageList != activeStageList || stageSnapshot.stageListPosition != stageListPosition || stageSnapshot.gfxDataPosition != gfxDataPosition)
+    {
+        return false;
+    }
+    AudioPlayback_StopAllSFX();
+    memcpy(objectEntityList, stageSnapshot.savedObjectEntityList, sizeof(objectEntityList));
+    memcpy(objectEntityXPos, stageSnapshot.savedObjectEntityXPos, sizeof(objectEntityXPos));
+    memcpy(objectEntityYPos, stageSnapshot.savedObjectEntityYPos, sizeof(objectEntityYPos));
+    memcpy(objectEntityType, stageSnapshot.savedObjectEntityType, sizeof(objectEntityType));
+    memcpy(objectEntityPriority, stageSnapshot.savedObjectEntityPriority, sizeof(objectEntityPriority));
+    memcpy(objectEntityDrawOrder, stageSnapshot.savedObjectEntityDrawOrder, sizeof(objectEntityDrawOrder));
+    memcpy(objectScriptList, stageSnapshot.savedObjectScriptList, sizeof(objectScriptList));
+    scriptEng = stageSnapshot.scriptEng;
+    scriptFramesNo = stageSnapshot.scriptFramesNo;
+    playerNum = stageSnapshot.playerNum;
+    memcpy(playerList, stageSnapshot.savedPlayerList, sizeof(playerList));
+    memcpy(stageLayouts, stageSnapshot.savedStageLayouts, sizeof(stageLayouts));
+    tile128x128 = stageSnapshot.savedTile128x128;
+    StageSystem_BakeCollisionMap();
+    hParallax = stageSnapshot.savedHParallax;
+    vParallax = stageSnapshot.savedVParallax;
+    memcpy(bgDeformationData0, stageSnapshot.savedBgDeformationData0, sizeof(bgDeformationData0));
+    memcpy(bgDeformationData1, stageSnapshot.savedBgDeformationData1, sizeof(bgDeformationData1));
+    memcpy(bgDeformationData2, stageSnapshot.savedBgDeformationData2, sizeof(bgDeformationData2));
+    memcpy(bgDeformationData3, stageSnapshot.savedBgDeformationData3, sizeof(bgDeformationData3));
+    memcpy(activeTileLayers, stageSnapshot.activeTileLayers, sizeof(activeTileLayers));
+    tLayerMidPoint = stageSnapshot.tLayerMidPoint;
+    xBoundary1 = stageSnapshot.xBoundary1;
+    xBoundary2 = stageSnapshot.xBoundary2;
+    yBoundary1 = stageSnapshot.yBoundary1;
+    yBoundary2 = stageSnapshot.yBoundary2;
+    newXBoundary1 = stageSnapshot.newXBoundary1;
+    newXBoundary2 = stageSnapshot.newXBoundary2;
+    newYBoundary1 = stageSnapshot.newYBoundary1;
+    newYBoundary2 = stageSnapshot.newYBoundary2;
+    cameraEnabled = stageSnapshot.cameraEnabled;
+    cameraTarget = stageSnapshot.cameraTarget;
+    cameraShift = stageSnapshot.cameraShift;
+    cameraStyle = stageSnapshot.cameraStyle;
+    cameraAdjustY = stageSnapshot.cameraAdjustY;
+    xScrollOffset = stageSnapshot.xScrollOffset;
+    yScrollOffset = stageSnapshot.yScrollOffset;
+    yScrollA = stageSnapshot.yScrollA;
+    yScrollB = stageSnapshot.yScrollB;
+    xScrollA = stageSnapshot.xScrollA;
+    xScrollB = stageSnapshot.xScrollB;
+    waterLevel = stageSnapshot.waterLevel;
+    memcpy(titleCardText, stageSnapshot.titleCardText, sizeof(titleCardText));
+    titleCardWord2 = stageSnapshot.titleCardWord2;
+    timeEnabled = stageSnapshot.timeEnabled;
+    pauseEnabled = stageSnapshot.pauseEnabled;
+    memcpy(tilePalette, stageSnapshot.savedTilePalette, sizeof(tilePalette));
+    memcpy(tilePalette16_Data, stageSnapshot.savedTilePalette16_Data, sizeof(tilePalette16_Data));
+    memcpy(vertexBuffer, stageSnapshot.savedVertexBuffer, sizeof(vertexBuffer));
+    memcpy(indexBuffer, stageSnapshot.savedIndexBuffer, sizeof(indexBuffer));
+    numVertices = stageSnapshot.numVertices;
+    numFaces = stageSnapshot.numFaces;
+    for (i = 0; i < 16; i++)
+    {
+        //Tracks the startup scripts set up again are kept loaded, anything swapped in since is dropped.
+        if (strcmp(musicTracks[i].trackName, stageSnapshot.musicTrackName[i]) != 0)
+        {
+            AudioPlayback_SetMusicTrack("", i, 0, 0);
+        }
+    }
+    ObjectSystem_ProcessStartupScripts();
+    xScrollA = (playerList[0].xPos >> 16) - 160;
+    xScrollB = xScrollA + 0x140;
+    yScrollA = (playerList[0].yPos >> 16) - 104;
+    yScrollB = yScrollA + 240;
+    ObjectSystem_UpdateSpriteQuads();
+    return true;
+}
+
+void StageSystem_SaveStageSnapshot()
+{
+    stageSnapshot.valid = false;
+    stageSnapshot.activeStageList = activeStageList;
+    stageSnapshot.stageListPosition = stageListPosition;
+    memcpy(stageSnapshot.savedObjectEntityList, objectEntityList, sizeof(objectEntityList));
+    memcpy(stageSnapshot.savedObjectEntityXPos, objectEntityXPos, sizeof(objectEntityXPos));
+    memcpy(stageSnapshot.savedObjectEntityYPos, objectEntityYPos, sizeof(objectEntityYPos));
+    memcpy(stageSnapshot.savedObjectEntityType, objectEntityType, sizeof(objectEntityType));
+    memcpy(stageSnapshot.savedObjectEntityPriority, objectEntityPriority, sizeof(objectEntityPriority));
+    memcpy(stageSnapshot.savedObjectEntityDrawOrder, objectEntityDrawOrder, sizeof(objectEntityDrawOrder));
+    memcpy(stageSnapshot.savedObjectScriptList, objectScriptList, sizeof(objectScriptList));
+    stageSnapshot.scriptEng = scriptEng;
+    stageSnapshot.scriptFramesNo = scriptFramesNo;
+    stageSnapshot.playerNum = playerNum;
+    memcpy(stageSnapshot.savedPlayerList, playerList, sizeof(playerList));
+    memcpy(stageSnapshot.savedStageLayouts, stageLayouts, sizeof(stageLayouts));
+    stageSnapshot.savedTile128x128 = tile128x128;
+    stageSnapshot.savedHParallax = hParallax;
+    stageSnapshot.savedVParallax = vParallax;
+    memcpy(stageSnapshot.savedBgDeformationData0, bgDeformationData0, sizeof(bgDeformationData0));
+    memcpy(stageSnapshot.savedBgDeformationData1, bgDeformationData1, sizeof(bgDeformationData1));
+    memcpy(stageSnapshot.savedBgDeformationData2, bgDeformationData2, sizeof(bgDeformationData2));
+    memcpy(stageSnapshot.savedBgDeformationData3, bgDeformationData3, sizeof(bgDeformationData3));
+    memcpy(stageSnapshot.activeTileLayers, activeTileLayers, sizeof(activeTileLayers));
+    stageSnapshot.tLayerMidPoint = tLayerMidPoint;
+    stageSnapshot.xBoundary1 = xBoundary1;
+    stageSnapshot.xBoundary2 = xBoundary2;
+    stageSnapshot.yBoundary1 = yBoundary1;
+    stageSnapshot.yBoundary2 = yBoundary2;
+    stageSnapshot.newXBoundary1 = newXBoundary1;
+    stageSnapshot.newXBoundary2 = newXBoundary2;
+    stageSnapshot.newYBoundary1 = newYBoundary1;
+    stageSnapshot.newYBoundary2 = newYBoundary2;
+    stageSnapshot.cameraEnabled = cameraEnabled;
+    stageSnapshot.cameraTarget = cameraTarget;
+    stageSnapshot.cameraShift = cameraShift;
+    stageSnapshot.cameraStyle = cameraStyle;
+    stageSnapshot.cameraAdjustY = cameraAdjustY;
+    stageSnapshot.xScrollOffset = xScrollOffset;
+    stageSnapshot.yScrollOffset = yScrollOffset;
+    stageSnapshot.yScrollA = yScrollA;
+    stageSnapshot.yScrollB = yScrollB;
+    stageSnapshot.xScrollA = xScrollA;
+    stageSnapshot.xScrollB = xScrollB;
+    stageSnapshot.waterLevel = waterLevel;
+    memcpy(stageSnapshot.titleCardText, titleCardText, sizeof(titleCardText));
+    stageSnapshot.titleCardWord2 = titleCardWord2;
+    stageSnapshot.timeEnabled = timeEnabled;
+    stageSnapshot.pauseEnabled = pauseEnabled;
+    memcpy(stageSnapshot.savedTilePalette, tilePalette, sizeof(tilePalette));
+    memcpy(stageSnapshot.savedTilePalette16_Data, tilePalette16_Data, sizeof(tilePalette16_Data));
+    memcpy(stageSnapshot.savedVertexBuffer, vertexBuffer, sizeof(vertexBuffer));
+    memcpy(stageSnapshot.savedIndexBuffer, indexBuffer, sizeof(indexBuffer));
+    stageSnapshot.numVertices = numVertices;
+    stageSnapshot.numFaces = numFaces;
+}
+
 void StageSystem_SetLayerDeformation(int selectedDef, int waveLength, int waveWidth, int wType, int yPos, int wSize)
 {
     int i = 0;
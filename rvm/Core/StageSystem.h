@@ -11,6 +11,8 @@
 #include "Mappings128x128.h"
 #include "LayoutMap.h"
 #include "CollisionMask16x16.h"
+#include "FlippedCollisionMask.h"
+#include "CollisionProbe.h"
 #include "LineScrollParallax.h"
 #include "TextMenu.h"
 #include "GraphicsSystem.h"
@@ -24,62 +26,82 @@
 #include "FileIO.h"
 #include "Scene3D.h"
 #include "InputSystem.h"
+#include "StageSnapshot.h"
+#include "TileLayerJob.h"
+#include "TileLayerQueue.h"
+#include "EngineContext.h"
 
-extern struct InputResult gKeyDown;
-extern struct InputResult gKeyPress;
-extern uint8_t stageMode;
-extern uint8_t pauseEnabled;
-extern int stageListPosition;
-extern struct Mappings128x128 tile128x128;
-extern struct LayoutMap stageLayouts[9];
-extern uint8_t tLayerMidPoint;
-extern uint8_t activeTileLayers[4];
-extern struct CollisionMask16x16 tileCollisions[2];
-extern struct LineScrollParallax hParallax;
-extern struct LineScrollParallax vParallax;
-extern int lastXSize;
-extern int lastYSize;
-extern int bgDeformationData0[0x240];
-extern int bgDeformationData1[0x240];
-extern int bgDeformationData2[0x240];
-extern int bgDeformationData3[0x240];
-extern int xBoundary1;
-extern int xBoundary2;
-extern int yBoundary1;
-extern int yBoundary2;
-extern int newXBoundary1;
-extern int newXBoundary2;
-extern int newYBoundary1;
-extern int newYBoundary2;
-extern uint8_t cameraEnabled;
-extern signed char cameraTarget;
-extern uint8_t cameraShift;
-extern uint8_t cameraStyle;
-extern int cameraAdjustY;
-extern int xScrollOffset;
-extern int yScrollOffset;
-extern int yScrollA;
-extern int yScrollB;
-extern int xScrollA;
-extern int xScrollB;
-extern int xScrollMove;
-extern int yScrollMove;
-extern int screenShakeX;
-extern int screenShakeY;
-extern int waterLevel;
-extern char titleCardText[24];
-extern char titleCardWord2;
-extern struct TextMenu gameMenu[2];
-extern uint8_t timeEnabled;
-extern uint8_t milliSeconds;
-extern uint8_t seconds;
-extern uint8_t minutes;
-extern uint8_t debugMode;
+#define COLLISION_FLOOR 0
+#define COLLISION_LWALL 1
+#define COLLISION_RWALL 2
+#define COLLISION_ROOF 3
+#define TILE_LAYER_THREADS 3
+
+extern ENGINE_STATE struct InputResult gKeyDown;
+extern ENGINE_STATE struct InputResult gKeyPress;
+extern ENGINE_STATE uint8_t stageMode;
+extern ENGINE_STATE uint8_t pauseEnabled;
+extern ENGINE_STATE int stageListPosition;
+extern ENGINE_STATE uint8_t tLayerMidPoint;
+extern ENGINE_STATE uint8_t activeTileLayers[4];
+extern ENGINE_STATE uint32_t* collisionMap;
+extern ENGINE_STATE int collisionMapWidth;
+extern ENGINE_STATE int collisionMapHeight;
+extern ENGINE_STATE int lastXSize;
+extern ENGINE_STATE int lastYSize;
+extern ENGINE_STATE int xBoundary1;
+extern ENGINE_STATE int xBoundary2;
+extern ENGINE_STATE int yBoundary1;
+extern ENGINE_STATE int yBoundary2;
+extern ENGINE_STATE int newXBoundary1;
+extern ENGINE_STATE int newXBoundary2;
+extern ENGINE_STATE int newYBoundary1;
+extern ENGINE_STATE int newYBoundary2;
+extern ENGINE_STATE uint8_t cameraEnabled;
+extern ENGINE_STATE signed char cameraTarget;
+extern ENGINE_STATE uint8_t cameraShift;
+extern ENGINE_STATE uint8_t cameraStyle;
+extern ENGINE_STATE int cameraAdjustY;
+extern ENGINE_STATE int xScrollOffset;
+extern ENGINE_STATE int yScrollOffset;
+extern ENGINE_STATE int prevXScrollOffset;
+extern ENGINE_STATE int prevYScrollOffset;
+extern ENGINE_STATE int layerParallaxOffsetY[9];
+extern ENGINE_STATE int yScrollA;
+extern ENGINE_STATE int yScrollB;
+extern ENGINE_STATE int xScrollA;
+extern ENGINE_STATE int xScrollB;
+extern ENGINE_STATE int xScrollMove;
+extern ENGINE_STATE int yScrollMove;
+extern ENGINE_STATE int screenShakeX;
+extern ENGINE_STATE int screenShakeY;
+extern ENGINE_STATE int waterLevel;
+extern ENGINE_STATE char titleCardText[24];
+extern ENGINE_STATE char titleCardWord2;
+extern ENGINE_STATE uint8_t timeEnabled;
+extern ENGINE_STATE uint8_t milliSeconds;
+extern ENGINE_STATE uint8_t seconds;
+extern ENGINE_STATE uint8_t minutes;
+extern ENGINE_STATE uint8_t debugMode;
+extern ENGINE_STATE bool parallelTileLayers;
+extern ENGINE_STATE SDL_Thread* tileLayerThreads[TILE_LAYER_THREADS];
+extern ENGINE_STATE int numTileLayerThreads;
+extern ENGINE_STATE struct DrawVertex* tileLayerVertices;
 
 void Init_StageSystem(void);
+void StageSystem_AddLayerInterpolationSpans(struct TileLayerJob* job, int vertexStart);
+void StageSystem_BakeCollisionMap(void);
+void StageSystem_BakeCollisionMasks(int tileIndex);
+void StageSystem_Build3DFloorLayer(struct TileLayerJob* job);
+void StageSystem_BuildHLineScrollLayer8(struct TileLayerJob* job);
+uint32_t StageSystem_BuildCollisionCell(int tileIndex);
+void StageSystem_CompleteStageSnapshot(void);
 void StageSystem_Draw3DFloorLayer(uint8_t layerNum);
 void StageSystem_DrawHLineScrollLayer8(uint8_t layerNum);
 void StageSystem_DrawStageGfx(void);
+void StageSystem_DrawStageGfxParallel(void);
+uint32_t StageSystem_GetCollisionCell(int xPos, int yPos);
+void StageSystem_FinishTileLayerJobs(void);
 void StageSystem_InitErrorMessage(void);
 void StageSystem_InitFirstStage(void);
 void StageSystem_InitStageSelectMenu(void);
@@ -88,10 +110,24 @@ void StageSystem_LoadActLayout(void);
 void StageSystem_LoadStageBackground(void);
 void StageSystem_LoadStageCollisions(void);
 void StageSystem_LoadStageFiles(void);
+void StageSystem_PlaceVertices(int vertexPos, struct DrawVertex* vertices, int count);
+void StageSystem_Prepare3DFloorLayer(uint8_t layerNum, struct TileLayerJob* job);
+void StageSystem_PrepareHLineScrollLayer8(uint8_t layerNum, struct TileLayerJob* job);
+void StageSystem_ProbeCollision(struct CollisionProbe* probes, int count, int cPlane, int collisionType);
 void StageSystem_ProcessStage(void);
 void StageSystem_ProcessStageSelectMenu(void);
 void StageSystem_ResetBackgroundSettings(void);
+bool StageSystem_RestoreStageSnapshot(void);
+void StageSystem_RunTileLayerJobs(struct TileLayerQueue* queue);
+void StageSystem_SaveStageSnapshot(void);
 void StageSystem_SetLayerDeformation(int selectedDef, int waveLength, int waveWidth, int wType, int yPos, int wSize);
+void StageSystem_StartInterpolationFrame(void);
+bool StageSystem_StartTileLayerWorkers(void);
+void StageSystem_StitchInterpolationSpans(int* objectVertexEnd, int* objectSpanEnd, int* layerObjectList, struct TileLayerJob** layerJobs);
+void StageSystem_StopTileLayerWorkers(void);
+int StageSystem_TileLayerWorker(void* data);
+void StageSystem_UpdateCollisionMapChunk(int chunkX, int chunkY);
+void StageSystem_UpdateCollisionMapTile(int tileIndex);
 
 
 #endif /* StageSystem_h */
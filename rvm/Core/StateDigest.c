@@ -0,0 +1,181 @@
+//
+//  StateDigest.c
+//  rvm
+//
+
+#include "StateDigest.h"
+#include "EngineBuffers.h"
+
+const char* digestNames[NUM_DIGESTS] = { "entities", "players", "globals", "scroll", "gfx" };
+ENGINE_STATE uint64_t stateDigest[NUM_DIGESTS];
+ENGINE_STATE unsigned int digestFrame;
+ENGINE_STATE bool digestGfxEnabled;
+ENGINE_STATE FILE* digestFile;
+
+uint64_t StateDigest_Hash(uint64_t hash, const void* data, size_t length)
+{
+    //FNV-1a taken a word at a time, which is plenty to spot a divergence
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t word;
+    while (length >= 4)
+    {
+        memcpy(&word, bytes, 4);
+        hash = (hash ^ word) * 0x100000001b3ull;
+        bytes += 4;
+        length -= 4;
+    }
+    while (length > 0)
+    {
+        hash = (hash ^ *bytes) * 0x100000001b3ull;
+        bytes++;
+        length--;
+    }
+    return hash;
+}
+
+void StateDigest_Update()
+{
+    uint8_t record[4 + NUM_DIGESTS * 8];
+    int scroll[8];
+    int i;
+    int j;
+    for (i = 0; i < NUM_DIGESTS; i++)
+    {
+        stateDigest[i] = 0xcbf29ce484222325ull;
+    }
+    //Stop at the last field so the trailing padding never ends up in the digest
+    for (i = 0; i < 0x4A0; i++)
+    {
+        stateDigest[DIGEST_ENTITIES] = StateDigest_Hash(stateDigest[DIGEST_ENTITIES], &objectEntityList[i], offsetof(struct ObjectEntity, frame) + 1);
+    }
+    stateDigest[DIGEST_ENTITIES] = StateDigest_Hash(stateDigest[DIGEST_ENTITIES], objectEntityXPos, sizeof(objectEntityXPos));
+    stateDigest[DIGEST_ENTITIES] = StateDigest_Hash(stateDigest[DIGEST_ENTITIES], objectEntityYPos, sizeof(objectEntityYPos));
+    stateDigest[DIGEST_ENTITIES] = StateDigest_Hash(stateDigest[DIGEST_ENTITIES], objectEntityType, sizeof(objectEntityType));
+    stateDigest[DIGEST_ENTITIES] = StateDigest_Hash(stateDigest[DIGEST_ENTITIES], objectEntityPriority, sizeof(objectEntityPriority));
+    stateDigest[DIGEST_ENTITIES] = StateDigest_Hash(stateDigest[DIGEST_ENTITIES], objectEntityDrawOrder, sizeof(objectEntityDrawOrder));
+    //The pointers differ from run to run, so only the entity they follow is hashed
+    for (i = 0; i < 2; i++)
+    {
+        j = playerList[i].objectPtr != NULL ? (int)(playerList[i].objectPtr - objectEntityList) : -1;
+        stateDigest[DIGEST_PLAYERS] = StateDigest_Hash(stateDigest[DIGEST_PLAYERS], &playerList[i], offsetof(struct PlayerObject, flailing) + 3);
+        stateDigest[DIGEST_PLAYERS] = StateDigest_Hash(stateDigest[DIGEST_PLAYERS], &j, 4);
+    }
+    stateDigest[DIGEST_GLOBALS] = StateDigest_Hash(stateDigest[DIGEST_GLOBALS], globalVariables, sizeof(globalVariables));
+    scroll[0] = xScrollOffset;
+    scroll[1] = yScrollOffset;
+    scroll[2] = xScrollA;
+    scroll[3] = yScrollA;
+    scroll[4] = screenShakeX;
+    scroll[5] = screenShakeY;
+    scroll[6] = cameraTarget;
+    scroll[7] = stageMode;
+    stateDigest[DIGEST_SCROLL] = StateDigest_Hash(stateDigest[DIGEST_SCROLL], scroll, sizeof(scroll));
+    if (digestGfxEnabled)
+    {
+        stateDigest[DIGEST_GFX] = StateDigest_Hash(stateDigest[DIGEST_GFX], &gfxIndexSize, sizeof(gfxIndexSize));
+        stateDigest[DIGEST_GFX] = StateDigest_Hash(stateDigest[DIGEST_GFX], gfxPolyList, gfxVertexSize * sizeof(struct DrawVertex));
+    }
+    if (digestFile != NULL)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            record[i] = (uint8_t)(digestFrame >> (i << 3));
+        }
+        for (i = 0; i < NUM_DIGESTS; i++)
+        {
+            for (j = 0; j < 8; j++)
+            {
+                record[4 + (i << 3) + j] = (uint8_t)(stateDigest[i] >> (j << 3));
+            }
+        }
+        fwrite(record, 1, sizeof(record), digestFile);
+    }
+    digestFrame++;
+}
+
+bool StateDigest_StartLog(const char* filePath)
+{
+    StateDigest_StopLog();
+    digestFile = fopen(filePath, "wb");
+    if (digestFile == NULL)
+    {
+        return false;
+    }
+    fwrite("RVMD", 1, 4, digestFile);
+    digestFrame = 0;
+    return true;
+}
+
+void StateDigest_StopLog()
+{
+    if (digestFile != NULL)
+    {
+        fclose(digestFile);
+        digestFile = NULL;
+    }
+}
+
+int StateDigest_CompareLogs(const char* filePathA, const char* filePathB)
+{
+    //Returns the first frame where the logs differ, DIGEST_LOGS_AGREE if they match record for record,
+    //or DIGEST_LOGS_UNREADABLE if either can't be read. A log that runs on past the other differs there.
+    uint8_t recordA[4 + NUM_DIGESTS * 8];
+    uint8_t recordB[4 + NUM_DIGESTS * 8];
+    size_t readA;
+    size_t readB;
+    int frame = DIGEST_LOGS_AGREE;
+    int numFrames = 0;
+    int i;
+    FILE* fileA = fopen(filePathA, "rb");
+    FILE* fileB = fopen(filePathB, "rb");
+    if (fileA == NULL || fileB == NULL || fread(recordA, 1, 4, fileA) != 4 || fread(recordB, 1, 4, fileB) != 4 || memcmp(recordA, "RVMD", 4) != 0 || memcmp(recordB, "RVMD", 4) != 0)
+    {
+        printf("Could not read digest logs %s and %s\n", filePathA, filePathB);
+        if (fileA != NULL)
+        {
+            fclose(fileA);
+        }
+        if (fileB != NULL)
+        {
+            fclose(fileB);
+        }
+        return DIGEST_LOGS_UNREADABLE;
+    }
+    while (true)
+    {
+        readA = fread(recordA, 1, sizeof(recordA), fileA);
+        readB = fread(recordB, 1, sizeof(recordB), fileB);
+        if (readA != readB)
+        {
+            frame = numFrames;
+            printf("First divergence at frame %d: %s has more records\n", frame, readA > readB ? filePathA : filePathB);
+            break;
+        }
+        if (readA != sizeof(recordA))
+        {
+            break;
+        }
+        if (memcmp(recordA + 4, recordB + 4, NUM_DIGESTS * 8) != 0)
+        {
+            frame = numFrames;
+            printf("First divergence at frame %d:", frame);
+            for (i = 0; i < NUM_DIGESTS; i++)
+            {
+                if (memcmp(recordA + 4 + (i << 3), recordB + 4 + (i << 3), 8) != 0)
+                {
+                    printf(" %s", digestNames[i]);
+                }
+            }
+            printf("\n");
+            break;
+        }
+        numFrames++;
+    }
+    if (frame == DIGEST_LOGS_AGREE)
+    {
+        printf("No divergence in %d frames\n", numFrames);
+    }
+    fclose(fileA);
+    fclose(fileB);
+    return frame;
+}
@@ -0,0 +1,38 @@
+//
+//  StateDigest.h
+//  rvm
+//
+
+#ifndef StateDigest_h
+#define StateDigest_h
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "SDL.h"
+#include "ObjectSystem.h"
+#include "PlayerSystem.h"
+#include "StageSystem.h"
+#include "GraphicsSystem.h"
+#include "EngineContext.h"
+
+#define DIGEST_ENTITIES 0
+#define DIGEST_PLAYERS 1
+#define DIGEST_GLOBALS 2
+#define DIGEST_SCROLL 3
+#define DIGEST_GFX 4
+#define NUM_DIGESTS 5
+#define DIGEST_LOGS_AGREE -1
+#define DIGEST_LOGS_UNREADABLE -2
+
+extern ENGINE_STATE uint64_t stateDigest[NUM_DIGESTS];
+extern ENGINE_STATE unsigned int digestFrame;
+extern ENGINE_STATE bool digestGfxEnabled;
+
+uint64_t StateDigest_Hash(uint64_t hash, const void* data, size_t length);
+void StateDigest_Update(void);
+bool StateDigest_StartLog(const char* filePath);
+void StateDigest_StopLog(void);
+int StateDigest_CompareLogs(const char* filePathA, const char* filePathB);
+
+#endif /* StateDigest_h */
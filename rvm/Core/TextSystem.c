@@ -4,9 +4,9 @@
 //
 
 #include "TextSystem.h"
+#include "EngineBuffers.h"
 
-int textMenuSurfaceNo;
-struct FontCharacter fontCharacterList[1024];
+ENGINE_STATE int textMenuSurfaceNo;
 
 void TextSystem_LoadFontFile(char* fileName)
 {
@@ -13,8 +13,9 @@
 #include "FileData.h"
 #include "FileIO.h"
 #include "GraphicsSystem.h"
+#include "EngineContext.h"
 
-extern int textMenuSurfaceNo;
+extern ENGINE_STATE int textMenuSurfaceNo;
 
 void TextSystem_LoadFontFile(char* fileName);
 void TextSystem_LoadTextFile(struct TextMenu* tMenu, char* fileName, uint8_t mapCode);
@@ -0,0 +1,49 @@
+//
+//  TileLayerJob.h
+//  rvm
+//
+
+#ifndef TileLayerJob_h
+#define TileLayerJob_h
+
+#include <stdbool.h>
+#include "SDL.h"
+#include "DrawVertex.h"
+#include "DrawVertex3D.h"
+
+struct TileLayerJob {
+    uint8_t layerNum;
+    uint8_t type;
+    uint16_t* tileMap;
+    uint8_t* lineScrollRef;
+    int* gfxDataPos;
+    uint8_t* direction;
+    uint8_t* visualPlane;
+    float* tileUVs;
+    int bgDeformationA[0x240];
+    int bgDeformationB[0x240];
+    int linePos[256];
+    uint8_t deformationEnabled[256];
+    int lineDeltaX[256];
+    int deltaY;
+    uint8_t rowLine[34];
+    int rowVertexStart[34];
+    int numRows;
+    int xSize;
+    int ySize;
+    int screenTiles;
+    uint8_t highPlane;
+    int parallaxOffsetY;
+    int deformationX;
+    int deformationY;
+    int waterDrawPos;
+    bool detailedFloor;
+    int floorX;
+    int floorZ;
+    struct DrawVertex* vertices;
+    struct DrawVertex3D* vertices3D;
+    int vertexCount;
+    int indexCount;
+};
+
+#endif /* TileLayerJob_h */
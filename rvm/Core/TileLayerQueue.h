@@ -0,0 +1,24 @@
+//
+//  TileLayerQueue.h
+//  rvm
+//
+
+#ifndef TileLayerQueue_h
+#define TileLayerQueue_h
+
+#include <stdbool.h>
+#include "SDL.h"
+#include "TileLayerJob.h"
+
+struct TileLayerQueue {
+    struct TileLayerJob jobs[4];
+    int numJobs;
+    SDL_atomic_t nextJob;
+    int numWorkers;
+    bool running;
+    SDL_sem* start;
+    SDL_sem* done;
+    bool quit;
+};
+
+#endif /* TileLayerQueue_h */
@@ -0,0 +1,899 @@
+//
+//  ScriptCompiler.c
+//  rvm
+//
+//  Offline tool that turns object script bytecode into C, one function per script body.
+//
+//  ScriptCompiler <output.c> <GlobalCode.bin> [stage.bin ...] [-standalone stage.bin ...]
+//
+//  One module is written for GlobalCode.bin on its own and one for GlobalCode.bin followed by each
+//  stage file, matching how StageSystem_LoadStageFiles fills scriptData. Stages that do not load the
+//  global scripts are passed after -standalone. The output replaces rvm/Core/CompiledScripts.c.
+//
+//  Generated code reads and writes variables and runs opcodes through the same ObjectSystem helpers
+//  the interpreter uses, so the only thing compiled away is instruction decoding and dispatch. Any
+//  jump the compiler could not resolve ahead of time hands the rest of the script to the interpreter.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+
+#define SCRIPT_DATA_SIZE 0x40000
+#define JUMP_TABLE_SIZE 0x4000
+#define MAX_FILES 256
+#define MAX_ENTRIES 0x800
+#define MAX_INSTRUCTIONS 0x8000
+#define MAX_OPERANDS 8
+
+//Must match scriptOpcodeSizes in ObjectSystem.c
+const signed char scriptOpcodeSizes[] = { 0, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 2, 0, 0, 2, 2, 2, 2,
+    2, 5, 5, 3, 4, 7, 1, 1, 1, 3, 3, 4, 7, 7, 3, 6, 6, 5, 3, 4, 3, 7, 2, 1, 4, 4, 1,
+    4, 3, 4, 0, 8, 5, 5, 4, 2, 0, 0, 0, 0, 0, 3, 1, 0, 2, 1, 3, 4, 4, 1, 0, 2, 1, 1,
+    0, 1, 2, 4, 4, 2, 2, 2, 4, 3, 1, 0, 6, 4, 4, 4, 3, 3, 0, 0, 1, 2, 3, 3, 4, 2, 4,
+    2, 0, 0, 1, 3, 7, 5, 2, 2, 2, 1, 1, 4 };
+const char* const ifConditions[] = { "!=", "<=", "<", ">=", ">", "==" };
+
+//Arithmetic that can't fail is written out in place, must match ObjectSystem_ExecuteOpcode
+const char* const inlineOpcodes[] = { NULL,
+    "scriptEng.operands[1]",
+    "scriptEng.operands[0] + scriptEng.operands[1]",
+    "scriptEng.operands[0] - scriptEng.operands[1]",
+    "scriptEng.operands[0] + 1",
+    "scriptEng.operands[0] - 1",
+    "scriptEng.operands[0] * scriptEng.operands[1]",
+    NULL,
+    "scriptEng.operands[0] >> (scriptEng.operands[1] & 31)",
+    "scriptEng.operands[0] << (scriptEng.operands[1] & 31)",
+    "scriptEng.operands[0] & scriptEng.operands[1]",
+    "scriptEng.operands[0] | scriptEng.operands[1]",
+    "scriptEng.operands[0] ^ scriptEng.operands[1]",
+    NULL,
+    "-scriptEng.operands[0]" };
+
+struct ScriptFile {
+    char* path;
+    uint8_t* data;
+    long size;
+    int standalone;
+};
+
+struct ScriptImage {
+    int scriptData[SCRIPT_DATA_SIZE];
+    int scriptDataPos;
+    int jumpTableData[JUMP_TABLE_SIZE];
+    int jumpTableDataPos;
+    int numEntries;
+    int entryCode[MAX_ENTRIES];
+    int entryJumpTable[MAX_ENTRIES];
+};
+
+struct ScriptOperand {
+    int type;
+    int addressing;
+    int indexIsArray;
+    int index;
+    int value;
+    int length;
+    char text[0x100];
+};
+
+struct ScriptInstruction {
+    int pos;
+    int next;
+    int opcode;
+    int numOperands;
+    struct ScriptOperand operands[MAX_OPERANDS];
+    int expectedTop;
+};
+
+struct TextBuffer {
+    char* text;
+    size_t length;
+    size_t capacity;
+};
+
+struct ScriptFile scriptFiles[MAX_FILES];
+int numScriptFiles;
+struct ScriptImage image;
+struct ScriptInstruction instructions[MAX_INSTRUCTIONS];
+int numInstructions;
+int jumpTargets[MAX_INSTRUCTIONS];
+int numJumpTargets;
+uint8_t labelUsed[SCRIPT_DATA_SIZE];
+uint8_t isInstruction[SCRIPT_DATA_SIZE];
+int bodyEnd;
+int needsDispatch;
+char** bodyTexts;
+int numBodies;
+int bodyCapacity;
+
+void ScriptCompiler_Append(struct TextBuffer* buffer, const char* format, ...)
+{
+    va_list args;
+    int length;
+    va_start(args, format);
+    length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (buffer->length + length + 1 > buffer->capacity)
+    {
+        buffer->capacity = (buffer->length + length + 1) * 2;
+        buffer->text = realloc(buffer->text, buffer->capacity);
+    }
+    va_start(args, format);
+    vsnprintf(buffer->text + buffer->length, length + 1, format, args);
+    va_end(args);
+    buffer->length += length;
+}
+
+int ScriptCompiler_LoadFile(struct ScriptFile* scriptFile)
+{
+    FILE* file = fopen(scriptFile->path, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Can't open %s\n", scriptFile->path);
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    scriptFile->size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    scriptFile->data = malloc(scriptFile->size > 0 ? scriptFile->size : 1);
+    if (fread(scriptFile->data, 1, scriptFile->size, file) != (size_t)scriptFile->size)
+    {
+        fprintf(stderr, "Can't read %s\n", scriptFile->path);
+        fclose(file);
+        return 0;
+    }
+    fclose(file);
+    return 1;
+}
+
+int ScriptCompiler_ReadInt(struct ScriptFile* scriptFile, long* pos)
+{
+    int value = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        value += (*pos < scriptFile->size ? scriptFile->data[*pos] : 0) << (i << 3);
+        (*pos)++;
+    }
+    return value;
+}
+
+int ScriptCompiler_ReadPacked(struct ScriptFile* scriptFile, long* pos, int* list, int* listPos, int limit)
+{
+    //Same run-length packing ObjectSystem_LoadByteCodeFile reads: a header byte gives the run
+    //length, with the top bit set when the run holds full 32-bit words instead of bytes
+    int count = ScriptCompiler_ReadInt(scriptFile, pos);
+    while (count > 0)
+    {
+        if (*pos >= scriptFile->size)
+        {
+            return 0;
+        }
+        uint8_t header = scriptFile->data[(*pos)++];
+        int run = header & 127;
+        while (run > 0)
+        {
+            if (*listPos >= limit)
+            {
+                return 0;
+            }
+            if (header >= 128)
+            {
+                list[*listPos] = ScriptCompiler_ReadInt(scriptFile, pos);
+            }
+            else
+            {
+                list[*listPos] = *pos < scriptFile->size ? scriptFile->data[*pos] : 0;
+                (*pos)++;
+            }
+            (*listPos)++;
+            count--;
+            run--;
+        }
+    }
+    return 1;
+}
+
+void ScriptCompiler_AddEntry(int scriptCodePtr, int jumpTablePtr)
+{
+    for (int i = 0; i < image.numEntries; i++)
+    {
+        if (image.entryCode[i] == scriptCodePtr && image.entryJumpTable[i] == jumpTablePtr)
+        {
+            return;
+        }
+    }
+    if (image.numEntries < MAX_ENTRIES && scriptCodePtr >= 0 && scriptCodePtr < image.scriptDataPos && image.scriptData[scriptCodePtr] > 0)
+    {
+        image.entryCode[image.numEntries] = scriptCodePtr;
+        image.entryJumpTable[image.numEntries] = jumpTablePtr;
+        image.numEntries++;
+    }
+}
+
+int ScriptCompiler_LoadImage(struct ScriptFile* scriptFile)
+{
+    long pos = 0;
+    int code[0x100 * 4];
+    int num;
+    if (!ScriptCompiler_ReadPacked(scriptFile, &pos, image.scriptData, &image.scriptDataPos, SCRIPT_DATA_SIZE))
+    {
+        return 0;
+    }
+    if (!ScriptCompiler_ReadPacked(scriptFile, &pos, image.jumpTableData, &image.jumpTableDataPos, JUMP_TABLE_SIZE))
+    {
+        return 0;
+    }
+    if (pos + 2 > scriptFile->size)
+    {
+        return 0;
+    }
+    num = scriptFile->data[pos] + (scriptFile->data[pos + 1] << 8);
+    pos += 2;
+    if (num > 0x100)
+    {
+        return 0;
+    }
+    for (int i = 0; i < num * 4; i++)
+    {
+        code[i] = ScriptCompiler_ReadInt(scriptFile, &pos);
+    }
+    for (int i = 0; i < num * 4; i++)
+    {
+        ScriptCompiler_AddEntry(code[i], ScriptCompiler_ReadInt(scriptFile, &pos));
+    }
+    if (pos + 2 > scriptFile->size)
+    {
+        return 0;
+    }
+    num = scriptFile->data[pos] + (scriptFile->data[pos + 1] << 8);
+    pos += 2;
+    if (num > 0x200)
+    {
+        return 0;
+    }
+    for (int i = 0; i < num; i++)
+    {
+        code[i] = ScriptCompiler_ReadInt(scriptFile, &pos);
+    }
+    for (int i = 0; i < num; i++)
+    {
+        ScriptCompiler_AddEntry(code[i], ScriptCompiler_ReadInt(scriptFile, &pos));
+    }
+    return pos <= scriptFile->size;
+}
+
+int ScriptCompiler_DecodeOperand(int* pos, struct ScriptOperand* operand)
+{
+    int* scriptData = image.scriptData;
+    if (*pos >= image.scriptDataPos)
+    {
+        return 0;
+    }
+    operand->type = scriptData[(*pos)++];
+    switch (operand->type)
+    {
+        case 1:
+        {
+            operand->addressing = scriptData[(*pos)++];
+            if (operand->addressing < 0 || operand->addressing > 3)
+            {
+                return 0;
+            }
+            if (operand->addressing > 0)
+            {
+                operand->indexIsArray = scriptData[(*pos)++] == 1;
+                operand->index = scriptData[(*pos)++];
+            }
+            operand->value = scriptData[(*pos)++];
+            return *pos <= image.scriptDataPos;
+        }
+        case 2:
+        {
+            operand->value = scriptData[(*pos)++];
+            return *pos <= image.scriptDataPos;
+        }
+        case 3:
+        {
+            //Text is packed four characters to a word, high byte first. Like the interpreter, step
+            //past one extra word when the text fills its last word exactly
+            int lengthPos = *pos;
+            operand->length = scriptData[lengthPos];
+            if (operand->length < 0 || operand->length >= 0x100)
+            {
+                return 0;
+            }
+            *pos = lengthPos + 2 + (operand->length >> 2);
+            if (*pos > image.scriptDataPos)
+            {
+                return 0;
+            }
+            for (int i = 0; i < operand->length; i++)
+            {
+                operand->text[i] = (char)((scriptData[lengthPos + 1 + (i >> 2)] >> (24 - ((i & 3) << 3))) & 0xff);
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int ScriptCompiler_JumpTarget(int scriptStart, int jumpTablePtr, int index, int* target)
+{
+    if (jumpTablePtr + index < 0 || jumpTablePtr + index >= image.jumpTableDataPos)
+    {
+        return 0;
+    }
+    *target = scriptStart + image.jumpTableData[jumpTablePtr + index];
+    return 1;
+}
+
+int ScriptCompiler_DecodeBody(int scriptStart, int jumpTablePtr)
+{
+    //Decode straight through from the start, keeping a shadow of the jump table stack so else,
+    //loop and break can guess which block they close. The guess is checked at run time.
+    int pos = scriptStart;
+    int furthest = scriptStart;
+    int stack[0x400];
+    int stackPos = 0;
+    int target;
+    numInstructions = 0;
+    numJumpTargets = 0;
+    while (1)
+    {
+        struct ScriptInstruction* instruction = &instructions[numInstructions];
+        if (numInstructions >= MAX_INSTRUCTIONS || pos >= image.scriptDataPos)
+        {
+            return 0;
+        }
+        instruction->pos = pos;
+        instruction->opcode = image.scriptData[pos++];
+        if (instruction->opcode < 0 || instruction->opcode >= (int)sizeof(scriptOpcodeSizes))
+        {
+            return 0;
+        }
+        instruction->numOperands = scriptOpcodeSizes[instruction->opcode];
+        for (int i = 0; i < instruction->numOperands; i++)
+        {
+            if (!ScriptCompiler_DecodeOperand(&pos, &instruction->operands[i]))
+            {
+                return 0;
+            }
+        }
+        instruction->next = pos;
+        instruction->expectedTop = -1;
+        int k = instruction->numOperands > 0 && instruction->operands[0].type == 2 ? instruction->operands[0].value : -1;
+        switch (instruction->opcode)
+        {
+            case 19: case 20: case 21: case 22: case 23: case 24:
+            case 27: case 28: case 29: case 30: case 31: case 32:
+            case 34:
+            {
+                if (stackPos >= 0x400)
+                {
+                    return 0;
+                }
+                stack[stackPos++] = k;
+                if (k >= 0)
+                {
+                    //If and while keep their two targets at k and k + 1, switch keeps its bounds there
+                    //followed by the default, the end and one target per case
+                    int first = instruction->opcode == 34 ? 2 : 0;
+                    int count = 2;
+                    if (instruction->opcode == 34)
+                    {
+                        if (jumpTablePtr + k + 1 >= image.jumpTableDataPos)
+                        {
+                            return 0;
+                        }
+                        int low = image.jumpTableData[jumpTablePtr + k];
+                        int high = image.jumpTableData[jumpTablePtr + k + 1];
+                        if (high < low || high - low > 0x400)
+                        {
+                            return 0;
+                        }
+                        count = 3 + high - low;
+                    }
+                    for (int i = first; i < first + count; i++)
+                    {
+                        if (!ScriptCompiler_JumpTarget(scriptStart, jumpTablePtr, k + i, &target) || numJumpTargets >= MAX_INSTRUCTIONS)
+                        {
+                            return 0;
+                        }
+                        jumpTargets[numJumpTargets++] = target;
+                        furthest = target > furthest ? target : furthest;
+                    }
+                }
+                break;
+            }
+            case 25:
+            case 35:
+            {
+                instruction->expectedTop = stackPos > 0 ? stack[stackPos - 1] : -1;
+                break;
+            }
+            case 33:
+            {
+                instruction->expectedTop = stackPos > 0 ? stack[stackPos - 1] : -1;
+                stackPos = stackPos > 0 ? stackPos - 1 : 0;
+                break;
+            }
+            case 26:
+            case 36:
+            {
+                stackPos = stackPos > 0 ? stackPos - 1 : 0;
+                break;
+            }
+        }
+        numInstructions++;
+        if ((instruction->opcode == 0 || instruction->opcode == 106) && pos > furthest)
+        {
+            break;
+        }
+    }
+    bodyEnd = pos;
+    memset(isInstruction + scriptStart, 0, pos - scriptStart);
+    memset(labelUsed + scriptStart, 0, pos - scriptStart);
+    for (int i = 0; i < numInstructions; i++)
+    {
+        isInstruction[instructions[i].pos] = 1;
+    }
+    for (int i = 0; i < numJumpTargets; i++)
+    {
+        if (jumpTargets[i] < scriptStart || jumpTargets[i] >= pos || !isInstruction[jumpTargets[i]])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void ScriptCompiler_EmitAddress(struct TextBuffer* buffer, struct ScriptOperand* operand)
+{
+    const char* signs[] = { "", "", "objectLoop + ", "objectLoop - " };
+    if (operand->addressing == 0)
+    {
+        ScriptCompiler_Append(buffer, "objectLoop");
+    }
+    else if (operand->indexIsArray)
+    {
+        ScriptCompiler_Append(buffer, "%sscriptEng.arrayPosition[%d]", signs[operand->addressing], operand->index);
+    }
+    else
+    {
+        ScriptCompiler_Append(buffer, "%s%d", signs[operand->addressing], operand->index);
+    }
+}
+
+int ScriptCompiler_EmitVariable(struct TextBuffer* buffer, struct ScriptOperand* operand)
+{
+    //Plain storage is accessed in place, anything with side effects goes through the interpreter's helpers
+    int variable = operand->value;
+    if (variable >= 0 && variable < 8)
+    {
+        ScriptCompiler_Append(buffer, "scriptEng.tempValue[%d]", variable);
+    }
+    else if (variable == 8)
+    {
+        ScriptCompiler_Append(buffer, "scriptEng.checkResult");
+    }
+    else if (variable == 9 || variable == 10)
+    {
+        ScriptCompiler_Append(buffer, "scriptEng.arrayPosition[%d]", variable - 9);
+    }
+    else if (variable == 11 || variable == 15 || variable == 16 || (variable >= 32 && variable < 40))
+    {
+        ScriptCompiler_Append(buffer, variable == 11 ? "globalVariables[" : variable == 15 ? "objectEntityXPos[" : variable == 16 ? "objectEntityYPos[" : "objectEntityList[");
+        ScriptCompiler_EmitAddress(buffer, operand);
+        if (variable >= 32)
+        {
+            ScriptCompiler_Append(buffer, "].value[%d]", variable - 32);
+        }
+        else
+        {
+            ScriptCompiler_Append(buffer, "]");
+        }
+    }
+    else
+    {
+        return 0;
+    }
+    return 1;
+}
+
+void ScriptCompiler_EmitGoto(struct TextBuffer* buffer, int target, const char* indent)
+{
+    labelUsed[target] = 1;
+    ScriptCompiler_Append(buffer, "%sgoto L%d;\n", indent, target);
+}
+
+void ScriptCompiler_EmitDynamicJump(struct TextBuffer* buffer, int scriptStart, int jumpTablePtr, const char* index, const char* indent)
+{
+    needsDispatch = 1;
+    ScriptCompiler_Append(buffer, "%spc = %d + jumpTableData[%d + %s];\n", indent, scriptStart, jumpTablePtr, index);
+}
+
+void ScriptCompiler_EmitInstruction(struct TextBuffer* buffer, struct ScriptInstruction* instruction, int scriptStart, int jumpTablePtr)
+{
+    int opcode = instruction->opcode;
+    int k = instruction->numOperands > 0 && instruction->operands[0].type == 2 ? instruction->operands[0].value : -1;
+    int target = 0;
+    int writes = 0;
+    const char* indent = "        ";
+    for (int i = 0; i < instruction->numOperands; i++)
+    {
+        struct ScriptOperand* operand = &instruction->operands[i];
+        switch (operand->type)
+        {
+            case 1:
+            {
+                struct TextBuffer variable = { NULL, 0, 0 };
+                if (ScriptCompiler_EmitVariable(&variable, operand))
+                {
+                    ScriptCompiler_Append(buffer, "    scriptEng.operands[%d] = %s;\n", i, variable.text);
+                }
+                else
+                {
+                    ScriptCompiler_Append(buffer, "    ObjectSystem_ReadScriptVariable(%d, ", operand->value);
+                    ScriptCompiler_EmitAddress(buffer, operand);
+                    ScriptCompiler_Append(buffer, ", %d);\n", i);
+                }
+                free(variable.text);
+                writes++;
+                break;
+            }
+            case 2:
+            {
+                ScriptCompiler_Append(buffer, "    scriptEng.operands[%d] = %d;\n", i, operand->value);
+                break;
+            }
+            case 3:
+            {
+                ScriptCompiler_Append(buffer, "    scriptEng.sRegister = %d;\n    scriptText[%d] = '\\0';\n", operand->length, operand->length);
+                if (operand->length > 0)
+                {
+                    ScriptCompiler_Append(buffer, "    memcpy(scriptText, \"");
+                    for (int j = 0; j < operand->length; j++)
+                    {
+                        ScriptCompiler_Append(buffer, "\\%03o", (unsigned char)operand->text[j]);
+                    }
+                    ScriptCompiler_Append(buffer, "\", %d);\n", operand->length);
+                }
+                writes++;
+                break;
+            }
+        }
+    }
+    switch (opcode)
+    {
+        case 0:
+        {
+            ScriptCompiler_Append(buffer, "    return 1;\n");
+            break;
+        }
+        case 19: case 20: case 21: case 22: case 23: case 24:
+        case 27: case 28: case 29: case 30: case 31: case 32:
+        {
+            //If jumps to the else/endif when the test fails, while jumps past the loop
+            int isWhile = opcode >= 27;
+            const char* condition = ifConditions[opcode - (isWhile ? 27 : 19)];
+            if (!isWhile)
+            {
+                ScriptCompiler_Append(buffer, "    jumpTableStackPos = jumpTableStackPos + 1;\n    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];\n");
+            }
+            ScriptCompiler_Append(buffer, "    if (scriptEng.operands[1] %s scriptEng.operands[2])\n    {\n", condition);
+            if (k >= 0)
+            {
+                ScriptCompiler_JumpTarget(scriptStart, jumpTablePtr, k + isWhile, &target);
+                ScriptCompiler_EmitGoto(buffer, target, "        ");
+            }
+            else
+            {
+                ScriptCompiler_EmitDynamicJump(buffer, scriptStart, jumpTablePtr, isWhile ? "scriptEng.operands[0] + 1" : "scriptEng.operands[0]", "        ");
+                ScriptCompiler_Append(buffer, "        goto dispatch;\n");
+            }
+            ScriptCompiler_Append(buffer, "    }\n");
+            if (isWhile)
+            {
+                ScriptCompiler_Append(buffer, "    jumpTableStackPos = jumpTableStackPos + 1;\n    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];\n");
+            }
+            break;
+        }
+        case 25:
+        case 33:
+        case 35:
+        {
+            //Else, loop and break jump through whatever block is on top of the stack
+            int offset = opcode == 25 ? 1 : opcode == 33 ? 0 : 3;
+            char index[64];
+            if (instruction->expectedTop >= 0 && ScriptCompiler_JumpTarget(scriptStart, jumpTablePtr, instruction->expectedTop + offset, &target)
+                && target >= scriptStart && target < bodyEnd && isInstruction[target])
+            {
+                ScriptCompiler_Append(buffer, "    if (jumpTableStack[jumpTableStackPos] == %d)\n    {\n        jumpTableStackPos = jumpTableStackPos - 1;\n", instruction->expectedTop);
+                ScriptCompiler_EmitGoto(buffer, target, "        ");
+                ScriptCompiler_Append(buffer, "    }\n");
+            }
+            snprintf(index, sizeof(index), offset > 0 ? "jumpTableStack[jumpTableStackPos] + %d" : "jumpTableStack[jumpTableStackPos]", offset);
+            ScriptCompiler_EmitDynamicJump(buffer, scriptStart, jumpTablePtr, index, "    ");
+            ScriptCompiler_Append(buffer, "    jumpTableStackPos = jumpTableStackPos - 1;\n    goto dispatch;\n");
+            break;
+        }
+        case 26:
+        case 36:
+        {
+            ScriptCompiler_Append(buffer, "    jumpTableStackPos = jumpTableStackPos - 1;\n");
+            break;
+        }
+        case 34:
+        {
+            char index[128];
+            ScriptCompiler_Append(buffer, "    jumpTableStackPos = jumpTableStackPos + 1;\n    jumpTableStack[jumpTableStackPos] = scriptEng.operands[0];\n");
+            if (k >= 0)
+            {
+                int low = image.jumpTableData[jumpTablePtr + k];
+                int high = image.jumpTableData[jumpTablePtr + k + 1];
+                ScriptCompiler_Append(buffer, "    switch (scriptEng.operands[1])\n    {\n");
+                for (int i = 0; i <= high - low; i++)
+                {
+                    ScriptCompiler_JumpTarget(scriptStart, jumpTablePtr, k + 4 + i, &target);
+                    ScriptCompiler_Append(buffer, "        case %d:\n", low + i);
+                    ScriptCompiler_EmitGoto(buffer, target, "            ");
+                }
+                ScriptCompiler_JumpTarget(scriptStart, jumpTablePtr, k + 2, &target);
+                ScriptCompiler_Append(buffer, "        default:\n");
+                ScriptCompiler_EmitGoto(buffer, target, "            ");
+                ScriptCompiler_Append(buffer, "    }\n");
+            }
+            else
+            {
+                needsDispatch = 1;
+                ScriptCompiler_Append(buffer, "    if (scriptEng.operands[1] < jumpTableData[%d + scriptEng.operands[0]] || scriptEng.operands[1] > jumpTableData[%d + scriptEng.operands[0] + 1])\n    {\n", jumpTablePtr, jumpTablePtr);
+                ScriptCompiler_EmitDynamicJump(buffer, scriptStart, jumpTablePtr, "scriptEng.operands[0] + 2", "        ");
+                ScriptCompiler_Append(buffer, "    }\n    else\n    {\n");
+                snprintf(index, sizeof(index), "scriptEng.operands[0] + 4 + (scriptEng.operands[1] - jumpTableData[%d + scriptEng.operands[0]])", jumpTablePtr);
+                ScriptCompiler_EmitDynamicJump(buffer, scriptStart, jumpTablePtr, index, "        ");
+                ScriptCompiler_Append(buffer, "    }\n    goto dispatch;\n");
+            }
+            break;
+        }
+        case 105:
+        {
+            ScriptCompiler_Append(buffer, "    functionStack[functionStackPos] = %d;\n    functionStackPos = functionStackPos + 1;\n", instruction->next);
+            ScriptCompiler_Append(buffer, "    functionStack[functionStackPos] = %d;\n    functionStackPos = functionStackPos + 1;\n", jumpTablePtr);
+            ScriptCompiler_Append(buffer, "    functionStack[functionStackPos] = %d;\n    functionStackPos = functionStackPos + 1;\n", scriptStart);
+            ScriptCompiler_Append(buffer, "    if (ObjectSystem_CallFunctionScript(scriptEng.operands[0], scriptSub) != 0)\n    {\n        return 1;\n    }\n");
+            break;
+        }
+        case 106:
+        {
+            ScriptCompiler_Append(buffer, "    functionStackPos = functionStackPos - 3;\n    return 0;\n");
+            break;
+        }
+        default:
+        {
+            if (writes == 0)
+            {
+                ScriptCompiler_Append(buffer, "    ObjectSystem_ExecuteOpcode(%d, scriptSub);\n", opcode);
+                break;
+            }
+            if (opcode < (int)(sizeof(inlineOpcodes) / sizeof(inlineOpcodes[0])) && inlineOpcodes[opcode] != NULL)
+            {
+                ScriptCompiler_Append(buffer, "    scriptEng.operands[0] = %s;\n", inlineOpcodes[opcode]);
+                indent = "    ";
+            }
+            else
+            {
+                ScriptCompiler_Append(buffer, "    if (ObjectSystem_ExecuteOpcode(%d, scriptSub) > 0)\n    {\n", opcode);
+            }
+            for (int i = 0; i < instruction->numOperands; i++)
+            {
+                struct ScriptOperand* operand = &instruction->operands[i];
+                if (operand->type == 1)
+                {
+                    struct TextBuffer variable = { NULL, 0, 0 };
+                    if (ScriptCompiler_EmitVariable(&variable, operand))
+                    {
+                        ScriptCompiler_Append(buffer, "%s%s = scriptEng.operands[%d];\n", indent, variable.text, i);
+                    }
+                    else
+                    {
+                        ScriptCompiler_Append(buffer, "%sObjectSystem_WriteScriptVariable(%d, ", indent, operand->value);
+                        ScriptCompiler_EmitAddress(buffer, operand);
+                        ScriptCompiler_Append(buffer, ", %d);\n", i);
+                    }
+                    free(variable.text);
+                }
+                else if (operand->type == 3)
+                {
+                    ScriptCompiler_Append(buffer, "%sscriptEng.sRegister = %d;\n", indent, operand->length);
+                }
+            }
+            if (indent[4] != '\0')
+            {
+                ScriptCompiler_Append(buffer, "    }\n");
+            }
+            break;
+        }
+    }
+}
+
+char* ScriptCompiler_CompileBody(int scriptStart, int jumpTablePtr)
+{
+    //Returns everything after the function name, so identical bodies can be shared between modules
+    struct TextBuffer body = { NULL, 0, 0 };
+    struct TextBuffer* code;
+    if (!ScriptCompiler_DecodeBody(scriptStart, jumpTablePtr))
+    {
+        return NULL;
+    }
+    needsDispatch = 0;
+    code = calloc(numInstructions, sizeof(struct TextBuffer));
+    for (int i = 0; i < numInstructions; i++)
+    {
+        ScriptCompiler_EmitInstruction(&code[i], &instructions[i], scriptStart, jumpTablePtr);
+    }
+    if (needsDispatch)
+    {
+        for (int i = 0; i < numJumpTargets; i++)
+        {
+            labelUsed[jumpTargets[i]] = 1;
+        }
+    }
+    ScriptCompiler_Append(&body, "(int scriptSub)\n{\n");
+    if (needsDispatch)
+    {
+        ScriptCompiler_Append(&body, "    int pc;\n");
+    }
+    for (int i = 0; i < numInstructions; i++)
+    {
+        if (labelUsed[instructions[i].pos])
+        {
+            ScriptCompiler_Append(&body, "L%d:\n", instructions[i].pos);
+        }
+        ScriptCompiler_Append(&body, "%s", code[i].text);
+        free(code[i].text);
+    }
+    free(code);
+    if (needsDispatch)
+    {
+        //Targets picked at run time land on a label when there is one, otherwise the interpreter
+        //carries on from there with the stacks exactly as the compiled code left them
+        ScriptCompiler_Append(&body, "dispatch:\n    switch (pc)\n    {\n");
+        for (int i = 0; i < numInstructions; i++)
+        {
+            if (labelUsed[instructions[i].pos])
+            {
+                ScriptCompiler_Append(&body, "        case %d:\n            goto L%d;\n", instructions[i].pos, instructions[i].pos);
+            }
+        }
+        ScriptCompiler_Append(&body, "        default:\n            return ObjectSystem_RunScript(pc, %d, %d, scriptSub);\n    }\n", jumpTablePtr, scriptStart);
+    }
+    ScriptCompiler_Append(&body, "}\n");
+    return body.text;
+}
+
+int ScriptCompiler_AddBody(char* text)
+{
+    for (int i = 0; i < numBodies; i++)
+    {
+        if (strcmp(bodyTexts[i], text) == 0)
+        {
+            free(text);
+            return i;
+        }
+    }
+    if (numBodies == bodyCapacity)
+    {
+        bodyCapacity = bodyCapacity > 0 ? bodyCapacity * 2 : 0x100;
+        bodyTexts = realloc(bodyTexts, bodyCapacity * sizeof(char*));
+    }
+    bodyTexts[numBodies] = text;
+    return numBodies++;
+}
+
+uint64_t ScriptCompiler_HashImage()
+{
+    //Must match ObjectSystem_BindCompiledScripts
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (int i = 0; i < image.scriptDataPos; i++)
+    {
+        hash = (hash ^ (uint32_t)image.scriptData[i]) * 0x100000001b3ull;
+    }
+    for (int i = 0; i < image.jumpTableDataPos; i++)
+    {
+        hash = (hash ^ (uint32_t)image.jumpTableData[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+int main(int argc, char* argv[])
+{
+    struct TextBuffer modules = { NULL, 0, 0 };
+    struct TextBuffer output = { NULL, 0, 0 };
+    int standalone = 0;
+    int numModules = 0;
+    int numCompiled = 0;
+    int numSkipped = 0;
+    FILE* file;
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <output.c> <GlobalCode.bin> [stage.bin ...] [-standalone stage.bin ...]\n", argv[0]);
+        return 1;
+    }
+    for (int i = 2; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-standalone") == 0)
+        {
+            standalone = 1;
+            continue;
+        }
+        if (numScriptFiles == MAX_FILES)
+        {
+            fprintf(stderr, "Too many script files\n");
+            return 1;
+        }
+        scriptFiles[numScriptFiles].path = argv[i];
+        scriptFiles[numScriptFiles].standalone = standalone;
+        if (!ScriptCompiler_LoadFile(&scriptFiles[numScriptFiles]))
+        {
+            return 1;
+        }
+        numScriptFiles++;
+    }
+    //File 0 is the global code, compiled once on its own and once in front of every shared stage
+    for (int i = 0; i < numScriptFiles; i++)
+    {
+        memset(&image, 0, sizeof(image));
+        if (i > 0 && !scriptFiles[i].standalone && !ScriptCompiler_LoadImage(&scriptFiles[0]))
+        {
+            fprintf(stderr, "Bad script file %s\n", scriptFiles[0].path);
+            return 1;
+        }
+        if (!ScriptCompiler_LoadImage(&scriptFiles[i]))
+        {
+            fprintf(stderr, "Bad script file %s\n", scriptFiles[i].path);
+            return 1;
+        }
+        ScriptCompiler_Append(&modules, "const struct CompiledScriptEntry compiledScriptEntries%d[] = {\n", numModules);
+        for (int j = 0; j < image.numEntries; j++)
+        {
+            char* text = ScriptCompiler_CompileBody(image.entryCode[j], image.entryJumpTable[j]);
+            if (text == NULL)
+            {
+                numSkipped++;
+                continue;
+            }
+            ScriptCompiler_Append(&modules, "    { %d, %d, CompiledScript_%d },\n", image.entryCode[j], image.entryJumpTable[j], ScriptCompiler_AddBody(text));
+            numCompiled++;
+        }
+        ScriptCompiler_Append(&modules, "    { 0x3ffff, 0x3fff, NULL }\n};\n\n");
+        ScriptCompiler_Append(&modules, "const struct CompiledScriptModule compiledScriptModule%d = { 0x%016llxull, sizeof(compiledScriptEntries%d) / sizeof(struct CompiledScriptEntry) - 1, compiledScriptEntries%d };\n\n",
+                              numModules, (unsigned long long)ScriptCompiler_HashImage(), numModules, numModules);
+        numModules++;
+    }
+    ScriptCompiler_Append(&output, "//\n//  CompiledScripts.c\n//  rvm\n//\n\n//Generated by rvm/Tools/ScriptCompiler.c, do not edit.\n\n#include \"ObjectSystem.h\"\n#include \"EngineBuffers.h\"\n\n");
+    for (int i = 0; i < numBodies; i++)
+    {
+        ScriptCompiler_Append(&output, "int CompiledScript_%d%s\n", i, bodyTexts[i]);
+    }
+    ScriptCompiler_Append(&output, "%s", modules.text != NULL ? modules.text : "");
+    ScriptCompiler_Append(&output, "const struct CompiledScriptModule* const compiledScriptModules[] = {\n");
+    for (int i = 0; i < numModules; i++)
+    {
+        ScriptCompiler_Append(&output, "    &compiledScriptModule%d,\n", i);
+    }
+    ScriptCompiler_Append(&output, "    NULL\n};\nconst int numCompiledScriptModules = %d;\n", numModules);
+    file = fopen(argv[1], "wb");
+    if (file == NULL || fwrite(output.text, 1, output.length, file) != output.length)
+    {
+        fprintf(stderr, "Can't write %s\n", argv[1]);
+        return 1;
+    }
+    fclose(file);
+    printf("%d modules, %d scripts compiled into %d functions, %d left to the interpreter\n", numModules, numCompiled, numBodies, numSkipped);
+    return 0;
+}
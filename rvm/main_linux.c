@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_opengl.h>
 #include <GL/gl.h>
@@ -11,8 +12,15 @@
 #include <emscripten.h>
 #include <emscripten/html5.h>
 #endif
+#include "EngineBuffers.h"
 
 static SDL_Window* gWindow;
+static const char* scriptProfilePath;
+static int frameSkipLimit = 4;
+static int fastForwardFrames = -1;
+static int tempPoolStats;
+static unsigned int framesSimulated;
+static unsigned int framesSkipped;
 
 static void initAttributes()
 {
@@ -98,6 +106,7 @@ static void createSurface(int fullscreen)
 
 void UpdateIO() {
 	InputSystem_CheckKeyboardInput();
+	InputSystem_UpdateReplay();
 	InputSystem_ClearTouchData();
 
 	if (stageMode != 2)
@@ -120,14 +129,76 @@ void HandleNextFrame() {
 	}
 }
 
+// Submit the current draw lists, alpha places the moving parts between the last two steps.
+// Returns 0 when the frame matches the one already on screen and there's nothing to swap.
+static int presentFrame(float alpha)
+{
+	int changed;
+	if (renderInterpolation)
+		GraphicsSystem_InterpolatePolyList(alpha);
+	changed = RenderDevice_FrameChanged();
+	if (changed) {
+		if (highResMode == 0)
+			RenderDevice_FlipScreen();
+		else
+			RenderDevice_FlipScreenHRes();
+	}
+	if (renderInterpolation)
+		GraphicsSystem_RestorePolyList();
+	return changed;
+}
+
+// Simulate one 60 Hz step, a step that isn't presented skips its draw lists and GL submission
+static void runFrame(int present)
+{
+	// The draw list digest hashes what each step drew, so with it on every step is drawn
+	if (digestGfxEnabled)
+		present = 1;
+	skipFrameDraw = !present;
+	UpdateIO();
+	if (stageMode == 2)
+		EngineCallbacks_ProcessMainLoop();
+	if (present) {
+		frameSkipTimer = 0;
+	}
+	else {
+		frameSkipTimer = frameSkipTimer < 0 ? 1 : frameSkipTimer + 1;
+		framesSkipped++;
+	}
+	framesSimulated++;
+}
+
+// Run every step that has come due and return the time left over, speed scales how many
+// steps a display frame is allowed to catch up on
+static Uint64 runDueFrames(Uint64 accumulator, Uint64 step, int speed)
+{
+	// Past the skip limit the game slows down rather than skipping more draws
+	int maxSkip = frameSkipSetting > frameSkipLimit ? frameSkipSetting : frameSkipLimit;
+	if (accumulator > step * (Uint64)((maxSkip + 1) * speed))
+		accumulator = step * (Uint64)((maxSkip + 1) * speed);
+
+	// Every step simulates, only the last one due builds its draw lists
+	while (accumulator >= step) {
+		accumulator -= step;
+		runFrame(accumulator < step);
+	}
+	return accumulator;
+}
+
 static void mainLoop()
 {
 	SDL_Event event;
 	int done = 0;
-	int fps = 60;
-	int delay = 1000 / fps;
-	int thenTicks = -1;
-	int nowTicks;
+	int presented;
+	Uint64 frequency = SDL_GetPerformanceFrequency();
+	Uint64 step = frequency / 60;
+	Uint64 accumulator = step;
+	Uint64 thenCounter = SDL_GetPerformanceCounter();
+	Uint64 nowCounter;
+
+	// With vsync the swap paces the loop, otherwise sleep until the next step is due.
+	// Uncapped fast-forward turns it off so the swap never waits.
+	int vsync = SDL_GL_SetSwapInterval(fastForwardFrames == 0 ? 0 : 1) == 0;
 
 	while (!done) {
 		/* Check for events */
@@ -143,29 +214,69 @@ static void mainLoop()
 			case SDL_QUIT:
 				done = 1;
 				break;
+			case SDL_WINDOWEVENT:
+				// The window may have lost what was on it, draw the next frame even if it matches
+				presentedFrameHash = 0;
+				break;
 			default:
 				break;
 			}
 		}
-		
-		UpdateIO();
-		HandleNextFrame();
-		SDL_GL_SwapWindow(gWindow);
 
-		// Time how long each draw-swap-delay cycle takes
-		// and adjust delay to get closer to target framerate
-		if (thenTicks > 0) {
-			nowTicks = SDL_GetTicks();
-			delay += (1000 / fps - (nowTicks - thenTicks));
-			thenTicks = nowTicks;
-			if (delay < 0)
-				delay = 1000 / fps;
+		if (fastForwardFrames == 0) {
+			// Uncapped: run as many steps as fit in one step's worth of wall time, present the last
+			nowCounter = SDL_GetPerformanceCounter();
+			while (SDL_GetPerformanceCounter() - nowCounter < step)
+				runFrame(0);
+			runFrame(1);
+			if (presentFrame(1.0f))
+				SDL_GL_SwapWindow(gWindow);
+			continue;
+		}
+
+		// Fast-forward runs game time N times faster than wall time, so the speed holds whatever
+		// rate the display refreshes at
+		nowCounter = SDL_GetPerformanceCounter();
+		accumulator += (nowCounter - thenCounter) * (Uint64)(fastForwardFrames > 0 ? fastForwardFrames : 1);
+		thenCounter = nowCounter;
+
+		if (fastForwardFrames > 0) {
+			if (accumulator < step) {
+				SDL_Delay(1);
+				continue;
+			}
+			// Only the last step of each batch is presented
+			accumulator = runDueFrames(accumulator, step, fastForwardFrames);
+			if (presentFrame(1.0f))
+				SDL_GL_SwapWindow(gWindow);
+			continue;
 		}
-		else {
-			thenTicks = SDL_GetTicks();
+
+		if (renderInterpolation) {
+			// Present at the display's own rate, between steps the last one is drawn part way
+			// back towards the one before it
+			accumulator = runDueFrames(accumulator, step, 1);
+			presented = presentFrame((float)accumulator / step);
+			if (presented)
+				SDL_GL_SwapWindow(gWindow);
+			// Without a swap to wait on, hand the CPU back for a moment
+			if (!presented || !vsync)
+				SDL_Delay(1);
+			continue;
 		}
 
-		SDL_Delay(delay);
+		// Swaps land a little either side of the refresh, count a step that's nearly due as due
+		if (vsync && accumulator < step && accumulator + step / 8 >= step)
+			accumulator = step;
+		if (accumulator < step) {
+			SDL_Delay((Uint32)((step - accumulator) * 1000 / frequency));
+			continue;
+		}
+
+		// An unchanged frame leaves the last one on screen, the delay above paces the loop without the swap
+		accumulator = runDueFrames(accumulator, step, 1);
+		if (presentFrame(1.0f))
+			SDL_GL_SwapWindow(gWindow);
 	}
 }
 
@@ -186,6 +297,70 @@ void Init_RetroVM() {
 	gameTrialMode = GAME_FULL;
 }
 
+// Time ObjectSystem_ProcessObjects over an empty and then a fully populated entity table,
+// so changes to the entity layout or the activation scan can be compared
+static void benchObjects(int frames)
+{
+	Uint64 start;
+	double scanTime;
+	double fullTime;
+	if (frames < 1)
+		frames = 1;
+	memset(objectEntityType, 0, sizeof(objectEntityType));
+	start = SDL_GetPerformanceCounter();
+	for (int f = 0; f < frames; f++)
+		ObjectSystem_ProcessObjects();
+	scanTime = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / SDL_GetPerformanceFrequency() / frames;
+	for (int i = 0; i < 0x4A0; i++) {
+		objectEntityType[i] = (uint8_t)(1 + i % 0xFF);
+		objectEntityPriority[i] = 1;
+		objectEntityDrawOrder[i] = (uint8_t)(i % 7);
+		objectEntityXPos[i] = (i << 3) << 16;
+		objectEntityYPos[i] = (i & 0xFF) << 16;
+	}
+	start = SDL_GetPerformanceCounter();
+	for (int f = 0; f < frames; f++)
+		ObjectSystem_ProcessObjects();
+	fullTime = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / SDL_GetPerformanceFrequency() / frames;
+	printf("ProcessObjects over %d frames: empty table %.2f us/frame, full table %.2f us/frame\n", frames, scanTime, fullTime);
+}
+
+// Play the same replay on several headless instances at once, one thread each.
+// Every instance should end on the same digest as the others.
+static int runInstances(int count, const char* replayPath, const char* digestPrefix)
+{
+	struct EngineInstance* instances;
+	char digestPath[256];
+	Uint64 start;
+	double seconds;
+	int frames = 0;
+	int mismatches = 0;
+	if (count < 1)
+		count = 1;
+	instances = calloc(count, sizeof(struct EngineInstance));
+	if (instances == NULL)
+		return 1;
+	start = SDL_GetPerformanceCounter();
+	for (int i = 0; i < count; i++) {
+		if (digestPrefix != NULL)
+			snprintf(digestPath, sizeof(digestPath), "%s.%d", digestPrefix, i);
+		if (!EngineContext_StartInstance(&instances[i], replayPath, digestPrefix != NULL ? digestPath : NULL, 0))
+			fprintf(stderr, "Couldn't start instance %d: %s\n", i, SDL_GetError());
+	}
+	for (int i = 0; i < count; i++)
+		EngineContext_WaitInstance(&instances[i]);
+	seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+	for (int i = 0; i < count; i++) {
+		printf("Instance %d: %d frames, digest %016llx%s\n", i, instances[i].framesRun, (unsigned long long)instances[i].digest, instances[i].replayLoaded ? "" : " (replay not loaded)");
+		frames += instances[i].framesRun;
+		if (instances[i].digest != instances[0].digest || !instances[i].replayLoaded)
+			mismatches++;
+	}
+	printf("%d instances, %d frames in %.2fs (%.0f frames/s)\n", count, frames, seconds, seconds > 0.0 ? frames / seconds : 0.0);
+	free(instances);
+	return mismatches > 0 ? 1 : 0;
+}
+
 #ifdef __EMSCRIPTEN__
 void loop_func(void *arg) {
   // Can render to the screen here, etc.
@@ -208,14 +383,44 @@ void loop_func(void *arg) {
 		}
 	}
 		
+	if (renderInterpolation) {
+		// Called once per browser frame rather than at 60 Hz, so keep time the same way as the native loop
+		static Uint64 accumulator;
+		static Uint64 thenCounter;
+		Uint64 step = SDL_GetPerformanceFrequency() / 60;
+		Uint64 nowCounter = SDL_GetPerformanceCounter();
+		if (thenCounter == 0)
+			accumulator = step;
+		else
+			accumulator += nowCounter - thenCounter;
+		thenCounter = nowCounter;
+		accumulator = runDueFrames(accumulator, step, 1);
+		if (presentFrame((float)accumulator / step))
+			SDL_GL_SwapWindow(gWindow);
+		return;
+	}
+
 	UpdateIO();
-	HandleNextFrame();
-	SDL_GL_SwapWindow(gWindow);
+	if (stageMode == 2)
+		EngineCallbacks_ProcessMainLoop();
+	if (presentFrame(1.0f))
+		SDL_GL_SwapWindow(gWindow);
 }
 #endif
 
 int main (int argc, char **argv)
 {
+	// Compare two digest logs and report where they first diverge: exits 0 if they match,
+	// 1 if they diverge and 2 if either can't be read
+	if (argc > 3 && strcmp(argv[1], "-digestcompare") == 0) {
+		int frame = StateDigest_CompareLogs(argv[2], argv[3]);
+		return frame == DIGEST_LOGS_AGREE ? 0 : frame == DIGEST_LOGS_UNREADABLE ? 2 : 1;
+	}
+
+	// Run headless instances side by side: -instances <count> <replay> [digest log prefix]
+	if (argc > 3 && strcmp(argv[1], "-instances") == 0)
+		return runInstances(atoi(argv[2]), argv[3], argc > 4 ? argv[4] : NULL);
+
 	// Init SDL video subsystem
 	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
 
@@ -233,19 +438,106 @@ int main (int argc, char **argv)
 	// Get GL context attributes
 	printAttributes();
 
+	if (!EngineContext_CreateBuffers()) {
+		fprintf(stderr, "Couldn't allocate the engine buffers\n");
+		exit(1);
+	}
+
 	printf("Trying to init\n");
 	Init_RetroVM();
 	printf("Init finished\n");
+	for (int i = 1; i + 1 < argc; i++) {
+		if (strcmp(argv[i], "-record") == 0)
+			InputSystem_StartRecording(argv[i + 1], (uint32_t)time(NULL));
+		else if (strcmp(argv[i], "-replay") == 0)
+			InputSystem_StartPlayback(argv[i + 1]);
+		else if (strcmp(argv[i], "-digest") == 0)
+			StateDigest_StartLog(argv[i + 1]);
+		else if (strcmp(argv[i], "-digestgfx") == 0) {
+			digestGfxEnabled = true;
+			StateDigest_StartLog(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "-scriptprofile") == 0) {
+			scriptProfileEnabled = true;
+			scriptProfilePath = argv[i + 1];
+			ObjectSystem_StartScriptProfileStage();
+		}
+		else if (strcmp(argv[i], "-superinstructions") == 0) {
+			if (!ObjectSystem_LoadSuperInstructions(argv[i + 1]))
+				fprintf(stderr, "Couldn't read superinstructions from %s\n", argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "-frameskip") == 0) {
+			frameSkipLimit = atoi(argv[i + 1]);
+			if (frameSkipLimit < 0)
+				frameSkipLimit = 0;
+		}
+		else if (strcmp(argv[i], "-fastforward") == 0) {
+			fastForwardFrames = atoi(argv[i + 1]);
+			if (fastForwardFrames < 0)
+				fastForwardFrames = 0;
+		}
+		else if (strcmp(argv[i], "-temppool") == 0) {
+			ObjectSystem_SetTempObjectPoolSize(atoi(argv[i + 1]));
+			tempPoolStats = 1;
+		}
+		else if (strcmp(argv[i], "-benchobjects") == 0) {
+			benchObjects(atoi(argv[i + 1]));
+			SDL_Quit();
+			return 0;
+		}
+		else if (strcmp(argv[i], "-bench3d") == 0) {
+			// Times transform, sort and draw over a synthetic 1024 face scene, without and then with back-face culling
+			Scene3D_Benchmark(atoi(argv[i + 1]));
+			cull3DBackFaces = true;
+			printf("With back-face culling:\n");
+			Scene3D_Benchmark(atoi(argv[i + 1]));
+			SDL_Quit();
+			return 0;
+		}
+	}
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-broadphase") == 0)
+			objectBroadphase = true;
+		else if (strcmp(argv[i], "-paralleldraw") == 0)
+			parallelTileLayers = true;
+		else if (strcmp(argv[i], "-interpolate") == 0)
+			renderInterpolation = true;
+		else if (strcmp(argv[i], "-suppressredraw") == 0)
+			redrawSuppression = true;
+		else if (strcmp(argv[i], "-cull3d") == 0)
+			cull3DBackFaces = true;
+		else if (strcmp(argv[i], "-hw3d") == 0)
+			hardware3DEnabled = true;
+		else if (strcmp(argv[i], "-interpret") == 0) {
+			compiledScriptsEnabled = false;
+			ObjectSystem_BindCompiledScripts();
+		}
+	}
 
 #ifdef __EMSCRIPTEN__
   // Receives a function to call and some user data to provide it.
-	emscripten_set_main_loop_arg(loop_func, NULL, 60, 1);
+	emscripten_set_main_loop_arg(loop_func, NULL, renderInterpolation ? 0 : 60, 1);
 #else
 	// Draw, get events...
 	mainLoop();
 #endif
 
 	// Cleanup
+	InputSystem_StopReplay();
+	StateDigest_StopLog();
+	StageSystem_StopTileLayerWorkers();
+	FileIO_StopSaveRAMWriter();
+	if (scriptProfilePath != NULL)
+		ObjectSystem_WriteScriptProfile(scriptProfilePath);
+	if (objectBroadphase)
+		printf("Player scripts run: %u, skipped by broadphase: %u\n", playerScriptCalls, playerScriptSkips);
+	if (framesSimulated > 0)
+		printf("Frames simulated: %u, draws skipped: %u (%.1f%%)\n", framesSimulated, framesSkipped, framesSkipped * 100.0 / framesSimulated);
+	if (redrawSuppression)
+		printf("Unchanged frames not redrawn: %u\n", framesSuppressed);
+	if (tempPoolStats)
+		printf("Temp objects peak: %d/%d, evicted: %u\n", tempObjectPeak, tempObjectPoolSize, tempObjectEvictions);
+	EngineContext_FreeBuffers();
 	SDL_Quit();
 
 	return 0;